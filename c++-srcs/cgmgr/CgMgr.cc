@@ -256,10 +256,11 @@ CgMgr::_find_class(
   return rep_class;
 }
 
-// @breif パタングラフを生成する．
-void
-CgMgr::gen_pat()
+// @brief パタングラフ用の論理式のリストを返す．
+vector<pair<const CiCellClass*, vector<Expr>>>
+CgMgr::pat_expr_list() const
 {
+  vector<pair<const CiCellClass*, vector<Expr>>> ans;
   for ( auto rep_class: mLibrary.npn_class_list() ) {
     bool has_cell = false;
     for ( auto group: rep_class->cell_group_list() ) {
@@ -269,48 +270,10 @@ CgMgr::gen_pat()
       }
     }
     if ( has_cell ) {
-      const auto& expr_list = mExprListDict.at(rep_class);
-      for ( const auto& expr: expr_list ) {
-	mPatMgr.reg_pat(expr, rep_class);
-      }
+      ans.push_back(make_pair(rep_class, mExprListDict.at(rep_class)));
     }
   }
-}
-
-// @brief 全ノード数を返す．
-SizeType
-CgMgr::pat_node_num() const
-{
-  return mPatMgr.node_num();
-}
-
-// @brief ノードを返す．
-const PatNode&
-CgMgr::pat_node(
-  SizeType pos
-) const
-{
-  return mPatMgr.node(pos);
-}
-
-// @brief パタン数を返す．
-SizeType
-CgMgr::pat_num() const
-{
-  return mPatMgr.pat_num();
-}
-
-// @brief パタンのノードリストを返す．
-void
-CgMgr::get_pat_info(
-  SizeType id,
-  const CiCellClass*& rep_class,
-  SizeType& input_num,
-  vector<SizeType>& node_list
-) const
-{
-  rep_class = mPatMgr.rep_class(id);
-  mPatMgr.get_pat_info(id, input_num, node_list);
+  return ans;
 }
 
 END_NAMESPACE_YM_CLIB
@@ -7,12 +7,8 @@
 /// All rights reserved.
 
 #include "cgmgr/PatMgr.h"
-#include "cgmgr/PatNode.h"
-#include "cgmgr/PatHandle.h"
 
 #include "ym/Expr.h"
-#include "ym/UnionFindSet.h"
-#include "ym/PermGen.h"
 #include "ym/MultiCombiGen.h"
 #include "ym/MultiSetPermGen.h"
 #include "ym/Range.h"
@@ -33,16 +29,11 @@ BEGIN_NAMESPACE_YM_CLIB
 
 // @brief コンストラクタ
 PatMgr::PatMgr(
-) : mHashTable{nullptr},
-    mHashSize{0}
-{
-  alloc_table(1024);
-}
-
-// @brief デストラクタ
-PatMgr::~PatMgr()
+  double max_load
+)
 {
-  delete [] mHashTable;
+  set_max_load(max_load);
+  init_table();
 }
 
 // @brief 初期化する．
@@ -51,12 +42,32 @@ PatMgr::init()
 {
   mInputList.clear();
   mNodeList.clear();
-  delete [] mHashTable;
-  mHashTable = nullptr;
-  mHashSize = 0;
-  alloc_table(1024);
+  init_table();
   mClassList.clear();
   mPatList.clear();
+  mExprKeyDict.clear();
+  mPgDict.clear();
+  mNewPgKeyList.clear();
+  mPgList.clear();
+  mShapeDict.clear();
+  mShapeIdDict.clear();
+  mNewShapeKeyList.clear();
+  mStats = ClibPatGenStats{};
+  mClassPatNum.clear();
+  mOverflow = false;
+}
+
+// @brief ハッシュ表の最大負荷率を設定する．
+void
+PatMgr::set_max_load(
+  double max_load
+)
+{
+  if ( max_load <= 0.0 || 1.0 <= max_load ) {
+    throw std::invalid_argument{"max_load should be in (0.0, 1.0)"};
+  }
+  mMaxLoad = max_load;
+  mNextLimit = static_cast<SizeType>(mHashTable.size() * mMaxLoad);
 }
 
 // @brief 全ノード数を返す．
@@ -75,7 +86,7 @@ PatMgr::node(
   if ( pos < 0 || node_num() <= pos ) {
     throw std::out_of_range{"pos is out of range"};
   }
-  return *mNodeList[pos];
+  return mNodeList[pos];
 }
 
 // @brief パタン数を返す．
@@ -97,6 +108,16 @@ PatMgr::pat_root(
   return mPatList[id];
 }
 
+// @brief 統計情報を返す．
+ClibPatGenStats
+PatMgr::stats() const
+{
+  auto stats = mStats;
+  stats.pat_num = pat_num();
+  stats.node_num = node_num();
+  return stats;
+}
+
 // @brief パタンの属している代表クラスを返す．
 const CiCellClass*
 PatMgr::rep_class(
@@ -109,236 +130,342 @@ PatMgr::rep_class(
   return mClassList[id];
 }
 
-// @brief 論理式から生成されるパタンを登録する．
-void
-PatMgr::reg_pat(
-  const Expr& expr,
-  const CiCellClass* rep_class
+BEGIN_NONAMESPACE
+
+// @brief 論理式の構造を表す文字列を作る．
+//
+// sort_operands が true の時はオペランドの文字列を整列して
+// オペランドの順番によらない標準形を作る．
+string
+expr_key(
+  const Expr& expr,  ///< [in] 対象の論理式
+  bool sort_operands ///< [in] オペランドを整列する時 true にする．
 )
 {
-  if ( mExprListDict.count(rep_class) > 0 ) {
-    // 同じ論理式を処理済みならなにもしない．
-    auto& expr_list = mExprListDict.at(rep_class);
-    for ( auto expr1: expr_list ) {
-      if ( check_equivalent(expr, expr1) ) {
-	return;
-      }
-    }
-    // 論理式を登録しておく．
-    expr_list.push_back(expr);
+  if ( expr.is_zero() ) {
+    return "0";
   }
-  else {
-    mExprListDict.emplace(rep_class, vector<Expr>{expr});
+  if ( expr.is_one() ) {
+    return "1";
   }
-
-  vector<PatHandle> tmp_pat_list;
-  pg_sub(expr, tmp_pat_list);
-
-  for ( auto pat1: tmp_pat_list ) {
-    mClassList.push_back(rep_class);
-    mPatList.push_back(pat1);
+  if ( expr.is_posi_literal() ) {
+    return "P" + std::to_string(expr.varid());
+  }
+  if ( expr.is_nega_literal() ) {
+    return "N" + std::to_string(expr.varid());
   }
-}
 
-// @brief 2つの論理式が同形かどうか調べる．
-bool
-PatMgr::check_equivalent(
-  const Expr& expr1,
-  const Expr& expr2
-)
-{
-  if ( expr1.is_zero() ) {
-    if ( expr2.is_zero() ) {
-      return true;
-    }
-    return false;
+  string key;
+  if ( expr.is_and() ) {
+    key = "A(";
   }
-  if ( expr1.is_one() ) {
-    if ( expr2.is_one() ) {
-      return true;
-    }
-    return false;
+  else if ( expr.is_or() ) {
+    key = "O(";
   }
-  if ( expr2.is_constant() ) {
-    return false;
+  else if ( expr.is_xor() ) {
+    key = "X(";
+  }
+  else {
+    ASSERT_NOT_REACHED;
   }
 
-  if ( expr1.is_posi_literal() ) {
-    if ( expr2.is_posi_literal() && expr1.varid() == expr2.varid() ) {
-      return true;
-    }
-    return false;
+  auto n = expr.operand_num();
+  vector<string> key_list(n);
+  for ( SizeType i = 0; i < n; ++ i ) {
+    key_list[i] = expr_key(expr.operand(i), sort_operands);
   }
-  if ( expr1.is_nega_literal() ) {
-    if ( expr2.is_nega_literal() && expr1.varid() == expr2.varid() ) {
-      return true;
-    }
-    return false;
+  if ( sort_operands ) {
+    std::sort(key_list.begin(), key_list.end());
   }
-  if ( expr2.is_literal() ) {
-    return false;
+  for ( SizeType i = 0; i < n; ++ i ) {
+    if ( i > 0 ) {
+      key += ",";
+    }
+    key += key_list[i];
   }
+  key += ")";
+  return key;
+}
 
-  auto n = expr1.operand_num();
-  if ( expr2.operand_num() != n ) {
-    return false;
+// @brief パタンの形状シグネチャを作る．
+//
+// ノードを DFS の前順でたどり，演算ノードは型と枝の反転属性を，
+// 入力ノードは最初に現れた順に振り直した番号を sig に積む．
+void
+shape_sig(
+  const vector<PatNode>& node_list,             ///< [in] ノードのリスト
+  const PatNode& node,                          ///< [in] ノード
+  unordered_map<SizeType, SizeType>& input_map, ///< [in] 入力番号の対応表
+  vector<SizeType>& sig                         ///< [out] シグネチャ
+)
+{
+  if ( node.is_input() ) {
+    auto id = node.input_id();
+    if ( input_map.count(id) == 0 ) {
+      auto new_id = input_map.size();
+      input_map.emplace(id, new_id);
+    }
+    sig.push_back(input_map.at(id) << 2);
+    return;
   }
 
-  if ( expr1.is_and() && !expr2.is_and() ) {
-    return false;
-  }
-  if ( expr1.is_or() && !expr2.is_or() ) {
-    return false;
+  SizeType code = node.is_and() ? 1U : 2U;
+  if ( node.fanin_inv0() ) {
+    code |= 4U;
   }
-  if ( expr1.is_xor() && !expr2.is_xor() ) {
-    return false;
+  if ( node.fanin_inv1() ) {
+    code |= 8U;
   }
+  sig.push_back(code);
+  shape_sig(node_list, node_list[node.fanin0_id()], input_map, sig);
+  shape_sig(node_list, node_list[node.fanin1_id()], input_map, sig);
+}
 
-  for ( PermGen pg(n, n); !pg.is_end(); ++ pg ) {
-    bool match = true;
-    for ( auto i: Range(n) ) {
-      if ( !check_equivalent(expr1.operand(i), expr2.operand(pg(i))) ) {
-	match = false;
-	break;
-      }
-    }
-    if ( match ) {
-      return true;
+END_NONAMESPACE
+
+// @brief 論理式から生成されるパタンを登録する．
+void
+PatMgr::reg_pat(
+  const Expr& expr,
+  const CiCellClass* rep_class
+)
+{
+  // 同じ論理式を処理済みならなにもしない．
+  // オペランドの順番だけが異なる論理式も同じとみなす．
+  auto& key_set = mExprKeyDict[rep_class];
+  if ( !key_set.emplace(expr_key(expr, true)).second ) {
+    return;
+  }
+
+  ++ mStats.expr_num;
+
+  // 入力数の制限を調べる．
+  if ( mParam.max_input > 0 && expr.input_size() > mParam.max_input ) {
+    ++ mStats.input_pruned_expr_num;
+    return;
+  }
+
+  auto old_node_num = node_num();
+  mNewPgKeyList.clear();
+  mNewShapeKeyList.clear();
+  auto& pat_list = pg_sub(expr);
+  if ( mOverflow ) {
+    // ノード数の制限を超えたのでこの論理式から作られたものを取り除く．
+    rollback(old_node_num);
+    ++ mStats.node_pruned_expr_num;
+    return;
+  }
+
+  auto& class_pat_num = mClassPatNum[rep_class];
+  for ( auto pat1: pat_list ) {
+    if ( mParam.max_pat_per_class > 0 &&
+	 class_pat_num >= mParam.max_pat_per_class ) {
+      ++ mStats.class_pruned_pat_num;
+      continue;
     }
+    mClassList.push_back(rep_class);
+    mPatList.push_back(pat1);
+    ++ class_pat_num;
   }
-  return false;
 }
 
-// @brief 2つのパタンが同型かどうか調べる．
-bool
-PatMgr::check_equivalent(
-  PatHandle handle1,
-  PatHandle handle2
+// @brief node_num 以降に作られたノードを削除する．
+void
+PatMgr::rollback(
+  SizeType node_num
 )
 {
-  if ( handle1.inv() != handle2.inv() ) {
-    return false;
+  // 削除するノードをハッシュ表から取り除く．
+  // 古い表から削除すると移動前の要素の位置がずれることがあるので
+  // 先に再ハッシュを終わらせておく．
+  move_entries(mOldTable.size());
+  for ( SizeType id = node_num; id < mNodeList.size(); ++ id ) {
+    if ( !mNodeList[id].is_input() ) {
+      remove_node(id);
+    }
+  }
+  mNodeList.erase(mNodeList.begin() + node_num, mNodeList.end());
+  while ( !mInputList.empty() && mInputList.back() >= node_num ) {
+    mInputList.pop_back();
   }
 
-  unordered_map<SizeType, SizeType> map1;
-  unordered_map<SizeType, SizeType> map2;
+  // 削除したノードを参照している結果を捨てる．
+  // それ以前の結果が削除したノードを参照することはないので
+  // この reg_pat() で追加されたものだけを調べればよい．
+  for ( auto& key: mNewPgKeyList ) {
+    auto p = mPgDict.find(key);
+    if ( p == mPgDict.end() ) {
+      continue;
+    }
+    for ( auto handle: p->second ) {
+      if ( handle.node_id() >= node_num ) {
+	mPgDict.erase(p);
+	break;
+      }
+    }
+  }
+  mNewPgKeyList.clear();
+  for ( auto key: mNewShapeKeyList ) {
+    if ( key >= node_num * 2 ) {
+      mShapeIdDict.erase(key);
+    }
+  }
+  mNewShapeKeyList.clear();
 
-  return ceq_sub(handle1.node(), handle2.node(), map1, map2);
+  mOverflow = false;
 }
 
-// @brief check_equivalent の下請け関数
-bool
-PatMgr::ceq_sub(
-  const PatNode& node1,
-  const PatNode& node2,
-  unordered_map<SizeType, SizeType>& map1,
-  unordered_map<SizeType, SizeType>& map2)
+// @brief パタンから到達できないノードを削除する．
+void
+PatMgr::sweep()
 {
-  if ( node1.is_input() && node2.is_input() ) {
-    auto id1 = node1.input_id();
-    auto id2 = node2.input_id();
-    if ( map1.count(id1) == 0 ) {
-      map1[id1] = id2;
-    }
-    else {
-      auto id2_reg = map1[id1];
-      if ( id2_reg != id2 ) {
-	return false;
-      }
+  auto n = node_num();
+
+  // 入力ノードは常に残す．
+  vector<bool> mark(n, false);
+  for ( auto id: mInputList ) {
+    mark[id] = true;
+  }
+  for ( auto pat: mPatList ) {
+    mark[pat.node_id()] = true;
+  }
+  // ファンインは常にファンアウトより前に作られているので
+  // 後ろからたどればよい．
+  for ( SizeType i = n; i > 0; -- i ) {
+    auto& node = mNodeList[i - 1];
+    if ( mark[i - 1] && !node.is_input() ) {
+      mark[node.fanin0_id()] = true;
+      mark[node.fanin1_id()] = true;
     }
-    if ( map2.count(id2) == 0 ) {
-      map2[id2] = id1;
+  }
+
+  vector<SizeType> id_map(n, BAD_ID);
+  vector<PatNode> new_list;
+  new_list.reserve(n);
+  for ( SizeType id = 0; id < n; ++ id ) {
+    if ( !mark[id] ) {
+      continue;
     }
-    else {
-      auto id1_reg = map2[id1];
-      if ( id1_reg != id1 ) {
-	return false;
-      }
+    auto new_id = new_list.size();
+    id_map[id] = new_id;
+    auto node = mNodeList[id];
+    node.mId = new_id;
+    if ( !node.is_input() ) {
+      node.mFanin[0] = id_map[node.mFanin[0]];
+      node.mFanin[1] = id_map[node.mFanin[1]];
     }
-    return true;
+    new_list.push_back(node);
   }
-
-  if ( (!node1.is_and() || !node2.is_and()) &&
-       (!node1.is_xor() || !node2.is_xor()) ) {
-    return false;
+  if ( new_list.size() == n ) {
+    // 削除するノードはなかった．
+    return;
   }
 
-  if ( node1.fanin_inv0() != node2.fanin_inv0() ||
-       node1.fanin_inv1() != node2.fanin_inv1() ) {
-    return false;
+  mStats.swept_node_num += n - new_list.size();
+  mNodeList.swap(new_list);
+  for ( auto& id: mInputList ) {
+    id = id_map[id];
   }
-
-  if ( !ceq_sub(node1.fanin0(), node2.fanin0(), map1, map2) ) {
-    return false;
+  for ( auto& pat: mPatList ) {
+    pat.set(id_map[pat.node_id()], pat.inv());
   }
 
-  if ( !ceq_sub(node1.fanin1(), node2.fanin1(), map1, map2) ) {
-    return false;
+  // ハッシュ表を作り直す．
+  init_table();
+  for ( SizeType id = 0; id < mNodeList.size(); ++ id ) {
+    if ( !mNodeList[id].is_input() ) {
+      reg_node(id);
+    }
   }
 
-  return true;
+  // ノード番号が変わったので記憶している結果は捨てる．
+  mPgDict.clear();
+  mNewPgKeyList.clear();
+  mShapeIdDict.clear();
+  mNewShapeKeyList.clear();
+}
+
+// @brief パタンの形状番号を返す．
+SizeType
+PatMgr::shape_id(
+  PatHandle handle
+)
+{
+  auto key = handle.key();
+  auto p = mShapeIdDict.find(key);
+  if ( p != mShapeIdDict.end() ) {
+    return p->second;
+  }
+
+  vector<SizeType> sig;
+  sig.push_back(handle.inv() ? 1 : 0);
+  unordered_map<SizeType, SizeType> input_map;
+  shape_sig(mNodeList, mNodeList[handle.node_id()], input_map, sig);
+  auto new_id = mShapeDict.size();
+  auto id = mShapeDict.emplace(sig, new_id).first->second;
+  mShapeIdDict.emplace(key, id);
+  mNewShapeKeyList.push_back(key);
+  return id;
 }
 
 // @brief パタングラフを生成する再帰関数
-void
+const vector<PatHandle>&
 PatMgr::pg_sub(
-  const Expr& expr,
-  vector<PatHandle>& pg_list
+  const Expr& expr
 )
 {
+  // 同じ構造の論理式を処理済みならその結果を返す．
+  // make_node() は構造ハッシュを用いているので再計算しても
+  // 同じ結果になる．
+  auto key = expr_key(expr, false);
+  if ( mMemoize ) {
+    auto p = mPgDict.find(key);
+    if ( p != mPgDict.end() ) {
+      return p->second;
+    }
+  }
+
+  vector<PatHandle> pg_list;
   if ( expr.is_literal() ) {
-    PatNode* node = make_input(expr.varid());
+    auto id = make_input(expr.varid());
     bool inv = expr.is_nega_literal();
-    pg_list.push_back(PatHandle{node, inv});
+    pg_list.push_back(PatHandle{id, inv});
   }
   else {
     auto n = expr.operand_num();
     // ファンインの式に対するパタングラフを求める．
-    vector<vector<PatHandle>> input_pg_list(n);
+    vector<const vector<PatHandle>*> input_pg_list(n);
     vector<pair<int, int>> nk_array(n);
     for ( auto i = 0; i < n; ++ i ) {
-      pg_sub(expr.operand(i), input_pg_list[i]);
-      nk_array[i] = make_pair(input_pg_list[i].size(), 1);
+      input_pg_list[i] = &pg_sub(expr.operand(i));
+      if ( mOverflow ) {
+	return mEmptyList;
+      }
+      nk_array[i] = make_pair(input_pg_list[i]->size(), 1);
     }
 
     // ファンインのパタンの組み合わせを列挙するオブジェクト
-    for ( MultiCombiGen mcg(nk_array); !mcg.is_end(); ++ mcg ) {
+    for ( MultiCombiGen mcg(nk_array); !mcg.is_end() && !mOverflow; ++ mcg ) {
       // 各ファンインから1つずつパタンを取り出して tmp_input に入れる．
       vector<PatHandle> tmp_input(n);
       for ( auto i = 0; i < n; ++ i ) {
-	tmp_input[i] = input_pg_list[i][mcg(i, 0)];
+	tmp_input[i] = (*input_pg_list[i])[mcg(i, 0)];
       }
 
-      // tmp_input のなかで同形なパタンを求める．
-      UnionFindSet ufset(n);
-      for ( int i1 = 1; i1 < n; ++ i1 ) {
-	PatHandle pat1 = tmp_input[i1];
-	for ( int i2 = 0; i2 < i1; ++ i2 ) {
-	  PatHandle pat2 = tmp_input[i2];
-	  if ( check_equivalent(pat1, pat2) ) {
-	    ufset.merge(i1, i2);
-	  }
-	}
-      }
-      vector<SizeType> rep_id;
-      rep_id.reserve(n);
-      vector<SizeType> rev_map(n);
+      // tmp_input のなかで同形なパタンをまとめる．
+      // group_list[0〜(ng - 1)] に同形なパタンのリストを
+      // 最初に現れた順に格納する．
+      vector<vector<SizeType>> group_list;
+      unordered_map<SizeType, SizeType> group_map;
       for ( auto i = 0; i < n; ++ i ) {
-	auto x = ufset.find(i);
-	if ( x == i ) {
-	  rev_map[i] = rep_id.size();
-	  rep_id.push_back(x);
+	auto sid = shape_id(tmp_input[i]);
+	if ( group_map.count(sid) == 0 ) {
+	  group_map.emplace(sid, group_list.size());
+	  group_list.push_back({});
 	}
+	group_list[group_map.at(sid)].push_back(i);
       }
-      auto ng = rep_id.size();
-
-      // group_list[0〜(ng - 1)] に同形なパタンのリストを格納する．
-      vector<vector<SizeType> > group_list(ng);
-      for ( auto i = 0; i < n; ++ i ) {
-	auto x = ufset.find(i);
-	auto id = rev_map[x];
-	group_list[id].push_back(i);
-      }
+      auto ng = group_list.size();
 
       vector<SizeType> num_array(ng);
       for ( SizeType g = 0; g < ng; ++ g ) {
@@ -346,7 +473,8 @@ PatMgr::pg_sub(
       }
 
       vector<PatHandle> input(n);
-      for ( MultiSetPermGen mspg(num_array, n); !mspg.is_end(); ++ mspg ) {
+      for ( MultiSetPermGen mspg(num_array, n);
+	    !mspg.is_end() && !mOverflow; ++ mspg ) {
 	vector<SizeType> count(ng, 0);
 	for ( SizeType i = 0; i < n; ++ i ) {
 	  auto g = mspg(i);
@@ -416,6 +544,19 @@ PatMgr::pg_sub(
       }
     }
   }
+
+  if ( mOverflow ) {
+    // 途中で打ち切ったので結果は記憶しない．
+    return mEmptyList;
+  }
+
+  if ( !mMemoize ) {
+    mPgList.push_back(std::move(pg_list));
+    return mPgList.back();
+  }
+  auto q = mPgDict.emplace(key, std::move(pg_list));
+  mNewPgKeyList.push_back(key);
+  return q.first->second;
 }
 
 // @brief テンプレートにしたがって2分木を作る．
@@ -442,21 +583,18 @@ PatMgr::make_bintree(
 }
 
 // @brief 入力ノードを作る．
-PatNode*
+SizeType
 PatMgr::make_input(
   SizeType var
 )
 {
   while ( mInputList.size() <= var ) {
-    auto node = new_node();
+    auto id = new_node();
     auto input_id = mInputList.size();
-    node->mType = (input_id << 2) | PatNode::INPUT;
-    mInputList.push_back(node);
+    mNodeList[id].mType = (input_id << 2) | PatNode::INPUT;
+    mInputList.push_back(id);
   }
-  auto node = mInputList[var];
-  ASSERT_COND( node != nullptr );
-
-  return node;
+  return mInputList[var];
 }
 
 // @brief 論理式の種類に応じてノードを作る．
@@ -467,8 +605,8 @@ PatMgr::make_node(
   PatHandle r_handle
 )
 {
-  auto& l_node = l_handle.node();
-  auto& r_node = r_handle.node();
+  auto l_id = l_handle.node_id();
+  auto r_id = r_handle.node_id();
   bool l_inv = l_handle.inv();
   bool r_inv = r_handle.inv();
 
@@ -499,91 +637,198 @@ PatMgr::make_node(
     type |= 8U;
   }
 
-  // (type, l_node, r_node) というノードがすでにあったらそれを使う．
-  SizeType pos = hash_func(type, l_node, r_node);
-  SizeType idx = pos % mHashSize;
-  for ( auto node = mHashTable[idx]; node; node = node->mLink ) {
-    if ( node->mType == type &&
-	 &node->fanin0() == &l_node &&
-	 &node->fanin1() == &r_node ) {
-      // おなじノードがあった．
-      return PatHandle{node, oinv};
+  // (type, l_id, r_id) というノードがすでにあったらそれを使う．
+  auto id = find_node(type, l_id, r_id);
+  if ( id == BAD_ID ) {
+    if ( mParam.max_node_num > 0 && node_num() >= mParam.max_node_num ) {
+      // ノード数の制限を超えた．
+      // 結果は捨てられるのでダミーのハンドルを返す．
+      mOverflow = true;
+      return PatHandle{};
     }
-  }
 
-  // 新しいノードを作る．
-  auto node = new_node();
-  node->mType = type;
-  node->mFanin[0] = &l_node;
-  node->mFanin[1] = &r_node;
+    // 新しいノードを作る．
+    id = new_node();
+    auto& node = mNodeList[id];
+    node.mType = type;
+    node.mFanin[0] = l_id;
+    node.mFanin[1] = r_id;
 
-  // ハッシュ表に登録する．
-  if ( node_num() >= mNextLimit ) {
-    alloc_table(mHashSize * 2);
-    // サイズが変わったのでインデックスを再計算する．
-    idx = pos % mHashSize;
+    // ハッシュ表に登録する．
+    reg_node(id);
   }
-  node->mLink = mHashTable[idx];
-  mHashTable[idx] = node;
 
-  return PatHandle{node, oinv};
+  return PatHandle{id, oinv};
 }
 
 // @brief ノードを作る．
-PatNode*
+SizeType
 PatMgr::new_node()
 {
   auto id = mNodeList.size();
-  auto node = new PatNode{id};
-  mNodeList.push_back(unique_ptr<PatNode>{node});
-  return node;
+  // PatHandle は反転属性と合わせて32ビットに詰めるので
+  // ノード番号は31ビットに収まらなければならない．
+  if ( id >= (1U << 31) ) {
+    throw std::overflow_error{"too many pattern nodes"};
+  }
+  mNodeList.push_back(PatNode{id});
+  return id;
 }
 
-// @brief ハッシュ表を確保する．
+// @brief ハッシュ表を初期化する．
 void
-PatMgr::alloc_table(
-  SizeType req_size
+PatMgr::init_table()
+{
+  mHashTable.clear();
+  mHashTable.resize(1024, BAD_ID);
+  mOldTable.clear();
+  mMovePos = 0;
+  mHashNum = 0;
+  mNextLimit = static_cast<SizeType>(mHashTable.size() * mMaxLoad);
+}
+
+// @brief (type, l_id, r_id) のノードを探す．
+SizeType
+PatMgr::find_node(
+  SizeType type,
+  SizeType l_id,
+  SizeType r_id
+) const
+{
+  auto pos = hash_func(type, l_id, r_id);
+  // 再ハッシュ中は新しい表になければ古い表を探す．
+  for ( auto table_p: {&mHashTable, &mOldTable} ) {
+    auto& table = *table_p;
+    if ( table.empty() ) {
+      continue;
+    }
+    SizeType mask = table.size() - 1;
+    for ( SizeType idx = pos & mask; table[idx] != BAD_ID;
+	  idx = (idx + 1) & mask ) {
+      auto& node = mNodeList[table[idx]];
+      if ( node.mType == type &&
+	   node.mFanin[0] == l_id &&
+	   node.mFanin[1] == r_id ) {
+	// おなじノードがあった．
+	return table[idx];
+      }
+    }
+  }
+  return BAD_ID;
+}
+
+// @brief ノードをハッシュ表に登録する．
+void
+PatMgr::reg_node(
+  SizeType id
+)
+{
+  if ( mHashNum >= mNextLimit ) {
+    // 前回の移動が終わっていなければ先に全て移す．
+    move_entries(mOldTable.size());
+    // 表を拡大する．
+    // 古い表の要素は以降の登録のたびに少しずつ移す．
+    SizeType new_size = mHashTable.size() * 2;
+    while ( static_cast<SizeType>(new_size * mMaxLoad) <= mHashNum ) {
+      new_size *= 2;
+    }
+    mOldTable.swap(mHashTable);
+    mHashTable.clear();
+    mHashTable.resize(new_size, BAD_ID);
+    mMovePos = 0;
+    mNextLimit = static_cast<SizeType>(new_size * mMaxLoad);
+  }
+  insert_node(mHashTable, id);
+  ++ mHashNum;
+  move_entries(16);
+}
+
+// @brief table にノードを挿入する．
+void
+PatMgr::insert_node(
+  vector<std::uint32_t>& table,
+  SizeType id
+)
+{
+  auto& node = mNodeList[id];
+  SizeType mask = table.size() - 1;
+  auto idx = hash_func(node.mType, node.mFanin[0], node.mFanin[1]) & mask;
+  while ( table[idx] != BAD_ID ) {
+    idx = (idx + 1) & mask;
+  }
+  table[idx] = id;
+}
+
+// @brief ハッシュ表からノードを削除する．
+void
+PatMgr::remove_node(
+  SizeType id
 )
 {
-  auto old_table = mHashTable;
-  auto old_size = mHashSize;
-
-  if ( mHashSize == 0 ) {
-    mHashSize = 1024;
-  }
-  while ( mHashSize < req_size ) {
-    mHashSize <<= 1;
-  }
-  mNextLimit = static_cast<SizeType>(mHashSize * 1.8);
-  mHashTable = new PatNode*[mHashSize];
-  for ( SizeType i = 0; i < mHashSize; ++ i) {
-    mHashTable[i] = nullptr;
-  }
-  for ( SizeType i = 0; i < old_size; ++ i ) {
-    PatNode* next = nullptr;
-    for ( auto node = old_table[i]; node; node = next ) {
-      next = node->mLink;
-      auto pos = hash_func(node->mType, node->fanin0(), node->fanin1());
-      auto idx = pos % mHashSize;
-      node->mLink = mHashTable[idx];
-      mHashTable[idx] = node;
+  ASSERT_COND( mOldTable.empty() );
+
+  auto& node = mNodeList[id];
+  SizeType mask = mHashTable.size() - 1;
+  auto idx = hash_func(node.mType, node.mFanin[0], node.mFanin[1]) & mask;
+  while ( mHashTable[idx] != id ) {
+    ASSERT_COND( mHashTable[idx] != BAD_ID );
+    idx = (idx + 1) & mask;
+  }
+  mHashTable[idx] = BAD_ID;
+  -- mHashNum;
+
+  // 後ろに続く要素のうち，本来の位置から見て空いたスロットを
+  // 越えているものを空いたスロットに詰める．
+  for ( auto idx2 = (idx + 1) & mask; mHashTable[idx2] != BAD_ID;
+	idx2 = (idx2 + 1) & mask ) {
+    auto& node2 = mNodeList[mHashTable[idx2]];
+    auto home = hash_func(node2.mType, node2.mFanin[0], node2.mFanin[1]) & mask;
+    // home から idx2 までの距離が idx から idx2 までの距離以上なら
+    // idx に移しても探索の鎖は切れない．
+    if ( ((idx2 - home) & mask) >= ((idx2 - idx) & mask) ) {
+      mHashTable[idx] = mHashTable[idx2];
+      mHashTable[idx2] = BAD_ID;
+      idx = idx2;
     }
   }
-  delete [] old_table;
+}
 
+// @brief 古いハッシュ表の要素を新しい表に移す．
+void
+PatMgr::move_entries(
+  SizeType num
+)
+{
+  if ( mOldTable.empty() ) {
+    return;
+  }
+  auto end = std::min<SizeType>(mMovePos + num, mOldTable.size());
+  for ( ; mMovePos < end; ++ mMovePos ) {
+    // 移した要素は古い表にも残しておく．
+    // (線形探索の鎖を切らないため)
+    auto id = mOldTable[mMovePos];
+    if ( id != BAD_ID ) {
+      insert_node(mHashTable, id);
+    }
+  }
+  if ( mMovePos == mOldTable.size() ) {
+    mOldTable.clear();
+    mOldTable.shrink_to_fit();
+    mMovePos = 0;
+  }
 }
 
 // @brief PatNode のハッシュ関数
 SizeType
 PatMgr::hash_func(
   SizeType type,
-  const PatNode& l_node,
-  const PatNode& r_node)
+  SizeType l_id,
+  SizeType r_id
+)
 {
-  PtrIntType l = reinterpret_cast<PtrIntType>(&l_node);
-  PtrIntType r = reinterpret_cast<PtrIntType>(&r_node);
-
-  return type + l * 5 + r;
+  SizeType h = type + l_id * 1021 + r_id * 65537;
+  h *= 0x9E3779B1U;
+  return h ^ (h >> 16);
 }
 
 
@@ -593,7 +838,8 @@ BEGIN_NONAMESPACE
 // @return 最大入力番号+1を返す．
 SizeType
 dfs(
-  const PatNode& node,     ///< [in] ノード
+  const vector<PatNode>& node_list, ///< [in] ノードのリスト
+  const PatNode& node,       ///< [in] ノード
   vector<bool>& vmark,       ///< [in] 訪れたかどうかの情報を持つ配列
   vector<SizeType>& val_list ///< [in] ノードの情報を格納するリスト
 )
@@ -606,9 +852,9 @@ dfs(
   }
   vmark[node.id()] = true;
   val_list.push_back(node.id() * 2);
-  auto id = dfs(node.fanin(0), vmark, val_list);
+  auto id = dfs(node_list, node_list[node.fanin0_id()], vmark, val_list);
   val_list.push_back(node.id() * 2 + 1);
-  auto id1 = dfs(node.fanin(1), vmark, val_list);
+  auto id1 = dfs(node_list, node_list[node.fanin1_id()], vmark, val_list);
   if ( id < id1 ) {
     id = id1;
   }
@@ -633,7 +879,7 @@ PatMgr::get_pat_info(
   node_list.clear();
   node_list.reserve(node_num());
   vector<bool> vmark(node_num(), false);
-  auto max_input = dfs(root.node(), vmark, node_list);
+  auto max_input = dfs(mNodeList, mNodeList[root.node_id()], vmark, node_list);
   input_num = max_input << 1;
   if ( root.inv() ) {
     input_num |= 1U;
@@ -697,7 +943,7 @@ PatMgr::display(
       class_map.emplace(rep, class_id);
       ++ class_id;
   }
-    s << "Node#" << root.node().id()
+    s << "Node#" << root.node_id()
       << " --> Rep#" << class_map.at(rep)
       << endl;
   }
@@ -714,7 +960,7 @@ PatMgr::display_edge(
   if ( node.fanin_inv(fanin_pos) ) {
     s << "~";
   }
-  s << "Node#" << node.fanin(fanin_pos).id();
+  s << "Node#" << node.fanin_id(fanin_pos);
 }
 
 END_NAMESPACE_YM_CLIB
@@ -0,0 +1,195 @@
+
+/// @file PatMgr_test.cc
+/// @brief PatMgr_test の実装ファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2024 Yusuke Matsunaga
+/// All rights reserved.
+
+#include "gtest/gtest.h"
+#include "cgmgr/PatMgr.h"
+#include "ym/Expr.h"
+
+
+BEGIN_NAMESPACE_YM_CLIB
+
+BEGIN_NONAMESPACE
+
+// テスト用の論理式を作る．
+vector<Expr>
+make_expr_list()
+{
+  vector<Expr> expr_list;
+  auto a = Expr::posi_literal(0);
+  auto b = Expr::posi_literal(1);
+  auto c = Expr::posi_literal(2);
+  auto d = Expr::posi_literal(3);
+  auto e = Expr::posi_literal(4);
+  expr_list.push_back(a & b & c & d);
+  expr_list.push_back(a | b | c | d | e);
+  expr_list.push_back(a ^ b ^ c ^ d ^ e);
+  expr_list.push_back((a & ~c) | (b & c));
+  expr_list.push_back(~(a & b) | (c & d & e));
+  // 共通の部分論理式を持つ
+  expr_list.push_back(((a & b) | c) & ((a & b) | d));
+  return expr_list;
+}
+
+// PatMgr の内容を文字列にする．
+string
+pat_str(
+  PatMgr& mgr,
+  double max_load,
+  const ClibPatGenParam& param = ClibPatGenParam{}
+)
+{
+  mgr.init();
+  mgr.set_max_load(max_load);
+  mgr.set_param(param);
+  // クラスは区別できればよいのでダミーのアドレスを用いる．
+  auto expr_list = make_expr_list();
+  for ( SizeType i = 0; i < expr_list.size(); ++ i ) {
+    auto rep = reinterpret_cast<const CiCellClass*>(i + 1);
+    mgr.reg_pat(expr_list[i], rep);
+  }
+  ostringstream buf;
+  mgr.display(buf);
+  return buf.str();
+}
+
+END_NONAMESPACE
+
+TEST(PatMgrTest, load_factor)
+{
+  // 負荷率を変えても同じノード番号と同じパタンが得られる．
+  PatMgr mgr;
+  auto ref_str = pat_str(mgr, 0.5);
+  // 表の拡大が何度も起こるような小さな負荷率
+  EXPECT_EQ( ref_str, pat_str(mgr, 0.01) );
+  EXPECT_EQ( ref_str, pat_str(mgr, 0.9) );
+}
+
+TEST(PatMgrTest, no_duplicate)
+{
+  PatMgr mgr{0.05};
+  auto expr_list = make_expr_list();
+  for ( SizeType i = 0; i < expr_list.size(); ++ i ) {
+    auto rep = reinterpret_cast<const CiCellClass*>(i + 1);
+    mgr.reg_pat(expr_list[i], rep);
+  }
+  // 構造ハッシュが効いていれば同じ (種類, ファンイン) のノードは
+  // 1つしかない．
+  std::set<std::tuple<bool, SizeType, bool, SizeType, bool>> node_set;
+  for ( SizeType i = 0; i < mgr.node_num(); ++ i ) {
+    auto& node = mgr.node(i);
+    EXPECT_EQ( i, node.id() );
+    if ( node.is_input() ) {
+      continue;
+    }
+    auto key = std::make_tuple(node.is_and(),
+			       node.fanin0_id(), node.fanin_inv0(),
+			       node.fanin1_id(), node.fanin_inv1());
+    EXPECT_EQ( 0, node_set.count(key) );
+    node_set.insert(key);
+  }
+}
+
+TEST(PatMgrTest, memoize)
+{
+  // pg_sub() の結果を記憶しても記憶しなくても同じ結果になる．
+  PatMgr mgr;
+  auto ref_str = pat_str(mgr, 0.5);
+  mgr.set_memoize(false);
+  EXPECT_EQ( ref_str, pat_str(mgr, 0.5) );
+  auto stats = mgr.stats();
+  mgr.set_memoize(true);
+  pat_str(mgr, 0.5);
+  EXPECT_EQ( stats.pat_num, mgr.stats().pat_num );
+  EXPECT_EQ( stats.node_num, mgr.stats().node_num );
+}
+
+TEST(PatMgrTest, isomorphic)
+{
+  auto a = Expr::posi_literal(0);
+  auto b = Expr::posi_literal(1);
+  auto c = Expr::posi_literal(2);
+  auto d = Expr::posi_literal(3);
+  auto e = Expr::posi_literal(4);
+  auto f = Expr::posi_literal(5);
+  auto rep1 = reinterpret_cast<const CiCellClass*>(1);
+  auto rep2 = reinterpret_cast<const CiCellClass*>(2);
+  auto rep3 = reinterpret_cast<const CiCellClass*>(3);
+
+  PatMgr mgr;
+  mgr.reg_pat((a & b) | c, rep1);
+  auto node_num1 = mgr.node_num();
+  auto pat_num1 = mgr.pat_num();
+  ASSERT_TRUE( pat_num1 > 0 );
+
+  // オペランドの順番だけが異なる論理式はノードを増やさない．
+  mgr.reg_pat(c | (b & a), rep2);
+  EXPECT_EQ( node_num1, mgr.node_num() );
+  auto pat_num2 = mgr.pat_num();
+
+  // 変数だけが異なる論理式は同じ形のパタンを同じ順番で作る．
+  mgr.reg_pat((d & e) | f, rep3);
+  EXPECT_TRUE( node_num1 < mgr.node_num() );
+  ASSERT_EQ( pat_num2 + pat_num1, mgr.pat_num() );
+  for ( SizeType i = 0; i < pat_num1; ++ i ) {
+    EXPECT_EQ( rep1, mgr.rep_class(i) );
+    EXPECT_EQ( rep3, mgr.rep_class(pat_num2 + i) );
+    auto sid1 = mgr.shape_id(mgr.pat_root(i));
+    auto sid3 = mgr.shape_id(mgr.pat_root(pat_num2 + i));
+    EXPECT_EQ( sid1, sid3 );
+  }
+
+  // 形の異なるパタンは異なる形状番号を持つ．
+  mgr.reg_pat(a & b, rep1);
+  auto last = mgr.pat_num() - 1;
+  EXPECT_EQ( rep1, mgr.rep_class(last) );
+  EXPECT_TRUE( mgr.shape_id(mgr.pat_root(last)) !=
+	       mgr.shape_id(mgr.pat_root(0)) );
+}
+
+TEST(PatMgrTest, node_limit)
+{
+  PatMgr mgr;
+  pat_str(mgr, 0.5);
+  auto full_node_num = mgr.node_num();
+
+  // 途中の論理式で制限を超えるようにする．
+  ClibPatGenParam param;
+  param.max_node_num = full_node_num / 2;
+  auto ref_str = pat_str(mgr, 0.5, param);
+  EXPECT_TRUE( mgr.node_num() <= param.max_node_num );
+  EXPECT_TRUE( mgr.stats().node_pruned_expr_num > 0 );
+
+  // 取り除いたノードのハッシュ表の要素が正しく削除されていれば
+  // 再ハッシュの起こり方によらず同じ結果になる．
+  EXPECT_EQ( ref_str, pat_str(mgr, 0.01, param) );
+  EXPECT_EQ( ref_str, pat_str(mgr, 0.9, param) );
+
+  // 制限を超えた論理式を取り除いた後も構造ハッシュは正しく働く．
+  std::set<std::tuple<bool, SizeType, bool, SizeType, bool>> node_set;
+  for ( SizeType i = 0; i < mgr.node_num(); ++ i ) {
+    auto& node = mgr.node(i);
+    EXPECT_EQ( i, node.id() );
+    if ( node.is_input() ) {
+      continue;
+    }
+    auto key = std::make_tuple(node.is_and(),
+			       node.fanin0_id(), node.fanin_inv0(),
+			       node.fanin1_id(), node.fanin_inv1());
+    EXPECT_EQ( 0, node_set.count(key) );
+    node_set.insert(key);
+  }
+}
+
+TEST(PatMgrTest, bad_max_load)
+{
+  PatMgr mgr;
+  EXPECT_THROW( mgr.set_max_load(0.0), std::invalid_argument );
+  EXPECT_THROW( mgr.set_max_load(1.0), std::invalid_argument );
+}
+
+END_NAMESPACE_YM_CLIB
@@ -24,6 +24,8 @@ CiBus::serialize(
 ) const
 {
   s.reg_obj(this);
+  // バスタイプも登録しておく．
+  s.reg_obj(mBusType);
 }
 
 // @brief 内容をバイナリダンプする．
@@ -166,14 +166,48 @@ CiCell::data_in_expr() const
 // @brief 名前からピンの取得
 const CiPin*
 CiCell::find_pin(
-  const ShString& name
+  std::string_view name
 ) const
 {
-  auto lib = library();
-  if ( lib != nullptr ) {
-    return lib->find_pin(this, name);
+  auto p = std::lower_bound(mPinTable.begin(), mPinTable.end(), name,
+			    [](const pair<std::string_view, SizeType>& a,
+			       std::string_view b) {
+			      return a.first < b;
+			    });
+  if ( p == mPinTable.end() || p->first != name ) {
+    return nullptr;
   }
-  return nullptr;
+  return mPinList[p->second].get();
+}
+
+// @brief 名前のリストからピン番号のリストを得る．
+vector<SizeType>
+CiCell::pin_id_list(
+  const vector<string>& name_list
+) const
+{
+  vector<SizeType> ans;
+  ans.reserve(name_list.size());
+  for ( auto& name: name_list ) {
+    auto pin = find_pin(std::string_view{name});
+    ans.push_back(pin != nullptr ? pin->pin_id() : CLIB_NULLID);
+  }
+  return ans;
+}
+
+// @brief ピン名の表を作る．
+void
+CiCell::make_pin_table()
+{
+  mPinTable.clear();
+  mPinTable.reserve(mPinList.size());
+  for ( auto& pin: mPinList ) {
+    // ShString の文字列は解放されないので参照してよい．
+    auto name = pin->_name();
+    mPinTable.push_back(make_pair(std::string_view{static_cast<const char*>(name)},
+				  pin->pin_id()));
+  }
+  std::sort(mPinTable.begin(), mPinTable.end());
 }
 
 // @brief 名前からバスの取得
@@ -492,6 +526,26 @@ CiCell::set_timing(
   mTimingMap[base] = timing_list;
 }
 
+// @brief 内部電力を追加する．
+CiInternalPower*
+CiCell::add_internal_power(
+  const CiPin* pin,
+  const CiPin* related_pin,
+  const Expr& when,
+  unique_ptr<CiLut>&& rise_power,
+  unique_ptr<CiLut>&& fall_power
+)
+{
+  auto ptr = unique_ptr<CiInternalPower>{
+    new CiInternalPower{pin, related_pin, when,
+			std::move(rise_power),
+			std::move(fall_power)}
+  };
+  auto power = ptr.get();
+  mInternalPowerList.push_back(std::move(ptr));
+  return power;
+}
+
 // @brief シグネチャを返す．
 CgSignature
 CiCell::make_signature() const
@@ -549,6 +603,9 @@ CiCell::serialize(
   for ( auto& timing: mTimingList ) {
     timing->serialize(s);
   }
+  for ( auto& power: mInternalPowerList ) {
+    power->serialize(s);
+  }
 }
 
 // @brief 共通部分のダンプ
@@ -573,6 +630,10 @@ CiCell::dump_common(
   for ( auto& timing_list: mTimingMap ) {
     s.dump(timing_list);
   }
+  s.dump(mInternalPowerList);
+  s.dump(mCellLeakagePower);
+  s.dump(mLeakagePowerWhenList);
+  s.dump(mLeakagePowerValueList);
 }
 
 // @brief 内容を読み込む．
@@ -633,6 +694,28 @@ CiCell::restore_common(
 
   // タイミングマップ
   s.restore(mTimingMap);
+
+  // 内部電力のリスト
+  s.restore(mInternalPowerList);
+
+  // リーク電力
+  s.restore(mCellLeakagePower);
+  s.restore(mLeakagePowerWhenList);
+  s.restore(mLeakagePowerValueList);
+  // 評価用の表は CiCellLibrary::wrap_up() で作る．
+}
+
+// @brief リーク電力の評価用の表を作る．
+void
+CiCell::build_leakage_table()
+{
+  // 条件式が内部状態変数を参照している場合もある．
+  SizeType ni = input2_num();
+  for ( auto& when: mLeakagePowerWhenList ) {
+    ni = std::max(ni, when.input_size());
+  }
+  mLeakageTable.build(ni, mCellLeakagePower,
+		      mLeakagePowerWhenList, mLeakagePowerValueList);
 }
 
 END_NAMESPACE_YM_CLIB
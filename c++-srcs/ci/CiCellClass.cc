@@ -8,6 +8,7 @@
 
 #include "ci/CiCellClass.h"
 #include "ci/CiCellGroup.h"
+#include "ci/CiCell.h"
 #include "ci/Serializer.h"
 #include "ci/Deserializer.h"
 #include "ym/Range.h"
@@ -19,6 +20,38 @@ BEGIN_NAMESPACE_YM_CLIB
 // クラス CiCellClass
 //////////////////////////////////////////////////////////////////////
 
+// @brief 指定された基準で一つ後ろのセルを返す．
+const CiCell*
+CiCellClass::next_cell(
+  const CiCell* cell,
+  ClibCellOrder order
+) const
+{
+  auto& cell_list = sorted_cell_list(order);
+  auto pos = cell->class_order_pos(order);
+  ASSERT_COND( pos < cell_list.size() && cell_list[pos] == cell );
+  if ( pos + 1 < cell_list.size() ) {
+    return cell_list[pos + 1];
+  }
+  return nullptr;
+}
+
+// @brief 指定された基準で一つ前のセルを返す．
+const CiCell*
+CiCellClass::prev_cell(
+  const CiCell* cell,
+  ClibCellOrder order
+) const
+{
+  auto& cell_list = sorted_cell_list(order);
+  auto pos = cell->class_order_pos(order);
+  ASSERT_COND( pos < cell_list.size() && cell_list[pos] == cell );
+  if ( pos > 0 ) {
+    return cell_list[pos - 1];
+  }
+  return nullptr;
+}
+
 // @brief 内容をシリアライズする．
 void
 CiCellClass::serialize(
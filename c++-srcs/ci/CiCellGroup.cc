@@ -40,6 +40,38 @@ CiCellGroup::seq_attr() const
   return mRepClass->seq_attr();
 }
 
+// @brief 指定された基準で一つ後ろのセルを返す．
+const CiCell*
+CiCellGroup::next_cell(
+  const CiCell* cell,
+  ClibCellOrder order
+) const
+{
+  auto& cell_list = sorted_cell_list(order);
+  auto pos = cell->group_order_pos(order);
+  ASSERT_COND( pos < cell_list.size() && cell_list[pos] == cell );
+  if ( pos + 1 < cell_list.size() ) {
+    return cell_list[pos + 1];
+  }
+  return nullptr;
+}
+
+// @brief 指定された基準で一つ前のセルを返す．
+const CiCell*
+CiCellGroup::prev_cell(
+  const CiCell* cell,
+  ClibCellOrder order
+) const
+{
+  auto& cell_list = sorted_cell_list(order);
+  auto pos = cell->group_order_pos(order);
+  ASSERT_COND( pos < cell_list.size() && cell_list[pos] == cell );
+  if ( pos > 0 ) {
+    return cell_list[pos - 1];
+  }
+  return nullptr;
+}
+
 // @brief 内容をシリアライズする．
 void
 CiCellGroup::serialize(
@@ -17,18 +17,147 @@
 #include "ci/CiLutTemplate.h"
 #include "ci/CiLut.h"
 #include "ci/CiBusType.h"
+#include "ci/CiWireLoad.h"
+#include "ci/CiWireLoadSelection.h"
 #include "ci/CiPatGraph.h"
+#include "ci/CiLoadProfiler.h"
 #include "ci/CiCell.h"
 #include "cgmgr/CgMgr.h"
 #include "cgmgr/CgSignature.h"
 #include "cgmgr/PatMgr.h"
 #include "cgmgr/PatNode.h"
+#include "ym/ClibIOMap.h"
 #include "ym/ClibSeqAttr.h"
 #include "ym/Range.h"
 
 
 BEGIN_NAMESPACE_YM_CLIB
 
+BEGIN_NONAMESPACE
+
+// 遅延テーブルの負荷容量に対する傾きを求める．
+//
+// 負荷容量の変数を持たないテーブルの場合は 0.0 を返す．
+// 他の変数は最初のインデックスの値に固定する．
+double
+load_slope(
+  const CiLut* lut
+)
+{
+  if ( lut == nullptr || lut->lut_template() == nullptr ) {
+    return 0.0;
+  }
+  auto tmpl = lut->lut_template();
+  auto d = lut->dimension();
+  for ( SizeType var = 0; var < d; ++ var ) {
+    if ( tmpl->variable_type(var) != ClibVarType::total_output_net_capacitance ) {
+      continue;
+    }
+    auto n = lut->index_num(var);
+    if ( n < 2 ) {
+      return 0.0;
+    }
+    auto dx = lut->index(var, n - 1) - lut->index(var, 0);
+    if ( dx <= 0.0 ) {
+      return 0.0;
+    }
+    vector<SizeType> pos_array(d, 0);
+    auto y0 = lut->grid_value(pos_array);
+    pos_array[var] = n - 1;
+    auto y1 = lut->grid_value(pos_array);
+    return (y1 - y0) / dx;
+  }
+  return 0.0;
+}
+
+// タイミングの駆動抵抗を求める．
+//
+// 非線形遅延モデルでは rise_resistance/fall_resistance が
+// 定義されていないので，遅延テーブルの負荷容量に対する傾きを
+// 実効的な駆動抵抗として用いる．
+double
+drive_resistance(
+  const CiTiming* timing
+)
+{
+  auto ans = std::max(timing->rise_resistance().value(),
+		      timing->fall_resistance().value());
+  if ( ans > 0.0 ) {
+    return ans;
+  }
+  ans = std::max(load_slope(timing->cell_rise()),
+		 load_slope(timing->cell_fall()));
+  if ( ans > 0.0 ) {
+    return ans;
+  }
+  return std::max(load_slope(timing->rise_propagation()),
+		  load_slope(timing->fall_propagation()));
+}
+
+// セルを並べる基準となる値を求める．
+double
+order_value(
+  const CiCell* cell,
+  ClibCellOrder order
+)
+{
+  double ans = 0.0;
+  switch ( order ) {
+  case ClibCellOrder::Area:
+    ans = cell->area().value();
+    break;
+
+  case ClibCellOrder::InputCapacitance:
+    for ( auto pin: cell->input_list() ) {
+      ans = std::max(ans, pin->capacitance().value());
+    }
+    break;
+
+  case ClibCellOrder::DriveResistance:
+    for ( SizeType opos = 0; opos < cell->output2_num(); ++ opos ) {
+      for ( SizeType ipos = 0; ipos < cell->input2_num(); ++ ipos ) {
+	for ( auto sense: { ClibTimingSense::positive_unate,
+			    ClibTimingSense::negative_unate } ) {
+	  for ( auto timing: cell->timing_list(ipos, opos, sense) ) {
+	    ans = std::max(ans, drive_resistance(timing));
+	  }
+	}
+      }
+    }
+    break;
+  }
+  return ans;
+}
+
+// セルのリストを order の基準で昇順に並べる．
+//
+// 値が等しいセルは元の順番を保つ．
+vector<const CiCell*>
+sort_cells(
+  const vector<const CiCell*>& cell_list,
+  ClibCellOrder order
+)
+{
+  vector<pair<double, const CiCell*>> tmp_list;
+  tmp_list.reserve(cell_list.size());
+  for ( auto cell: cell_list ) {
+    tmp_list.push_back(make_pair(order_value(cell, order), cell));
+  }
+  std::stable_sort(tmp_list.begin(), tmp_list.end(),
+		   [](const pair<double, const CiCell*>& a,
+		      const pair<double, const CiCell*>& b) {
+		     return a.first < b.first;
+		   });
+  vector<const CiCell*> ans;
+  ans.reserve(tmp_list.size());
+  for ( auto& p: tmp_list ) {
+    ans.push_back(p.second);
+  }
+  return ans;
+}
+
+END_NONAMESPACE
+
 //////////////////////////////////////////////////////////////////////
 // クラス CiCellLibrary
 //////////////////////////////////////////////////////////////////////
@@ -43,6 +172,14 @@ CiCellLibrary::~CiCellLibrary()
 {
 }
 
+// @brief 読み込み処理の排他制御に用いる mutex を返す．
+std::mutex&
+CiCellLibrary::reader_mutex()
+{
+  static std::mutex mtx;
+  return mtx;
+}
+
 // @brief 参照回数を増やす．
 void
 CiCellLibrary::inc_ref() const
@@ -54,8 +191,7 @@ CiCellLibrary::inc_ref() const
 void
 CiCellLibrary::dec_ref() const
 {
-  -- mRefCount;
-  if ( mRefCount == 0 ) {
+  if ( -- mRefCount == 0 ) {
     // 自殺する．
     delete this;
   }
@@ -87,6 +223,28 @@ CiCellLibrary::find_latch_class(
   return {};
 }
 
+// @brief 論理関数と NPN 同値なセルクラスを返す．
+const CiCellClass*
+CiCellLibrary::find_logic_class(
+  const TvFunc& func,
+  ClibIOMap& iomap
+) const
+{
+  if ( func.is_invalid() ) {
+    return nullptr;
+  }
+  auto ni = func.input_num();
+  auto sig = CgSignature::make_logic_sig(ni, 1, 0, {func}, {TvFunc::invalid()});
+  auto rep_map = sig.rep_map();
+  auto rep_sig = sig.xform(rep_map);
+  auto p = mLogicClassDict.find(rep_sig.str());
+  if ( p == mLogicClassDict.end() ) {
+    return nullptr;
+  }
+  iomap = rep_map;
+  return p->second;
+}
+
 // @brief 属性を設定する(浮動小数点型)
 void
 CiCellLibrary::set_attr(
@@ -97,10 +255,17 @@ CiCellLibrary::set_attr(
   if ( attr_name == "em_temp_degradation_factor" ) {
   }
   else if ( attr_name == "nom_process" ) {
+    mNomProcess = value;
   }
   else if ( attr_name == "nom_temperature" ) {
+    mNomTemperature = value;
   }
   else if ( attr_name == "nom_voltage" ) {
+    mNomVoltage = value;
+  }
+  else if ( attr_name.compare(0, 2, "k_") == 0 ) {
+    // k_process_XXX/k_temp_XXX/k_volt_XXX
+    mKFactorDict[attr_name] = value;
   }
   else if ( attr_name == "default_cell_leakage_power" ) {
   }
@@ -147,10 +312,13 @@ CiCellLibrary::set_attr(
   else if ( attr_name == "default_slope_rise" ) {
   }
   else if ( attr_name == "default_wire_load_area" ) {
+    mDefaultWireLoadArea = value;
   }
   else if ( attr_name == "default_wire_load_capacitance" ) {
+    mDefaultWireLoadCapacitance = value;
   }
   else if ( attr_name == "default_wire_load_resistance" ) {
+    mDefaultWireLoadResistance = value;
   }
 }
 
@@ -188,6 +356,142 @@ CiCellLibrary::set_attr(
   else if ( attr_name == "leakage_power_unit" ) {
     mLeakagePowerUnit = value;
   }
+  else if ( attr_name == "default_wire_load" ) {
+    mDefaultWireLoadName = value;
+  }
+  else if ( attr_name == "default_wire_load_selection" ) {
+    mDefaultWireLoadSelectionName = value;
+  }
+  else if ( attr_name == "default_wire_load_mode" ) {
+    mDefaultWireLoadMode = value;
+  }
+  else if ( attr_name == "default_operating_conditions" ) {
+    mDefaultOperatingConditionsName = value;
+  }
+}
+
+// @brief 名前から動作条件を取得する．
+const CiOperatingConditions*
+CiCellLibrary::operating_conditions(
+  std::string_view name
+) const
+{
+  string name_str{name};
+  for ( auto& oc: mOperatingConditionsList ) {
+    if ( oc.name() == name_str ) {
+      return &oc;
+    }
+  }
+  return nullptr;
+}
+
+// @brief 名前からワイヤーロードセレクションを取得する．
+const CiWireLoadSelection*
+CiCellLibrary::wire_load_selection(
+  std::string_view name
+) const
+{
+  // 名前を持たないものもあるので string に変換して比較する．
+  string name_str{name};
+  for ( auto& sel: mWireLoadSelectionList ) {
+    if ( sel->name() == name_str ) {
+      return sel.get();
+    }
+  }
+  return nullptr;
+}
+
+// @brief 面積からワイヤーロードを選ぶ．
+const CiWireLoad*
+CiCellLibrary::select_wire_load(
+  double area
+) const
+{
+  if ( mDefaultWireLoadSelection != nullptr ) {
+    auto wl = mDefaultWireLoadSelection->select(area);
+    if ( wl != nullptr ) {
+      return wl;
+    }
+  }
+  return mDefaultWireLoad;
+}
+
+// @brief wire_load を追加する．
+CiWireLoad*
+CiCellLibrary::add_wire_load(
+  const ShString& name,
+  double resistance,
+  double capacitance,
+  double area,
+  double slope,
+  const vector<pair<SizeType, double>>& fanout_length_list
+)
+{
+  auto id = mWireLoadList.size();
+  auto ptr = CiWireLoad::new_model(id, name, resistance, capacitance,
+				   area, slope, fanout_length_list);
+  auto wl = ptr.get();
+  mWireLoadList.push_back(std::move(ptr));
+  mWireLoadDict.emplace(std::string_view{static_cast<const char*>(name)}, wl);
+  return wl;
+}
+
+// @brief wire_load_table を追加する．
+CiWireLoad*
+CiCellLibrary::add_wire_load_table(
+  const ShString& name,
+  const vector<pair<SizeType, double>>& fanout_length_list,
+  const vector<pair<SizeType, double>>& fanout_capacitance_list,
+  const vector<pair<SizeType, double>>& fanout_resistance_list,
+  const vector<pair<SizeType, double>>& fanout_area_list
+)
+{
+  auto id = mWireLoadList.size();
+  auto ptr = CiWireLoad::new_table(id, name,
+				   fanout_length_list,
+				   fanout_capacitance_list,
+				   fanout_resistance_list,
+				   fanout_area_list);
+  auto wl = ptr.get();
+  mWireLoadList.push_back(std::move(ptr));
+  mWireLoadDict.emplace(std::string_view{static_cast<const char*>(name)}, wl);
+  return wl;
+}
+
+// @brief wire_load_selection を追加する．
+CiWireLoadSelection*
+CiCellLibrary::add_wire_load_selection(
+  const ShString& name,
+  const vector<tuple<double, double, const CiWireLoad*>>& entry_list
+)
+{
+  vector<CiWireLoadSelection::Entry> tmp_list;
+  tmp_list.reserve(entry_list.size());
+  for ( auto& t: entry_list ) {
+    auto min_area = std::get<0>(t);
+    auto max_area = std::get<1>(t);
+    auto wl = std::get<2>(t);
+    tmp_list.push_back({min_area, max_area, wl});
+  }
+  auto ptr = unique_ptr<CiWireLoadSelection>{new CiWireLoadSelection{name, tmp_list}};
+  auto sel = ptr.get();
+  mWireLoadSelectionList.push_back(std::move(ptr));
+  return sel;
+}
+
+// @brief operating_conditions を追加する．
+void
+CiCellLibrary::add_operating_conditions(
+  const ShString& name,
+  double process,
+  double temperature,
+  double voltage,
+  const ShString& tree_type
+)
+{
+  auto id = mOperatingConditionsList.size();
+  mOperatingConditionsList.push_back({id, name, process, temperature,
+				      voltage, tree_type});
 }
 
 // @brief 1次元の LUT のテンプレートを作る．
@@ -345,7 +649,9 @@ CiCellLibrary::reg_cell(
 {
   auto cell = ptr.get();
   mCellList.push_back(std::move(ptr));
-  mCellDict.emplace(cell->name(), cell);
+  // ShString の文字列は解放されないのでキーとして使える．
+  auto name = cell->_name();
+  mCellDict.emplace(std::string_view{static_cast<const char*>(name)}, cell);
   return cell;
 }
 
@@ -353,11 +659,40 @@ CiCellLibrary::reg_cell(
 void
 CiCellLibrary::wrap_up()
 {
-  // ピン名の辞書を作る．
-  for ( auto& cell: mCellList ) {
-    for ( auto& pin: cell->_pin_list() ) {
-      mPinDict.add(cell.get(), pin->_name(), pin.get());
+  // デフォルトのワイヤーロードを求める．
+  mDefaultWireLoad = nullptr;
+  if ( mDefaultWireLoadName != string{} ) {
+    mDefaultWireLoad = wire_load(std::string_view{mDefaultWireLoadName});
+  }
+  mDefaultWireLoadSelection = nullptr;
+  if ( mDefaultWireLoadSelectionName != string{} ) {
+    auto name = std::string_view{mDefaultWireLoadSelectionName};
+    mDefaultWireLoadSelection = wire_load_selection(name);
+  }
+  else if ( mWireLoadSelectionList.size() == 1 ) {
+    mDefaultWireLoadSelection = mWireLoadSelectionList.front().get();
+  }
+
+  // デフォルトの動作条件を求める．
+  mDefaultOperatingConditions = CLIB_NULLID;
+  if ( mDefaultOperatingConditionsName != string{} ) {
+    auto name = std::string_view{mDefaultOperatingConditionsName};
+    auto oc = operating_conditions(name);
+    if ( oc != nullptr ) {
+      mDefaultOperatingConditions = oc->id();
     }
+  }
+
+  // 論理関数による検索用の辞書を作る．
+  make_logic_dict();
+
+  // セルを並べたリストを作る．
+  make_sorted_list();
+
+  // ピン名の表とバス名/バンドル名の辞書，リーク電力の表を作る．
+  for ( auto& cell: mCellList ) {
+    cell->make_pin_table();
+    cell->build_leakage_table();
     for ( auto& bus: cell->_bus_list() ) {
       mBusDict.add(cell.get(), bus->_name(), bus.get());
     }
@@ -391,21 +726,47 @@ CiCellLibrary::wrap_up()
 // @brief セルグループ/セルクラスの設定を行なう．
 void
 CiCellLibrary::compile()
+{
+  CiLoadProfiler profiler;
+  compile(profiler);
+}
+
+// @brief 計測を行いながらセルグループ/セルクラスの設定を行なう．
+void
+CiCellLibrary::compile(
+  CiLoadProfiler& profiler
+)
 {
   // シグネチャを用いてセルグループとセルクラスの設定を行う．
   CgMgr cgmgr{*this};
+  // シグネチャの生成とグループの検索は交互に行われるので
+  // それぞれの時間を積算する．
+  double sig_time = 0.0;
+  double group_time = 0.0;
+  bool enabled = profiler.is_enabled();
   for ( auto& cell: mCellList ) {
+    CiLoadProfiler::Clock::time_point t0;
+    if ( enabled ) {
+      t0 = CiLoadProfiler::now();
+    }
     // シグネチャを作る．
     auto sig = cell->make_signature();
+    CiLoadProfiler::Clock::time_point t1;
+    if ( enabled ) {
+      t1 = CiLoadProfiler::now();
+    }
     // sig に対応するグループを求める．
     auto group = cgmgr.find_group(sig);
     // セルを登録する．
     group->add_cell(cell.get());
     cell->set_group(group);
+    if ( enabled ) {
+      auto t2 = CiLoadProfiler::now();
+      sig_time += CiLoadProfiler::elapsed(t0, t1);
+      group_time += CiLoadProfiler::elapsed(t1, t2);
+    }
   }
-
-  // パタングラフを作る．
-  cgmgr.gen_pat();
+  profiler.add("signature", sig_time, 0, mCellList.size());
 
   // セルクラスの情報をコピーする．
   for ( SizeType index = 0; index < 24; ++ index ) {
@@ -414,32 +775,136 @@ CiCellLibrary::compile()
   mFFClassDict = cgmgr.ff_class_dict();
   mLatchClassDict = cgmgr.latch_class_dict();
 
+  // パタングラフ用の論理式を記録しておく．
+  // パタングラフは最初に参照された時に作る．
+  mPgExprList = cgmgr.pat_expr_list();
+  profiler.add("grouping", group_time, 0, mCellGroupList.size());
+
+  if ( enabled ) {
+    // 計測する場合にはここでパタングラフを作ってしまう．
+    profiler.start();
+    _build_pg();
+    profiler.stop("gen_pat", 0, mPatMgr.node_num());
+  }
+}
+
+// @brief パタングラフを作る．
+void
+CiCellLibrary::_gen_pg() const
+{
+  PatMgr pat_mgr;
+  pat_mgr.set_param(mPgParam);
+  for ( auto& p: mPgExprList ) {
+    auto rep_class = p.first;
+    for ( auto& expr: p.second ) {
+      pat_mgr.reg_pat(expr, rep_class);
+    }
+  }
+  // 制限によって使われなくなったノードを削除する．
+  pat_mgr.sweep();
+  mPgStats = pat_mgr.stats();
+  mPgExprList.clear();
+
   // パタングラフの情報をコピーする．
-  SizeType nn = cgmgr.pat_node_num();
+  SizeType nn = pat_mgr.node_num();
   mPatMgr.set_node_num(nn);
   for ( SizeType i = 0; i < nn; ++ i ) {
-    const auto& node = cgmgr.pat_node(i);
+    const auto& node = pat_mgr.node(i);
     if ( node.is_input() ) {
       mPatMgr.set_node_info(i, node.input_id());
     }
     else {
       auto type = node.is_and() ? ClibPatType::And : ClibPatType::Xor;
-      SizeType iid1 = node.fanin(0).id();
+      SizeType iid1 = node.fanin_id(0);
       bool iinv1 = node.fanin_inv(0);
-      SizeType iid2 = node.fanin(1).id();
+      SizeType iid2 = node.fanin_id(1);
       bool iinv2 = node.fanin_inv(1);
       mPatMgr.set_node_info(i, type, iid1, iinv1, iid2, iinv2);
     }
   }
-  SizeType np = cgmgr.pat_num();
+  SizeType np = pat_mgr.pat_num();
   mPatMgr.set_pat_num(np);
   for ( SizeType i = 0; i < np; ++ i ) {
-    const CiCellClass* rep_class;
+    auto rep_class = pat_mgr.rep_class(i);
     SizeType input_num;
     vector<SizeType> edge_list;
-    cgmgr.get_pat_info(i, rep_class, input_num, edge_list);
+    pat_mgr.get_pat_info(i, input_num, edge_list);
     mPatMgr.set_pat_info(i, rep_class, input_num, edge_list);
   }
+
+  // パタン照合用の索引を作る．
+  mPatMgr.make_index();
+}
+
+// @brief 論理関数による検索用の辞書を作る．
+void
+CiCellLibrary::make_logic_dict()
+{
+  mLogicGroupDict.clear();
+  mLogicClassDict.clear();
+  for ( auto& group: mCellGroupList ) {
+    if ( group->cell_num() == 0 ) {
+      continue;
+    }
+    // 同じグループのセルは全て同じ関数を持つので
+    // 先頭のセルだけ調べればよい．
+    auto cell = group->cell(0);
+    if ( cell->type() != ClibCellType::Logic ||
+	 cell->output_num() != 1 ||
+	 cell->inout_num() != 0 ) {
+      continue;
+    }
+    auto opin = cell->output(0);
+    auto expr = opin->function();
+    if ( expr.is_invalid() || opin->tristate().is_valid() ) {
+      continue;
+    }
+    auto func = expr.to_tv(cell->input_num());
+    mLogicGroupDict.emplace(func, group.get());
+
+    // グループの変換マップで代表シグネチャが得られる．
+    auto sig = cell->make_signature();
+    auto rep_sig = sig.xform(group->iomap());
+    mLogicClassDict.emplace(rep_sig.str(), group->rep_class());
+  }
+}
+
+// @brief グループ/クラスごとにセルを並べたリストを作る．
+void
+CiCellLibrary::make_sorted_list()
+{
+  for ( auto order: { ClibCellOrder::Area,
+		      ClibCellOrder::InputCapacitance,
+		      ClibCellOrder::DriveResistance } ) {
+    std::unordered_map<const CiCell*, SizeType> group_pos;
+    for ( auto& group: mCellGroupList ) {
+      auto cell_list = sort_cells(group->cell_list(), order);
+      for ( SizeType i = 0; i < cell_list.size(); ++ i ) {
+	group_pos.emplace(cell_list[i], i);
+      }
+      group->set_sorted_list(order, cell_list);
+    }
+
+    std::unordered_map<const CiCell*, SizeType> class_pos;
+    for ( auto& cclass: mCellClassList ) {
+      vector<const CiCell*> tmp_list;
+      for ( auto group: cclass->cell_group_list() ) {
+	tmp_list.insert(tmp_list.end(),
+			group->cell_list().begin(),
+			group->cell_list().end());
+      }
+      auto cell_list = sort_cells(tmp_list, order);
+      for ( SizeType i = 0; i < cell_list.size(); ++ i ) {
+	class_pos.emplace(cell_list[i], i);
+      }
+      cclass->set_sorted_list(order, cell_list);
+    }
+
+    for ( auto& cell: mCellList ) {
+      auto p = cell.get();
+      cell->set_order_pos(order, group_pos.at(p), class_pos.at(p));
+    }
+  }
 }
 
 // @brief 内容をクリアする．
@@ -461,11 +926,13 @@ CiCellLibrary::clear()
   mLutTemplateList.clear();
   mCellList.clear();
   mCellDict.clear();
-  mPinDict.clear();
   mBusDict.clear();
   mBundleDict.clear();
   mCellGroupList.clear();
   mCellClassList.clear();
+  mLogicGroupDict.clear();
+  mLogicClassDict.clear();
+  mPgStats = {};
 }
 
 END_NAMESPACE_YM_CLIB
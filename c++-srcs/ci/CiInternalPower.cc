@@ -0,0 +1,151 @@
+/// @file CiInternalPower.cc
+/// @brief CiInternalPower の実装ファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2024 Yusuke Matsunaga
+/// All rights reserved.
+
+#include "ci/CiInternalPower.h"
+#include "ci/CiLutTemplate.h"
+#include "ci/Serializer.h"
+#include "ci/Deserializer.h"
+
+
+BEGIN_NAMESPACE_YM_CLIB
+
+//////////////////////////////////////////////////////////////////////
+// クラス CiInternalPower
+//////////////////////////////////////////////////////////////////////
+
+// @brief LUT の変数の割り当てを求める．
+void
+CiInternalPower::make_var_map(
+  const CiLut* lut,
+  SizeType var_map[]
+)
+{
+  auto templ = lut->lut_template();
+  SizeType d = lut->dimension();
+  for ( SizeType i = 0; i < d; ++ i ) {
+    switch ( templ->variable_type(i) ) {
+    case ClibVarType::input_net_transition:
+    case ClibVarType::input_transition_time:
+    case ClibVarType::related_pin_transition:
+      var_map[i] = 0;
+      break;
+
+    case ClibVarType::total_output_net_capacitance:
+    case ClibVarType::equal_or_opposite_output_net_capacitance:
+    case ClibVarType::related_out_total_output_net_capacitance:
+      var_map[i] = 1;
+      break;
+
+    default:
+      throw std::invalid_argument{"unsupported variable type for power calculation"};
+    }
+  }
+}
+
+// @brief エネルギーを計算する．
+double
+CiInternalPower::calc_energy(
+  const CiLut* lut,
+  double input_transition,
+  double output_capacitance
+)
+{
+  if ( lut == nullptr ) {
+    return 0.0;
+  }
+
+  SizeType var_map[3];
+  make_var_map(lut, var_map);
+  double args[2] = {input_transition, output_capacitance};
+  SizeType d = lut->dimension();
+  vector<double> val_array(d);
+  for ( SizeType i = 0; i < d; ++ i ) {
+    val_array[i] = args[var_map[i]];
+  }
+  return lut->value(val_array);
+}
+
+// @brief エネルギーをまとめて計算する．
+vector<double>
+CiInternalPower::calc_energy_list(
+  const CiLut* lut,
+  const vector<double>& input_transition_list,
+  const vector<double>& output_capacitance_list
+)
+{
+  SizeType n = input_transition_list.size();
+  if ( output_capacitance_list.size() != n ) {
+    throw std::invalid_argument{"input_transition_list.size() != output_capacitance_list.size()"};
+  }
+
+  vector<double> energy_list(n, 0.0);
+  if ( lut == nullptr ) {
+    return energy_list;
+  }
+
+  // 変数の割り当ては最初に一度だけ求め，
+  // 入力値の配列も使いまわす．
+  SizeType var_map[3];
+  make_var_map(lut, var_map);
+  SizeType d = lut->dimension();
+  vector<double> val_array(d);
+  const vector<double>* src_list[2] = {
+    &input_transition_list,
+    &output_capacitance_list
+  };
+  for ( SizeType k = 0; k < n; ++ k ) {
+    for ( SizeType i = 0; i < d; ++ i ) {
+      val_array[i] = (*src_list[var_map[i]])[k];
+    }
+    energy_list[k] = lut->value(val_array);
+  }
+  return energy_list;
+}
+
+// @brief 内容をシリアライズする．
+void
+CiInternalPower::serialize(
+  Serializer& s
+) const
+{
+  s.reg_obj(this);
+  for ( auto lut: {rise_power(), fall_power()} ) {
+    if ( lut != nullptr ) {
+      lut->serialize(s);
+    }
+  }
+}
+
+// @brief 内容をバイナリダンプする．
+void
+CiInternalPower::dump(
+  Serializer& s
+) const
+{
+  s.dump(mPin);
+  s.dump(mRelatedPin);
+  s.dump(mWhen);
+  s.dump(rise_power());
+  s.dump(fall_power());
+}
+
+// @brief 内容を読み込む．
+unique_ptr<CiInternalPower>
+CiInternalPower::restore(
+  Deserializer& s
+)
+{
+  auto ptr = unique_ptr<CiInternalPower>{new CiInternalPower};
+  s.restore(ptr->mPin);
+  s.restore(ptr->mRelatedPin);
+  s.restore(ptr->mWhen);
+  s.restore(ptr->mRisePower);
+  s.restore(ptr->mFallPower);
+  return ptr;
+}
+
+END_NAMESPACE_YM_CLIB
@@ -0,0 +1,173 @@
+/// @file CiLeakageTable.cc
+/// @brief CiLeakageTable の実装ファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2024 Yusuke Matsunaga
+/// All rights reserved.
+
+#include "ci/CiLeakageTable.h"
+#include "ym/TvFunc.h"
+
+
+BEGIN_NAMESPACE_YM_CLIB
+
+//////////////////////////////////////////////////////////////////////
+// クラス CiLeakageTable
+//////////////////////////////////////////////////////////////////////
+
+// @brief 表を作る．
+void
+CiLeakageTable::build(
+  SizeType input_num,
+  double default_value,
+  const vector<Expr>& when_list,
+  const vector<double>& value_list
+)
+{
+  ASSERT_COND( when_list.size() == value_list.size() );
+
+  mInputNum = input_num;
+  mWordNum = 0;
+  mMaskArray.clear();
+  mValueTable.clear();
+
+  // 条件なし(定数1)のものは既定値として扱う．
+  SizeType nc = when_list.size();
+  bool has_default = false;
+  bool has_cond = false;
+  for ( SizeType c = 0; c < nc; ++ c ) {
+    if ( when_list[c].is_one() ) {
+      if ( !has_default ) {
+	default_value = value_list[c];
+	has_default = true;
+      }
+    }
+    else {
+      has_cond = true;
+    }
+  }
+
+  if ( input_num > max_input_num() ) {
+    if ( !has_cond ) {
+      // 状態によらず一定なので入力数に関係なく評価できる．
+      mValueTable.resize(1, default_value);
+    }
+    return;
+  }
+
+  // 条件式をビットマスクに変換する．
+  SizeType nm = 1 << input_num;
+  mWordNum = (nm + 63) / 64;
+  mMaskArray.resize(nc * mWordNum, 0ULL);
+  for ( SizeType c = 0; c < nc; ++ c ) {
+    auto& when = when_list[c];
+    auto mask = &mMaskArray[c * mWordNum];
+    if ( when.is_one() ) {
+      for ( SizeType m = 0; m < nm; ++ m ) {
+	mask[m / 64] |= (1ULL << (m % 64));
+      }
+      continue;
+    }
+    auto func = when.to_tv(input_num);
+    for ( SizeType m = 0; m < nm; ++ m ) {
+      if ( func.value(m) ) {
+	mask[m / 64] |= (1ULL << (m % 64));
+      }
+    }
+  }
+
+  if ( !has_cond ) {
+    // 状態によらず一定
+    mValueTable.resize(1, default_value);
+    return;
+  }
+
+  // 先に定義された条件から順に，まだ覆われていない状態に値を割り当てる．
+  // マスクの演算は64状態ずつまとめて行う．
+  mValueTable.resize(nm, default_value);
+  vector<std::uint64_t> covered(mWordNum, 0ULL);
+  for ( SizeType c = 0; c < nc; ++ c ) {
+    if ( when_list[c].is_one() ) {
+      continue;
+    }
+    auto mask = &mMaskArray[c * mWordNum];
+    double val = value_list[c];
+    for ( SizeType w = 0; w < mWordNum; ++ w ) {
+      auto eff = mask[w] & ~covered[w];
+      covered[w] |= mask[w];
+      for ( SizeType b = 0; eff != 0ULL; ++ b, eff >>= 1 ) {
+	if ( eff & 1ULL ) {
+	  mValueTable[w * 64 + b] = val;
+	}
+      }
+    }
+  }
+}
+
+// @brief 条件式のビットマスクを返す．
+vector<std::uint64_t>
+CiLeakageTable::when_mask(
+  SizeType pos
+) const
+{
+  if ( mWordNum == 0 ) {
+    throw std::invalid_argument{"too many inputs for leakage power evaluation"};
+  }
+  auto begin = mMaskArray.begin() + pos * mWordNum;
+  return vector<std::uint64_t>{begin, begin + mWordNum};
+}
+
+// @brief 入力状態のリストに対するリーク電力のリストを返す．
+vector<double>
+CiLeakageTable::value_list(
+  const vector<std::uint64_t>& state_list
+) const
+{
+  check_valid();
+  SizeType n = state_list.size();
+  vector<double> ans_list(n);
+  auto table = mValueTable.data();
+  std::uint64_t bitmask = mValueTable.size() - 1;
+  for ( SizeType i = 0; i < n; ++ i ) {
+    ans_list[i] = table[state_list[i] & bitmask];
+  }
+  return ans_list;
+}
+
+// @brief 入力の信号確率に対するリーク電力の期待値を返す．
+double
+CiLeakageTable::average_value(
+  const vector<double>& prob_list
+) const
+{
+  check_valid();
+  SizeType nm = mValueTable.size();
+  if ( nm == 1 ) {
+    return mValueTable[0];
+  }
+
+  if ( prob_list.size() != mInputNum ) {
+    throw std::invalid_argument{"prob_list.size() != input_num()"};
+  }
+
+  // 各入力状態の生起確率を入力ごとに倍々に求める．
+  vector<double> state_prob(nm);
+  state_prob[0] = 1.0;
+  for ( SizeType i = 0; i < mInputNum; ++ i ) {
+    double p1 = prob_list[i];
+    double p0 = 1.0 - p1;
+    SizeType bit = 1 << i;
+    for ( SizeType m = 0; m < bit; ++ m ) {
+      state_prob[m | bit] = state_prob[m] * p1;
+      state_prob[m] *= p0;
+    }
+  }
+
+  double ans = 0.0;
+  for ( SizeType m = 0; m < nm; ++ m ) {
+    ans += state_prob[m] * mValueTable[m];
+  }
+  return ans;
+}
+
+END_NAMESPACE_YM_CLIB
@@ -0,0 +1,55 @@
+/// @file CiLoadProfiler.cc
+/// @brief CiLoadProfiler の実装ファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2024 Yusuke Matsunaga
+/// All rights reserved.
+
+#include "ci/CiLoadProfiler.h"
+#include <sys/resource.h>
+
+
+BEGIN_NAMESPACE_YM_CLIB
+
+BEGIN_NONAMESPACE
+
+// プロセスの最大常駐メモリ量(バイト)を返す．
+SizeType
+get_peak_rss()
+{
+  struct rusage ru;
+  if ( getrusage(RUSAGE_SELF, &ru) != 0 ) {
+    return 0;
+  }
+#if defined(__APPLE__)
+  // macOS ではバイト単位
+  return static_cast<SizeType>(ru.ru_maxrss);
+#else
+  // Linux ではキロバイト単位
+  return static_cast<SizeType>(ru.ru_maxrss) * 1024;
+#endif
+}
+
+END_NONAMESPACE
+
+//////////////////////////////////////////////////////////////////////
+// クラス CiLoadProfiler
+//////////////////////////////////////////////////////////////////////
+
+// @brief 別途計測した結果を記録する．
+void
+CiLoadProfiler::add(
+  const string& name,
+  double wall_time,
+  SizeType bytes,
+  SizeType object_num
+)
+{
+  if ( !is_enabled() ) {
+    return;
+  }
+  mProfile->phase_list.push_back({name, wall_time, bytes, object_num,
+				  get_peak_rss()});
+}
+
+END_NAMESPACE_YM_CLIB
@@ -121,6 +121,9 @@ CiLut::serialize(
 ) const
 {
   s.reg_obj(this);
+  // テンプレートも登録しておく．
+  // ライブラリ全体をダンプする時にはすでに登録済みなので何もしない．
+  s.reg_obj(mTemplate);
 }
 
 // @brief 実際のダンプを行う関数
@@ -242,8 +245,41 @@ CiLut1D::value(
     throw std::invalid_argument{"val_array.size() should be 1"};
   }
 
-  double val = val_array[0];
+  return _value(val_array[0]);
+}
+
+// @brief 値をまとめて計算する．
+void
+CiLut1D::value_list(
+  SizeType n,
+  const double* const input_list[],
+  double* output_list
+) const
+{
+  auto src = input_list[0];
+  for ( SizeType k = 0; k < n; ++ k ) {
+    output_list[k] = _value(src[k]);
+  }
+}
+
+// @brief インデックス値の配列を返す．
+const vector<double>&
+CiLut1D::index_array(
+  SizeType var
+) const
+{
+  if ( var != 0 ) {
+    throw std::out_of_range{"var should be 0"};
+  }
+  return mIndexArray;
+}
 
+// @brief value() の本体
+double
+CiLut1D::_value(
+  double val
+) const
+{
   auto idx_a = search(val, mIndexArray);
   auto idx_b = idx_a + 1;
   double x0 = mIndexArray[idx_a];
@@ -364,13 +400,48 @@ CiLut2D::value(
     throw std::invalid_argument{"val_array.size() should be 2"};
   }
 
-  double val1 = val_array[0];
+  return _value(val_array[0], val_array[1]);
+}
+
+// @brief 値をまとめて計算する．
+void
+CiLut2D::value_list(
+  SizeType n,
+  const double* const input_list[],
+  double* output_list
+) const
+{
+  auto src1 = input_list[0];
+  auto src2 = input_list[1];
+  for ( SizeType k = 0; k < n; ++ k ) {
+    output_list[k] = _value(src1[k], src2[k]);
+  }
+}
+
+// @brief インデックス値の配列を返す．
+const vector<double>&
+CiLut2D::index_array(
+  SizeType var
+) const
+{
+  if ( var < 0 || 2 <= var ) {
+    throw std::invalid_argument{"var should 0 or 1"};
+  }
+  return mIndexArray[var];
+}
+
+// @brief value() の本体
+double
+CiLut2D::_value(
+  double val1,
+  double val2
+) const
+{
   auto idx1_a = search(val1, mIndexArray[0]);
   auto idx1_b = idx1_a + 1;
   double x0 = mIndexArray[0][idx1_a];
   double x1 = mIndexArray[0][idx1_b];
 
-  double val2 = val_array[1];
   auto idx2_a = search(val2, mIndexArray[1]);
   auto idx2_b = idx2_a + 1;
   double y0 = mIndexArray[1][idx2_a];
@@ -506,19 +577,55 @@ CiLut3D::value(
   if ( val_array.size() != 3 ) {
     throw std::invalid_argument{"val_array.size() should be 3"};
   }
-  double val1 = val_array[0];
+  return _value(val_array[0], val_array[1], val_array[2]);
+}
+
+// @brief 値をまとめて計算する．
+void
+CiLut3D::value_list(
+  SizeType n,
+  const double* const input_list[],
+  double* output_list
+) const
+{
+  auto src1 = input_list[0];
+  auto src2 = input_list[1];
+  auto src3 = input_list[2];
+  for ( SizeType k = 0; k < n; ++ k ) {
+    output_list[k] = _value(src1[k], src2[k], src3[k]);
+  }
+}
+
+// @brief インデックス値の配列を返す．
+const vector<double>&
+CiLut3D::index_array(
+  SizeType var
+) const
+{
+  if ( var < 0 || 3 <= var ) {
+    throw std::invalid_argument{"var should be 0, 1, or 2"};
+  }
+  return mIndexArray[var];
+}
+
+// @brief value() の本体
+double
+CiLut3D::_value(
+  double val1,
+  double val2,
+  double val3
+) const
+{
   auto idx1_a = search(val1, mIndexArray[0]);
   auto idx1_b = idx1_a + 1;
   double x0 = mIndexArray[0][idx1_a];
   double x1 = mIndexArray[0][idx1_b];
 
-  double val2 = val_array[1];
   auto idx2_a = search(val2, mIndexArray[1]);
   auto idx2_b = idx2_a + 1;
   double y0 = mIndexArray[1][idx2_a];
   double y1 = mIndexArray[1][idx2_b];
 
-  double val3 = val_array[2];
   auto idx3_a = search(val3, mIndexArray[2]);
   auto idx3_b = idx3_a + 1;
   double z0 = mIndexArray[2][idx3_a];
@@ -72,6 +72,27 @@ public:
                                     ///< サイズは dimension() と同じ
   ) const override;
 
+  /// @brief 値をまとめて計算する．
+  void
+  value_list(
+    SizeType n,                       ///< [in] 値の組の数
+    const double* const input_list[], ///< [in] 変数ごとの値の配列
+    double* output_list               ///< [out] 結果を格納する配列
+  ) const override;
+
+  /// @brief インデックス値の配列を返す．
+  const vector<double>&
+  index_array(
+    SizeType var ///< [in] 変数番号 ( 0 <= var < dimension() )
+  ) const override;
+
+  /// @brief 格子点の値の配列を返す．
+  const vector<double>&
+  value_array() const override
+  {
+    return mValueArray;
+  }
+
 
 public:
   //////////////////////////////////////////////////////////////////////
@@ -90,6 +111,12 @@ private:
   // 内部で用いられる関数
   //////////////////////////////////////////////////////////////////////
 
+  /// @brief value() の本体
+  double
+  _value(
+    double val ///< [in] 入力の値
+  ) const;
+
   /// @brief restore() の下請け関数
   void
   _restore(
@@ -171,6 +198,27 @@ public:
                                     ///< サイズは dimension() と同じ
   ) const override;
 
+  /// @brief 値をまとめて計算する．
+  void
+  value_list(
+    SizeType n,                       ///< [in] 値の組の数
+    const double* const input_list[], ///< [in] 変数ごとの値の配列
+    double* output_list               ///< [out] 結果を格納する配列
+  ) const override;
+
+  /// @brief インデックス値の配列を返す．
+  const vector<double>&
+  index_array(
+    SizeType var ///< [in] 変数番号 ( 0 <= var < dimension() )
+  ) const override;
+
+  /// @brief 格子点の値の配列を返す．
+  const vector<double>&
+  value_array() const override
+  {
+    return mValueArray;
+  }
+
 
 public:
   //////////////////////////////////////////////////////////////////////
@@ -199,6 +247,13 @@ private:
     return idx1 * index_num(1) + idx2;
   }
 
+  /// @brief value() の本体
+  double
+  _value(
+    double val1, ///< [in] 1番めの入力の値
+    double val2  ///< [in] 2番めの入力の値
+  ) const;
+
   /// @brief restore() の下請け関数
   void
   _restore(
@@ -281,6 +336,27 @@ public:
                                     ///< サイズは dimension() と同じ
   ) const override;
 
+  /// @brief 値をまとめて計算する．
+  void
+  value_list(
+    SizeType n,                       ///< [in] 値の組の数
+    const double* const input_list[], ///< [in] 変数ごとの値の配列
+    double* output_list               ///< [out] 結果を格納する配列
+  ) const override;
+
+  /// @brief インデックス値の配列を返す．
+  const vector<double>&
+  index_array(
+    SizeType var ///< [in] 変数番号 ( 0 <= var < dimension() )
+  ) const override;
+
+  /// @brief 格子点の値の配列を返す．
+  const vector<double>&
+  value_array() const override
+  {
+    return mValueArray;
+  }
+
 
 public:
   //////////////////////////////////////////////////////////////////////
@@ -310,6 +386,14 @@ private:
     return ((idx1 * index_num(1) + idx2) * index_num(2)) + idx3;
   }
 
+  /// @brief value() の本体
+  double
+  _value(
+    double val1, ///< [in] 1番めの入力の値
+    double val2, ///< [in] 2番めの入力の値
+    double val3  ///< [in] 3番めの入力の値
+  ) const;
+
   /// @brief restore() の下請け関数
   void
   _restore(
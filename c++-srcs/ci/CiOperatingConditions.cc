@@ -0,0 +1,47 @@
+/// @file CiOperatingConditions.cc
+/// @brief CiOperatingConditions の実装ファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2024 Yusuke Matsunaga
+/// All rights reserved.
+
+#include "ci/CiOperatingConditions.h"
+#include "ci/Serializer.h"
+#include "ci/Deserializer.h"
+
+
+BEGIN_NAMESPACE_YM_CLIB
+
+//////////////////////////////////////////////////////////////////////
+// クラス CiOperatingConditions
+//////////////////////////////////////////////////////////////////////
+
+// @brief 内容をバイナリダンプする．
+void
+CiOperatingConditions::dump(
+  Serializer& s
+) const
+{
+  s.dump(mId);
+  s.dump(mName);
+  s.dump(mProcess);
+  s.dump(mTemperature);
+  s.dump(mVoltage);
+  s.dump(mTreeType);
+}
+
+// @brief 内容を復元する．
+void
+CiOperatingConditions::restore(
+  Deserializer& s
+)
+{
+  s.restore(mId);
+  s.restore(mName);
+  s.restore(mProcess);
+  s.restore(mTemperature);
+  s.restore(mVoltage);
+  s.restore(mTreeType);
+}
+
+END_NAMESPACE_YM_CLIB
@@ -10,12 +10,84 @@
 #include "ci/CiPatGraph.h"
 #include "ci/Serializer.h"
 #include "ci/Deserializer.h"
+#include "cgmgr/CgSignature.h"
 #include "ym/BinEnc.h"
 #include "ym/Range.h"
 
 
 BEGIN_NAMESPACE_YM_CLIB
 
+BEGIN_NONAMESPACE
+
+// mPatIndex 用のキーを作る．
+inline
+SizeType
+index_key(
+  ClibPatType root_type,
+  SizeType depth,
+  SizeType input_num
+)
+{
+  return (((depth << 16) | input_num) << 2) | static_cast<SizeType>(root_type);
+}
+
+// 論理関数の NPN 正規形を表すシグネチャ文字列を求める．
+//
+// CgMgr がセルクラスを求めるのと同じ方法を用いる．
+string
+npn_key(
+  const TvFunc& func,
+  ClibIOMap& iomap
+)
+{
+  auto ni = func.input_num();
+  auto sig = CgSignature::make_logic_sig(ni, 1, 0, {func}, {TvFunc::invalid()});
+  iomap = sig.rep_map();
+  auto rep_sig = sig.xform(iomap);
+  return rep_sig.str();
+}
+
+// ノードの論理関数を求める．
+TvFunc
+node_func(
+  const CiPatMgr& mgr,
+  SizeType id,
+  SizeType input_num,
+  std::unordered_map<SizeType, TvFunc>& func_dict
+)
+{
+  if ( func_dict.count(id) > 0 ) {
+    return func_dict.at(id);
+  }
+
+  TvFunc func;
+  auto type = mgr.node_type(id);
+  if ( type == ClibPatType::Input ) {
+    func = TvFunc::posi_literal(input_num, mgr.input_id(id));
+  }
+  else {
+    TvFunc ifunc[2];
+    for ( auto pos: { 0, 1 } ) {
+      auto edge = id * 2 + pos;
+      ifunc[pos] = node_func(mgr, mgr.edge_from(edge), input_num, func_dict);
+      if ( mgr.edge_inv(edge) ) {
+	ifunc[pos] = ~ifunc[pos];
+      }
+    }
+    if ( type == ClibPatType::And ) {
+      func = ifunc[0] & ifunc[1];
+    }
+    else {
+      func = ifunc[0] ^ ifunc[1];
+    }
+  }
+  func_dict.emplace(id, func);
+  return func;
+}
+
+END_NONAMESPACE
+
+
 //////////////////////////////////////////////////////////////////////
 // クラス CiPatMgr
 //////////////////////////////////////////////////////////////////////
@@ -59,6 +131,64 @@ CiPatMgr::pat(
   return mPatArray[id];
 }
 
+// @brief パタンの論理関数を返す．
+const TvFunc&
+CiPatMgr::pat_func(
+  SizeType id
+) const
+{
+  if ( id < 0 || mPatFuncArray.size() <= id ) {
+    throw std::out_of_range{"id is out of range"};
+  }
+  return mPatFuncArray[id];
+}
+
+// @brief 根の種類，深さ，入力数からパタン番号のリストを返す．
+const vector<SizeType>&
+CiPatMgr::find_pat_list(
+  ClibPatType root_type,
+  SizeType depth,
+  SizeType input_num
+) const
+{
+  auto key = index_key(root_type, depth, input_num);
+  auto p = mPatIndex.find(key);
+  if ( p == mPatIndex.end() ) {
+    return mEmptyList;
+  }
+  return p->second;
+}
+
+// @brief パタンの論理関数から NPN 正規形への変換マップを返す．
+const ClibIOMap&
+CiPatMgr::pat_map(
+  SizeType id
+) const
+{
+  if ( id < 0 || mPatMapArray.size() <= id ) {
+    throw std::out_of_range{"id is out of range"};
+  }
+  return mPatMapArray[id];
+}
+
+// @brief 論理関数と NPN 同値なパタン番号のリストを返す．
+const vector<SizeType>&
+CiPatMgr::find_pat_list(
+  const TvFunc& func,
+  ClibIOMap& iomap
+) const
+{
+  if ( func.is_invalid() ) {
+    return mEmptyList;
+  }
+  auto key = npn_key(func, iomap);
+  auto p = mFuncIndex.find(key);
+  if ( p == mFuncIndex.end() ) {
+    return mEmptyList;
+  }
+  return p->second;
+}
+
 // @brief ノード数を設定する．
 void
 CiPatMgr::set_node_num(
@@ -177,7 +307,65 @@ CiPatMgr::restore(
     mPatArray[id].restore(s);
   }
 
+  // 索引は保存されていないので作り直す．
+  make_index();
+
   return true;
 }
 
+// @brief パタン照合用の索引を作る．
+void
+CiPatMgr::make_index()
+{
+  // ノードはファンインよりも後に作られているので
+  // 番号順に処理すればよい．
+  auto nn = node_num();
+  mNodeDepthArray.clear();
+  mNodeDepthArray.resize(nn, 0);
+  for ( SizeType id = 0; id < nn; ++ id ) {
+    if ( node_type(id) == ClibPatType::Input ) {
+      continue;
+    }
+    auto d0 = mNodeDepthArray[edge_from(id * 2 + 0)];
+    auto d1 = mNodeDepthArray[edge_from(id * 2 + 1)];
+    mNodeDepthArray[id] = std::max(d0, d1) + 1;
+  }
+
+  mMaxDepth = 0;
+  mPatFuncArray.clear();
+  mPatFuncArray.reserve(pat_num());
+  mPatMapArray.clear();
+  mPatMapArray.reserve(pat_num());
+  mPatIndex.clear();
+  mFuncIndex.clear();
+  for ( SizeType id = 0; id < pat_num(); ++ id ) {
+    auto& pat = mPatArray[id];
+    if ( pat.edge_num() == 0 ) {
+      // 論理ノードを含まないパタンは索引に含めない．
+      mPatFuncArray.push_back(TvFunc::invalid());
+      mPatMapArray.push_back(ClibIOMap{});
+      continue;
+    }
+    auto root_id = pat.root_id();
+    auto depth = node_depth(root_id);
+    auto ni = pat.input_num();
+    if ( mMaxDepth < depth ) {
+      mMaxDepth = depth;
+    }
+    auto key = index_key(node_type(root_id), depth, ni);
+    mPatIndex[key].push_back(id);
+
+    std::unordered_map<SizeType, TvFunc> func_dict;
+    auto func = node_func(*this, root_id, ni, func_dict);
+    if ( pat.root_inv() ) {
+      func = ~func;
+    }
+    ClibIOMap iomap;
+    auto npn_str = npn_key(func, iomap);
+    mPatFuncArray.push_back(func);
+    mPatMapArray.push_back(iomap);
+    mFuncIndex[npn_str].push_back(id);
+  }
+}
+
 END_NAMESPACE_YM_CLIB
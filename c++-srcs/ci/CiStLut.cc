@@ -137,6 +137,33 @@ CiStLut::value(
          dx0 * (dy1 * val_10 + dy0 * val_11);
 }
 
+// @brief 値をまとめて計算する．
+void
+CiStLut::value_list(
+  SizeType n,
+  const double* const input_list[],
+  double* output_list
+) const
+{
+  auto src1 = input_list[0];
+  auto src2 = input_list[1];
+  for ( SizeType k = 0; k < n; ++ k ) {
+    output_list[k] = value(src1[k], src2[k]);
+  }
+}
+
+// @brief インデックス値の配列を返す．
+const vector<double>&
+CiStLut::index_array(
+  SizeType var
+) const
+{
+  if ( var < 0 || 2 <= var ) {
+    throw std::invalid_argument{"var should 0 or 1"};
+  }
+  return mIndexArray[var];
+}
+
 // @brief 内容をシリアライズする．
 void
 CiStLut::serialize(
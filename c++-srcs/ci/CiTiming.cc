@@ -283,12 +283,13 @@ CiTiming::serialize(
 ) const
 {
   s.reg_obj(this);
-  rise_transition()->serialize(s);
-  fall_transition()->serialize(s);
-  rise_propagation()->serialize(s);
-  fall_propagation()->serialize(s);
-  cell_rise()->serialize(s);
-  cell_fall()->serialize(s);
+  for ( auto lut: {rise_transition(), fall_transition(),
+		   rise_propagation(), fall_propagation(),
+		   cell_rise(), cell_fall()} ) {
+    if ( lut != nullptr ) {
+      lut->serialize(s);
+    }
+  }
 }
 
 // @brief 共通な情報をダンプする．
@@ -0,0 +1,234 @@
+/// @file CiWireLoad.cc
+/// @brief CiWireLoad の実装ファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2024 Yusuke Matsunaga
+/// All rights reserved.
+
+#include "ci/CiWireLoad.h"
+#include "ci/Serializer.h"
+#include "ci/Deserializer.h"
+#include <algorithm>
+
+
+BEGIN_NAMESPACE_YM_CLIB
+
+//////////////////////////////////////////////////////////////////////
+// クラス CiWireLoad
+//////////////////////////////////////////////////////////////////////
+
+// @brief wire_load グループのインスタンスを生成する．
+unique_ptr<CiWireLoad>
+CiWireLoad::new_model(
+  SizeType id,
+  const ShString& name,
+  double resistance,
+  double capacitance,
+  double area,
+  double slope,
+  const vector<FanoutPoint>& fanout_length_list
+)
+{
+  auto ptr = unique_ptr<CiWireLoad>{new CiWireLoad};
+  ptr->mId = id;
+  ptr->mName = name;
+  ptr->mIsTable = false;
+  ptr->mResistance = resistance;
+  ptr->mCapacitance = capacitance;
+  ptr->mArea = area;
+  ptr->mSlope = slope;
+  // 表の範囲外は slope 属性を用いて外挿する．
+  ptr->mLengthTable.build(fanout_length_list);
+  ptr->mLengthTable.mSlope = slope;
+  ptr->mCapacitanceTable.scale(ptr->mLengthTable, capacitance);
+  ptr->mResistanceTable.scale(ptr->mLengthTable, resistance);
+  ptr->mAreaTable.scale(ptr->mLengthTable, area);
+  return ptr;
+}
+
+// @brief wire_load_table グループのインスタンスを生成する．
+unique_ptr<CiWireLoad>
+CiWireLoad::new_table(
+  SizeType id,
+  const ShString& name,
+  const vector<FanoutPoint>& fanout_length_list,
+  const vector<FanoutPoint>& fanout_capacitance_list,
+  const vector<FanoutPoint>& fanout_resistance_list,
+  const vector<FanoutPoint>& fanout_area_list
+)
+{
+  auto ptr = unique_ptr<CiWireLoad>{new CiWireLoad};
+  ptr->mId = id;
+  ptr->mName = name;
+  ptr->mIsTable = true;
+  ptr->mLengthTable.build(fanout_length_list);
+  ptr->mCapacitanceTable.build(fanout_capacitance_list);
+  ptr->mResistanceTable.build(fanout_resistance_list);
+  ptr->mAreaTable.build(fanout_area_list);
+  return ptr;
+}
+
+// @brief 内容をシリアライズする．
+void
+CiWireLoad::serialize(
+  Serializer& s
+) const
+{
+  s.reg_obj(this);
+}
+
+// @brief 内容をバイナリダンプする．
+void
+CiWireLoad::dump(
+  Serializer& s
+) const
+{
+  s.dump(mId);
+  s.dump(mName);
+  s.dump(static_cast<std::uint8_t>(mIsTable));
+  s.dump(mResistance);
+  s.dump(mCapacitance);
+  s.dump(mArea);
+  s.dump(mSlope);
+  mLengthTable.dump(s);
+  mCapacitanceTable.dump(s);
+  mResistanceTable.dump(s);
+  mAreaTable.dump(s);
+}
+
+// @brief 内容を復元する．
+unique_ptr<CiWireLoad>
+CiWireLoad::restore(
+  Deserializer& s
+)
+{
+  auto ptr = unique_ptr<CiWireLoad>{new CiWireLoad};
+  ptr->_restore(s);
+  return ptr;
+}
+
+// @brief restore() の本体
+void
+CiWireLoad::_restore(
+  Deserializer& s
+)
+{
+  s.restore(mId);
+  s.restore(mName);
+  std::uint8_t tmp;
+  s.restore(tmp);
+  mIsTable = static_cast<bool>(tmp);
+  s.restore(mResistance);
+  s.restore(mCapacitance);
+  s.restore(mArea);
+  s.restore(mSlope);
+  mLengthTable.restore(s);
+  mCapacitanceTable.restore(s);
+  mResistanceTable.restore(s);
+  mAreaTable.restore(s);
+}
+
+
+//////////////////////////////////////////////////////////////////////
+// クラス CiWireLoad::FanoutTable
+//////////////////////////////////////////////////////////////////////
+
+// @brief 点のリストから表を作る．
+void
+CiWireLoad::FanoutTable::build(
+  const vector<FanoutPoint>& point_list
+)
+{
+  // ファンアウト数の昇順に並べる．
+  // 同じファンアウト数の点は最初に現れたものを用いる．
+  auto tmp_list = point_list;
+  std::stable_sort(tmp_list.begin(), tmp_list.end(),
+		   [](const FanoutPoint& a, const FanoutPoint& b) {
+		     return a.first < b.first;
+		   });
+  auto end = std::unique(tmp_list.begin(), tmp_list.end(),
+			 [](const FanoutPoint& a, const FanoutPoint& b) {
+			   return a.first == b.first;
+			 });
+  tmp_list.erase(end, tmp_list.end());
+
+  mArray.clear();
+  mSlope = 0.0;
+  if ( tmp_list.empty() ) {
+    mArray.push_back(0.0);
+    return;
+  }
+
+  // 原点から順に隣り合う点の間を線形補間する．
+  mArray.resize(tmp_list.back().first + 1, 0.0);
+  SizeType prev_f = 0;
+  double prev_v = 0.0;
+  for ( auto& p: tmp_list ) {
+    auto f = p.first;
+    auto v = p.second;
+    if ( f == 0 ) {
+      mArray[0] = v;
+      prev_v = v;
+      continue;
+    }
+    double d = (v - prev_v) / static_cast<double>(f - prev_f);
+    for ( SizeType x = prev_f + 1; x < f; ++ x ) {
+      mArray[x] = prev_v + d * static_cast<double>(x - prev_f);
+    }
+    mArray[f] = v;
+    prev_f = f;
+    prev_v = v;
+    mSlope = d;
+  }
+}
+
+// @brief 値を定数倍した表を作る．
+void
+CiWireLoad::FanoutTable::scale(
+  const FanoutTable& src,
+  double factor
+)
+{
+  SizeType n = src.mArray.size();
+  mArray.resize(n);
+  for ( SizeType i = 0; i < n; ++ i ) {
+    mArray[i] = src.mArray[i] * factor;
+  }
+  mSlope = src.mSlope * factor;
+}
+
+// @brief 値のリストを返す．
+vector<double>
+CiWireLoad::FanoutTable::value_list(
+  const vector<SizeType>& fanout_list
+) const
+{
+  SizeType n = fanout_list.size();
+  vector<double> ans_list(n);
+  for ( SizeType i = 0; i < n; ++ i ) {
+    ans_list[i] = value(fanout_list[i]);
+  }
+  return ans_list;
+}
+
+// @brief 内容をバイナリダンプする．
+void
+CiWireLoad::FanoutTable::dump(
+  Serializer& s
+) const
+{
+  s.dump(mArray);
+  s.dump(mSlope);
+}
+
+// @brief 内容を復元する．
+void
+CiWireLoad::FanoutTable::restore(
+  Deserializer& s
+)
+{
+  s.restore(mArray);
+  s.restore(mSlope);
+}
+
+END_NAMESPACE_YM_CLIB
@@ -0,0 +1,76 @@
+/// @file CiWireLoadSelection.cc
+/// @brief CiWireLoadSelection の実装ファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2024 Yusuke Matsunaga
+/// All rights reserved.
+
+#include "ci/CiWireLoadSelection.h"
+#include "ci/CiWireLoad.h"
+#include "ci/Serializer.h"
+#include "ci/Deserializer.h"
+
+
+BEGIN_NAMESPACE_YM_CLIB
+
+//////////////////////////////////////////////////////////////////////
+// クラス CiWireLoadSelection
+//////////////////////////////////////////////////////////////////////
+
+// @brief 内容をシリアライズする．
+void
+CiWireLoadSelection::serialize(
+  Serializer& s
+) const
+{
+  s.reg_obj(this);
+  for ( auto& entry: mEntryList ) {
+    entry.mWireLoad->serialize(s);
+  }
+}
+
+// @brief 内容をバイナリダンプする．
+void
+CiWireLoadSelection::dump(
+  Serializer& s
+) const
+{
+  s.dump(mName);
+  SizeType n = mEntryList.size();
+  s.dump(n);
+  for ( auto& entry: mEntryList ) {
+    s.dump(entry.mMinArea);
+    s.dump(entry.mMaxArea);
+    s.dump(entry.mWireLoad);
+  }
+}
+
+// @brief 内容を復元する．
+unique_ptr<CiWireLoadSelection>
+CiWireLoadSelection::restore(
+  Deserializer& s
+)
+{
+  auto ptr = unique_ptr<CiWireLoadSelection>{new CiWireLoadSelection};
+  ptr->_restore(s);
+  return ptr;
+}
+
+// @brief restore() の本体
+void
+CiWireLoadSelection::_restore(
+  Deserializer& s
+)
+{
+  s.restore(mName);
+  SizeType n;
+  s.restore(n);
+  mEntryList.resize(n);
+  for ( auto& entry: mEntryList ) {
+    s.restore(entry.mMinArea);
+    s.restore(entry.mMaxArea);
+    s.restore(entry.mWireLoad);
+  }
+}
+
+END_NAMESPACE_YM_CLIB
@@ -12,6 +12,8 @@
 #include "ci/CiCell.h"
 #include "ci/CiBusType.h"
 #include "ci/CiLutTemplate.h"
+#include "ci/CiWireLoad.h"
+#include "ci/CiWireLoadSelection.h"
 #include "ci/CiLut.h"
 #include "ci/CiTiming.h"
 #include "ci/CiPatGraph.h"
@@ -88,6 +90,12 @@ CiCellLibrary::dump(
   // 遅延テーブルのテンプレートのリスト
   s.dump(mLutTemplateList);
 
+  // ワイヤーロード関係の情報
+  dump_wire_load(s);
+
+  // 動作条件関係の情報
+  dump_operating_conditions(s);
+
   // セルのリスト
   s.dump(mCellList);
 
@@ -105,6 +113,8 @@ CiCellLibrary::dump(
   s.dump(mLatchClassDict);
 
   // パタングラフの情報のダンプ
+  // まだ作られていなければここで作る．
+  _build_pg();
   mPatMgr.dump(s);
 }
 
@@ -120,6 +130,12 @@ CiCellLibrary::serialize(
   for ( auto& templ: mLutTemplateList ) {
     templ->serialize(s);
   }
+  for ( auto& wl: mWireLoadList ) {
+    wl->serialize(s);
+  }
+  for ( auto& sel: mWireLoadSelectionList ) {
+    sel->serialize(s);
+  }
   for ( auto& cell: mCellList ) {
     cell->serialize(s);
   }
@@ -131,4 +147,43 @@ CiCellLibrary::serialize(
   }
 }
 
+// @brief ワイヤーロード関係の情報をダンプする．
+void
+CiCellLibrary::dump_wire_load(
+  Serializer& s
+) const
+{
+  s.dump(mWireLoadList);
+  s.dump(mWireLoadSelectionList);
+  s.dump(mDefaultWireLoadName);
+  s.dump(mDefaultWireLoadSelectionName);
+  s.dump(mDefaultWireLoadMode);
+  s.dump(mDefaultWireLoadArea);
+  s.dump(mDefaultWireLoadCapacitance);
+  s.dump(mDefaultWireLoadResistance);
+}
+
+// @brief 動作条件関係の情報をダンプする．
+void
+CiCellLibrary::dump_operating_conditions(
+  Serializer& s
+) const
+{
+  s.dump(mNomProcess);
+  s.dump(mNomTemperature);
+  s.dump(mNomVoltage);
+  SizeType nk = mKFactorDict.size();
+  s.dump(nk);
+  for ( auto& p: mKFactorDict ) {
+    s.dump(p.first);
+    s.dump(p.second);
+  }
+  SizeType noc = mOperatingConditionsList.size();
+  s.dump(noc);
+  for ( auto& oc: mOperatingConditionsList ) {
+    oc.dump(s);
+  }
+  s.dump(mDefaultOperatingConditionsName);
+}
+
 END_NAMESPACE_YM_CLIB
@@ -16,6 +16,8 @@
 #include "ci/CiBundle.h"
 #include "ci/CiTiming.h"
 #include "ci/CiLutTemplate.h"
+#include "ci/CiWireLoad.h"
+#include "ci/CiWireLoadSelection.h"
 #include "ci/CiLut.h"
 #include "ci/CiPatMgr.h"
 #include "ci/CiPatGraph.h"
@@ -34,6 +36,9 @@ CiCellLibrary::restore(
   istream& is
 )
 {
+  // ShString を生成するので他の読み込み処理と排他制御する．
+  std::lock_guard<std::mutex> lock{reader_mutex()};
+
   Deserializer s{is};
 
   // 要素を復元する．
@@ -97,8 +102,19 @@ CiCellLibrary::_restore(
   // LUTテンプレートのリスト
   s.restore(mLutTemplateList);
 
+  // ワイヤーロード関係の情報
+  restore_wire_load(s);
+
+  // 動作条件関係の情報
+  restore_operating_conditions(s);
+
   // セルのリスト
   s.restore(mCellList);
+  for ( auto& cell: mCellList ) {
+    auto name = cell->_name();
+    mCellDict.emplace(std::string_view{static_cast<const char*>(name)},
+		      cell.get());
+  }
 
   // セルグループのリスト
   s.restore(mCellGroupList);
@@ -117,10 +133,65 @@ CiCellLibrary::_restore(
   s.restore(mLatchClassDict);
 
   // パタングラフの情報の設定
+  // 読み込んだパタングラフを作り直さないように生成済みの印をつける．
+  std::call_once(mPgOnce, [](){});
   mPatMgr.restore(s);
+  mPgStats.pat_num = mPatMgr.pat_num();
+  mPgStats.node_num = mPatMgr.node_num();
 
   // 最終処理
   wrap_up();
 }
 
+// @brief ワイヤーロード関係の情報を読み込む．
+void
+CiCellLibrary::restore_wire_load(
+  Deserializer& s
+)
+{
+  s.restore(mWireLoadList);
+  mWireLoadDict.clear();
+  for ( auto& wl: mWireLoadList ) {
+    auto name = wl->name();
+    mWireLoadDict.emplace(std::string_view{static_cast<const char*>(name)},
+			  wl.get());
+  }
+  s.restore(mWireLoadSelectionList);
+  s.restore(mDefaultWireLoadName);
+  s.restore(mDefaultWireLoadSelectionName);
+  s.restore(mDefaultWireLoadMode);
+  s.restore(mDefaultWireLoadArea);
+  s.restore(mDefaultWireLoadCapacitance);
+  s.restore(mDefaultWireLoadResistance);
+}
+
+// @brief 動作条件関係の情報を読み込む．
+void
+CiCellLibrary::restore_operating_conditions(
+  Deserializer& s
+)
+{
+  s.restore(mNomProcess);
+  s.restore(mNomTemperature);
+  s.restore(mNomVoltage);
+  SizeType nk;
+  s.restore(nk);
+  mKFactorDict.clear();
+  for ( SizeType i = 0; i < nk; ++ i ) {
+    string name;
+    double value;
+    s.restore(name);
+    s.restore(value);
+    mKFactorDict.emplace(name, value);
+  }
+  SizeType noc;
+  s.restore(noc);
+  mOperatingConditionsList.clear();
+  mOperatingConditionsList.resize(noc);
+  for ( auto& oc: mOperatingConditionsList ) {
+    oc.restore(s);
+  }
+  s.restore(mDefaultOperatingConditionsName);
+}
+
 END_NAMESPACE_YM_CLIB
@@ -0,0 +1,125 @@
+/// @file subset.cc
+/// @brief CiCellLibrary の実装ファイル(subset()関係)
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2024 Yusuke Matsunaga
+/// All rights reserved.
+
+#include "ci/CiCellLibrary.h"
+#include "ci/CiCellClass.h"
+#include "ci/CiCellGroup.h"
+#include "ci/CiCell.h"
+#include "ci/CiBusType.h"
+#include "ci/CiLutTemplate.h"
+#include "ci/CiWireLoad.h"
+#include "ci/CiWireLoadSelection.h"
+#include "ci/Serializer.h"
+#include "ci/Deserializer.h"
+#include <sstream>
+
+
+BEGIN_NAMESPACE_YM_CLIB
+
+//////////////////////////////////////////////////////////////////////
+// クラス CiCellLibrary
+//////////////////////////////////////////////////////////////////////
+
+// @brief 指定されたセルのみを含む部分ライブラリを作る．
+CiCellLibrary*
+CiCellLibrary::subset(
+  const vector<string>& cell_names
+) const
+{
+  // 対象のセルを求める．
+  vector<const CiCell*> cell_list;
+  cell_list.reserve(cell_names.size());
+  unordered_set<const CiCell*> cell_set;
+  for ( auto& name: cell_names ) {
+    auto cell = this->cell(std::string_view{name});
+    if ( cell == nullptr ) {
+      ostringstream buf;
+      buf << name << ": No such cell";
+      throw std::invalid_argument{buf.str()};
+    }
+    if ( cell_set.count(cell) == 0 ) {
+      cell_set.emplace(cell);
+      cell_list.push_back(cell);
+    }
+  }
+
+  // 対象のセルとそこから参照されている要素のみをシリアライズして
+  // 新しいライブラリに読み込む．
+  // バスタイプとLUTテンプレートはバスとLUTのシリアライズの際に
+  // 登録される．
+  std::stringstream tmp;
+  {
+    Serializer s{tmp};
+    for ( auto cell: cell_list ) {
+      cell->serialize(s);
+    }
+    // ワイヤーロードはセルに依存しないのですべてコピーする．
+    for ( auto& wl: mWireLoadList ) {
+      wl->serialize(s);
+    }
+    for ( auto& sel: mWireLoadSelectionList ) {
+      sel->serialize(s);
+    }
+    s.dump_obj();
+    auto bustype_list = s.bus_type_list();
+    s.dump(bustype_list);
+    auto templ_list = s.lut_template_list();
+    s.dump(templ_list);
+    dump_wire_load(s);
+    s.dump(cell_list);
+  }
+
+  auto lib = new CiCellLibrary;
+  lib->mName = mName;
+  lib->mTechnology = mTechnology;
+  lib->mBusNamingStyle = mBusNamingStyle;
+  lib->mDate = mDate;
+  lib->mRevision = mRevision;
+  lib->mComment = mComment;
+  lib->mTimeUnit = mTimeUnit;
+  lib->mVoltageUnit = mVoltageUnit;
+  lib->mCurrentUnit = mCurrentUnit;
+  lib->mPullingResistanceUnit = mPullingResistanceUnit;
+  lib->mCapacitiveLoadUnit = mCapacitiveLoadUnit;
+  lib->mCapacitiveLoadUnitStr = mCapacitiveLoadUnitStr;
+  lib->mLeakagePowerUnit = mLeakagePowerUnit;
+  lib->mDelayModel = mDelayModel;
+  lib->mPieceType = mPieceType;
+  lib->mPieceDefine = mPieceDefine;
+  lib->mPgParam = mPgParam;
+  // 動作条件はセルに依存しないのですべてコピーする．
+  lib->mNomProcess = mNomProcess;
+  lib->mNomTemperature = mNomTemperature;
+  lib->mNomVoltage = mNomVoltage;
+  lib->mKFactorDict = mKFactorDict;
+  lib->mOperatingConditionsList = mOperatingConditionsList;
+  lib->mDefaultOperatingConditionsName = mDefaultOperatingConditionsName;
+  {
+    // ShString を生成するので他の読み込み処理と排他制御する．
+    std::lock_guard<std::mutex> lock{reader_mutex()};
+    Deserializer s{tmp};
+    s.deserialize();
+    s.restore(lib->mBusTypeList);
+    s.restore(lib->mLutTemplateList);
+    lib->restore_wire_load(s);
+    s.restore(lib->mCellList);
+  }
+  for ( auto& cell: lib->mCellList ) {
+    auto name = cell->_name();
+    lib->mCellDict.emplace(std::string_view{static_cast<const char*>(name)},
+			   cell.get());
+  }
+
+  // セルグループ/セルクラスを作り直す．
+  // パタングラフは最初に参照された時に作られる．
+  lib->compile();
+  lib->wrap_up();
+
+  return lib;
+}
+
+END_NAMESPACE_YM_CLIB
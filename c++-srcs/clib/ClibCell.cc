@@ -13,6 +13,7 @@
 #include "ym/ClibBundle.h"
 #include "ym/ClibSeqAttr.h"
 #include "ym/ClibTiming.h"
+#include "ym/ClibInternalPower.h"
 #include "ci/CiCell.h"
 #include "ci/CiCellGroup.h"
 #include "ci/CiCellClass.h"
@@ -111,14 +112,24 @@ ClibCell::pin(
 // @brief 名前からピンの取得
 ClibPin
 ClibCell::pin(
-  const string& name
+  std::string_view name
 ) const
 {
   _check_valid();
-  auto pin = _impl()->find_pin(ShString{name});
+  auto pin = _impl()->find_pin(name);
   return ClibPin{_impl(), pin};
 }
 
+// @brief 名前のリストからピン番号のリストを得る．
+vector<SizeType>
+ClibCell::pin_id_list(
+  const vector<string>& name_list
+) const
+{
+  _check_valid();
+  return _impl()->pin_id_list(name_list);
+}
+
 // @brief ピンのリストを返す．
 ClibPinList
 ClibCell::pin_list() const
@@ -366,6 +377,117 @@ ClibCell::timing_list(
   return ClibTimingList{_impl(), timing_list};
 }
 
+// @brief 内部電力の数を返す．
+SizeType
+ClibCell::internal_power_num() const
+{
+  _check_valid();
+  return _impl()->internal_power_num();
+}
+
+// @brief 内部電力を返す．
+ClibInternalPower
+ClibCell::internal_power(
+  SizeType pos
+) const
+{
+  _check_valid();
+  auto ip = _impl()->internal_power(pos);
+  return ClibInternalPower{_impl(), ip};
+}
+
+// @brief 内部電力のリストを返す．
+ClibInternalPowerList
+ClibCell::internal_power_list() const
+{
+  _check_valid();
+  return ClibInternalPowerList{_impl(), _impl()->internal_power_list()};
+}
+
+// @brief セル全体のリーク電力(cell_leakage_power)を返す．
+double
+ClibCell::cell_leakage_power() const
+{
+  _check_valid();
+  return _impl()->cell_leakage_power();
+}
+
+// @brief 条件付きのリーク電力(leakage_power)の数を返す．
+SizeType
+ClibCell::leakage_power_num() const
+{
+  _check_valid();
+  return _impl()->leakage_power_num();
+}
+
+// @brief 条件付きのリーク電力の条件式を返す．
+Expr
+ClibCell::leakage_power_when(
+  SizeType pos
+) const
+{
+  _check_valid();
+  return _impl()->leakage_power_when(pos);
+}
+
+// @brief 条件付きのリーク電力の値を返す．
+double
+ClibCell::leakage_power_value(
+  SizeType pos
+) const
+{
+  _check_valid();
+  return _impl()->leakage_power_value(pos);
+}
+
+// @brief リーク電力の評価に用いる入力数を返す．
+SizeType
+ClibCell::leakage_input_num() const
+{
+  _check_valid();
+  return _impl()->leakage_input_num();
+}
+
+// @brief 条件付きのリーク電力の条件式を真理値表のビットマスクで返す．
+vector<std::uint64_t>
+ClibCell::leakage_power_when_mask(
+  SizeType pos
+) const
+{
+  _check_valid();
+  return _impl()->leakage_power_when_mask(pos);
+}
+
+// @brief 入力状態に対するリーク電力を返す．
+double
+ClibCell::calc_leakage_power(
+  std::uint64_t state
+) const
+{
+  _check_valid();
+  return _impl()->calc_leakage_power(state);
+}
+
+// @brief 入力状態のリストに対するリーク電力のリストを返す．
+vector<double>
+ClibCell::calc_leakage_power_list(
+  const vector<std::uint64_t>& state_list
+) const
+{
+  _check_valid();
+  return _impl()->calc_leakage_power_list(state_list);
+}
+
+// @brief 入力の信号確率に対するリーク電力の期待値を返す．
+double
+ClibCell::calc_average_leakage_power(
+  const vector<double>& prob_list
+) const
+{
+  _check_valid();
+  return _impl()->calc_average_leakage_power(prob_list);
+}
+
 // @brief セルの種類を返す．
 ClibCellType
 ClibCell::type() const
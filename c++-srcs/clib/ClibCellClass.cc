@@ -8,7 +8,10 @@
 
 #include "ym/ClibCellClass.h"
 #include "ym/ClibCellGroup.h"
+#include "ym/ClibCell.h"
 #include "ci/CiCellClass.h"
+#include "ci/CiCellGroup.h"
+#include "ci/CiCell.h"
 #include "ci/CiCellLibrary.h"
 
 
@@ -90,4 +93,70 @@ ClibCellClass::cell_group_list() const
   return ClibCellGroupList{group_list};
 }
 
+// @brief 全グループのセル数の総和を返す．
+SizeType
+ClibCellClass::cell_num() const
+{
+  _check_valid();
+  return mImpl->sorted_cell_list(ClibCellOrder::Area).size();
+}
+
+// @brief 指定された基準で昇順に並べたセルのリストを返す．
+ClibCellList
+ClibCellClass::sorted_cell_list(
+  ClibCellOrder order
+) const
+{
+  _check_valid();
+  auto& cell_list = mImpl->sorted_cell_list(order);
+  return ClibCellList{cell_list};
+}
+
+// @brief 指定された基準で昇順に並べた時の pos 番目のセルを返す．
+ClibCell
+ClibCellClass::sorted_cell(
+  ClibCellOrder order,
+  SizeType pos
+) const
+{
+  _check_valid();
+  auto& cell_list = mImpl->sorted_cell_list(order);
+  if ( pos < 0 || cell_list.size() <= pos ) {
+    throw std::out_of_range{"pos is out of range"};
+  }
+  return ClibCell{cell_list[pos]};
+}
+
+// @brief 指定された基準で一つ後ろ(値の大きい方)のセルを返す．
+ClibCell
+ClibCellClass::next_cell(
+  const ClibCell& cell,
+  ClibCellOrder order
+) const
+{
+  _check_valid();
+  cell._check_valid();
+  auto cell_impl = cell._impl();
+  if ( cell_impl->group()->rep_class() != mImpl ) {
+    throw std::invalid_argument{"cell is not a member of this class"};
+  }
+  return ClibCell{mImpl->next_cell(cell_impl, order)};
+}
+
+// @brief 指定された基準で一つ前(値の小さい方)のセルを返す．
+ClibCell
+ClibCellClass::prev_cell(
+  const ClibCell& cell,
+  ClibCellOrder order
+) const
+{
+  _check_valid();
+  cell._check_valid();
+  auto cell_impl = cell._impl();
+  if ( cell_impl->group()->rep_class() != mImpl ) {
+    throw std::invalid_argument{"cell is not a member of this class"};
+  }
+  return ClibCell{mImpl->prev_cell(cell_impl, order)};
+}
+
 END_NAMESPACE_YM_CLIB
@@ -11,6 +11,7 @@
 #include "ym/ClibCellClass.h"
 #include "ci/CiCellGroup.h"
 #include "ci/CiCellClass.h"
+#include "ci/CiCell.h"
 #include "ci/CiCellLibrary.h"
 
 
@@ -83,4 +84,62 @@ ClibCellGroup::cell_list() const
   return ClibCellList{cell_list};
 }
 
+// @brief 指定された基準で昇順に並べたセルのリストを返す．
+ClibCellList
+ClibCellGroup::sorted_cell_list(
+  ClibCellOrder order
+) const
+{
+  _check_valid();
+  auto& cell_list = mImpl->sorted_cell_list(order);
+  return ClibCellList{cell_list};
+}
+
+// @brief 指定された基準で昇順に並べた時の pos 番目のセルを返す．
+ClibCell
+ClibCellGroup::sorted_cell(
+  ClibCellOrder order,
+  SizeType pos
+) const
+{
+  _check_valid();
+  auto& cell_list = mImpl->sorted_cell_list(order);
+  if ( pos < 0 || cell_list.size() <= pos ) {
+    throw std::out_of_range{"pos is out of range"};
+  }
+  return ClibCell{cell_list[pos]};
+}
+
+// @brief 指定された基準で一つ後ろ(値の大きい方)のセルを返す．
+ClibCell
+ClibCellGroup::next_cell(
+  const ClibCell& cell,
+  ClibCellOrder order
+) const
+{
+  _check_valid();
+  cell._check_valid();
+  auto cell_impl = cell._impl();
+  if ( cell_impl->group() != mImpl ) {
+    throw std::invalid_argument{"cell is not a member of this group"};
+  }
+  return ClibCell{mImpl->next_cell(cell_impl, order)};
+}
+
+// @brief 指定された基準で一つ前(値の小さい方)のセルを返す．
+ClibCell
+ClibCellGroup::prev_cell(
+  const ClibCell& cell,
+  ClibCellOrder order
+) const
+{
+  _check_valid();
+  cell._check_valid();
+  auto cell_impl = cell._impl();
+  if ( cell_impl->group() != mImpl ) {
+    throw std::invalid_argument{"cell is not a member of this group"};
+  }
+  return ClibCell{mImpl->prev_cell(cell_impl, order)};
+}
+
 END_NAMESPACE_YM_CLIB
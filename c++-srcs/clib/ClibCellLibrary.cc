@@ -12,13 +12,61 @@
 #include "ym/ClibCellClass.h"
 #include "ym/ClibCellGroup.h"
 #include "ym/ClibPatGraph.h"
+#include "ym/ClibWireLoad.h"
+#include "ym/ClibOperatingConditions.h"
 #include "ym/ClibSeqAttr.h"
+#include "ym/ClibIOMap.h"
+#include "ym/Expr.h"
+#include "ym/TvFunc.h"
 #include "ci/CiCellLibrary.h"
+#include "ci/CiWireLoad.h"
+#include "ci/CiWireLoadSelection.h"
+#include "ci/CiOperatingConditions.h"
 #include "Writer.h"
+#include "LibertyWriter.h"
+#include "TimingTableWriter.h"
+#include "LibraryDiff.h"
+#include <atomic>
+#include <cstdlib>
+#include <exception>
+#include <mutex>
+#include <thread>
 
 
 BEGIN_NAMESPACE_YM_CLIB
 
+BEGIN_NONAMESPACE
+
+// 計測結果の出力先を指定する環境変数名
+const char* LOAD_PROFILE_ENV = "YMCELL_LOAD_PROFILE";
+
+// 計測結果を JSON 形式で1行追記する．
+//
+// path が "-" の場合は標準エラー出力に出力する．
+void
+append_profile(
+  const string& path,
+  const ClibLoadProfile& profile
+)
+{
+  // read_liberty_many() から並行して呼ばれる場合があるので
+  // 出力が混ざらないように排他制御を行う．
+  static std::mutex mtx;
+  std::lock_guard<std::mutex> lock{mtx};
+  if ( path == "-" ) {
+    profile.write_json(std::cerr);
+    std::cerr << endl;
+    return;
+  }
+  ofstream fout{path, std::ios::app};
+  if ( fout ) {
+    profile.write_json(fout);
+    fout << endl;
+  }
+}
+
+END_NONAMESPACE
+
 //////////////////////////////////////////////////////////////////////
 // クラス ClibCellLibrary
 //////////////////////////////////////////////////////////////////////
@@ -26,25 +74,115 @@ BEGIN_NAMESPACE_YM_CLIB
 // @brief mislib 形式のファイルを読み込んでライブラリに設定する．
 ClibCellLibrary
 ClibCellLibrary::read_mislib(
-  const string& filename
+  const string& filename,
+  const ClibPatGenParam& param
 )
 {
   ClibCellLibrary lib;
-  lib.mImpl = CiCellLibrary::read_mislib(filename);
+  lib.mImpl = CiCellLibrary::read_mislib(filename, param);
   return lib;
 }
 
 // @brief liberty 形式のファイルを読み込んでライブラリに設定する．
 ClibCellLibrary
 ClibCellLibrary::read_liberty(
-  const string& filename
+  const string& filename,
+  const ClibPatGenParam& param
 )
 {
+  auto path = std::getenv(LOAD_PROFILE_ENV);
+  if ( path != nullptr && path[0] != '\0' ) {
+    ClibLoadProfile profile;
+    auto lib = read_liberty(filename, param, profile);
+    append_profile(path, profile);
+    return lib;
+  }
+
   ClibCellLibrary lib;
-  lib.mImpl = CiCellLibrary::read_liberty(filename);
+  lib.mImpl = CiCellLibrary::read_liberty(filename, param);
   return lib;
 }
 
+// @brief liberty 形式のファイルを読み込んで各フェーズを計測する．
+ClibCellLibrary
+ClibCellLibrary::read_liberty(
+  const string& filename,
+  const ClibPatGenParam& param,
+  ClibLoadProfile& profile
+)
+{
+  ClibCellLibrary lib;
+  lib.mImpl = CiCellLibrary::read_liberty(filename, param, &profile);
+  return lib;
+}
+
+// @brief 複数の liberty 形式のファイルをそれぞれ別のライブラリとして読み込む．
+vector<ClibCellLibrary>
+ClibCellLibrary::read_liberty_many(
+  const vector<string>& filename_list,
+  const ClibPatGenParam& param,
+  SizeType thread_num
+)
+{
+  auto n = filename_list.size();
+  vector<ClibCellLibrary> lib_list(n);
+  vector<std::exception_ptr> error_list(n);
+  std::atomic<SizeType> next{0};
+  auto worker = [&]() {
+    for ( ; ; ) {
+      SizeType pos = next ++;
+      if ( pos >= n ) {
+	break;
+      }
+      try {
+	lib_list[pos] = read_liberty(filename_list[pos], param);
+      }
+      catch ( ... ) {
+	error_list[pos] = std::current_exception();
+      }
+    }
+  };
+  if ( thread_num == 0 ) {
+    thread_num = std::thread::hardware_concurrency();
+  }
+  if ( thread_num > n ) {
+    thread_num = n;
+  }
+  if ( thread_num <= 1 ) {
+    worker();
+  }
+  else {
+    vector<std::thread> thread_list;
+    thread_list.reserve(thread_num);
+    for ( SizeType i = 0; i < thread_num; ++ i ) {
+      thread_list.emplace_back(worker);
+    }
+    for ( auto& th: thread_list ) {
+      th.join();
+    }
+  }
+
+  for ( auto& error: error_list ) {
+    if ( error ) {
+      std::rethrow_exception(error);
+    }
+  }
+  return lib_list;
+}
+
+// @brief 指定されたセルのみを含む部分ライブラリを作る．
+ClibCellLibrary
+ClibCellLibrary::subset(
+  const vector<string>& cell_names
+) const
+{
+  if ( mImpl ) {
+    auto impl = mImpl->subset(cell_names);
+    return ClibCellLibrary{impl};
+  }
+  return {};
+}
+
 // @brief 名前の取得
 string
 ClibCellLibrary::name() const
@@ -224,6 +362,260 @@ ClibCellLibrary::leakage_power_unit() const
   return {};
 }
 
+// @brief ワイヤーロード数の取得
+SizeType
+ClibCellLibrary::wire_load_num() const
+{
+  if ( mImpl ) {
+    return mImpl->wire_load_num();
+  }
+  // デフォルト値
+  return 0;
+}
+
+// @brief ワイヤーロードの取得
+ClibWireLoad
+ClibCellLibrary::wire_load(
+  SizeType id
+) const
+{
+  if ( mImpl ) {
+    if ( id >= mImpl->wire_load_num() ) {
+      throw std::out_of_range{"id is out of range"};
+    }
+    return ClibWireLoad{mImpl, id};
+  }
+  // デフォルト値
+  return {};
+}
+
+// @brief 名前からワイヤーロードを取得する．
+ClibWireLoad
+ClibCellLibrary::wire_load(
+  std::string_view name
+) const
+{
+  if ( mImpl ) {
+    auto wl = mImpl->wire_load(name);
+    if ( wl != nullptr ) {
+      return ClibWireLoad{mImpl, wl->id()};
+    }
+  }
+  // デフォルト値
+  return {};
+}
+
+// @brief デフォルトのワイヤーロードを返す．
+ClibWireLoad
+ClibCellLibrary::default_wire_load() const
+{
+  if ( mImpl ) {
+    auto wl = mImpl->default_wire_load();
+    if ( wl != nullptr ) {
+      return ClibWireLoad{mImpl, wl->id()};
+    }
+  }
+  // デフォルト値
+  return {};
+}
+
+// @brief 面積からワイヤーロードを選ぶ．
+ClibWireLoad
+ClibCellLibrary::select_wire_load(
+  double area
+) const
+{
+  if ( mImpl ) {
+    auto wl = mImpl->select_wire_load(area);
+    if ( wl != nullptr ) {
+      return ClibWireLoad{mImpl, wl->id()};
+    }
+  }
+  // デフォルト値
+  return {};
+}
+
+// @brief 指定したワイヤーロードセレクションを用いてワイヤーロードを選ぶ．
+ClibWireLoad
+ClibCellLibrary::select_wire_load(
+  double area,
+  std::string_view selection_name
+) const
+{
+  if ( mImpl ) {
+    auto sel = mImpl->wire_load_selection(selection_name);
+    if ( sel == nullptr ) {
+      ostringstream buf;
+      buf << selection_name << ": No such wire_load_selection";
+      throw std::invalid_argument{buf.str()};
+    }
+    auto wl = sel->select(area);
+    if ( wl != nullptr ) {
+      return ClibWireLoad{mImpl, wl->id()};
+    }
+  }
+  // デフォルト値
+  return {};
+}
+
+// @brief ワイヤーロードセレクション数の取得
+SizeType
+ClibCellLibrary::wire_load_selection_num() const
+{
+  if ( mImpl ) {
+    return mImpl->wire_load_selection_num();
+  }
+  // デフォルト値
+  return 0;
+}
+
+// @brief 'default_wire_load_mode' の取得
+string
+ClibCellLibrary::default_wire_load_mode() const
+{
+  if ( mImpl ) {
+    return mImpl->default_wire_load_mode();
+  }
+  // デフォルト値
+  return {};
+}
+
+// @brief 'default_wire_load_area' の取得
+double
+ClibCellLibrary::default_wire_load_area() const
+{
+  if ( mImpl ) {
+    return mImpl->default_wire_load_area();
+  }
+  // デフォルト値
+  return 0.0;
+}
+
+// @brief 'default_wire_load_capacitance' の取得
+double
+ClibCellLibrary::default_wire_load_capacitance() const
+{
+  if ( mImpl ) {
+    return mImpl->default_wire_load_capacitance();
+  }
+  // デフォルト値
+  return 0.0;
+}
+
+// @brief 'default_wire_load_resistance' の取得
+double
+ClibCellLibrary::default_wire_load_resistance() const
+{
+  if ( mImpl ) {
+    return mImpl->default_wire_load_resistance();
+  }
+  // デフォルト値
+  return 0.0;
+}
+
+// @brief 'nom_process' の取得
+double
+ClibCellLibrary::nom_process() const
+{
+  if ( mImpl ) {
+    return mImpl->nom_process();
+  }
+  // デフォルト値
+  return 0.0;
+}
+
+// @brief 'nom_temperature' の取得
+double
+ClibCellLibrary::nom_temperature() const
+{
+  if ( mImpl ) {
+    return mImpl->nom_temperature();
+  }
+  // デフォルト値
+  return 0.0;
+}
+
+// @brief 'nom_voltage' の取得
+double
+ClibCellLibrary::nom_voltage() const
+{
+  if ( mImpl ) {
+    return mImpl->nom_voltage();
+  }
+  // デフォルト値
+  return 0.0;
+}
+
+// @brief k_process_XXX/k_temp_XXX/k_volt_XXX の値を返す．
+double
+ClibCellLibrary::k_factor(
+  const string& name
+) const
+{
+  if ( mImpl ) {
+    return mImpl->k_factor(name);
+  }
+  // デフォルト値
+  return 0.0;
+}
+
+// @brief 動作条件数の取得
+SizeType
+ClibCellLibrary::operating_conditions_num() const
+{
+  if ( mImpl ) {
+    return mImpl->operating_conditions_num();
+  }
+  // デフォルト値
+  return 0;
+}
+
+// @brief 動作条件の取得
+ClibOperatingConditions
+ClibCellLibrary::operating_conditions(
+  SizeType id
+) const
+{
+  if ( mImpl ) {
+    if ( id >= mImpl->operating_conditions_num() ) {
+      throw std::out_of_range{"id is out of range"};
+    }
+    return ClibOperatingConditions{mImpl, id};
+  }
+  // デフォルト値
+  return {};
+}
+
+// @brief 名前から動作条件を取得する．
+ClibOperatingConditions
+ClibCellLibrary::operating_conditions(
+  std::string_view name
+) const
+{
+  if ( mImpl ) {
+    auto oc = mImpl->operating_conditions(name);
+    if ( oc != nullptr ) {
+      return ClibOperatingConditions{mImpl, oc->id()};
+    }
+  }
+  // デフォルト値
+  return {};
+}
+
+// @brief デフォルトの動作条件を返す．
+ClibOperatingConditions
+ClibCellLibrary::default_operating_conditions() const
+{
+  if ( mImpl ) {
+    auto oc = mImpl->default_operating_conditions();
+    if ( oc != nullptr ) {
+      return ClibOperatingConditions{mImpl, oc->id()};
+    }
+  }
+  // デフォルト値
+  return {};
+}
+
 // @brief このライブラリの持つセル数の取得
 SizeType
 ClibCellLibrary::cell_num() const
@@ -252,7 +644,7 @@ ClibCellLibrary::cell(
 // @brief 名前からのセルの取得
 ClibCell
 ClibCellLibrary::cell(
-  const string& name
+  std::string_view name
 ) const
 {
   if ( mImpl ) {
@@ -274,6 +666,19 @@ ClibCellLibrary::cell_list() const
   return {};
 }
 
+// @brief 名前のリストからセルのリストを得る．
+ClibCellList
+ClibCellLibrary::cell_list(
+  const vector<string>& name_list
+) const
+{
+  if ( mImpl ) {
+    return ClibCellList{mImpl->cell_list(name_list)};
+  }
+  // エラー
+  return {};
+}
+
 // @brief セルグループ数の取得
 SizeType
 ClibCellLibrary::cell_group_num() const
@@ -514,6 +919,54 @@ ClibCellLibrary::find_latch_class(
   return {};
 }
 
+// @brief 論理関数に一致するセルグループを返す．
+ClibCellGroup
+ClibCellLibrary::find_logic_group(
+  const TvFunc& func
+) const
+{
+  if ( mImpl ) {
+    return ClibCellGroup{mImpl->find_logic_group(func)};
+  }
+  // デフォルト値
+  return {};
+}
+
+// @brief 論理式に一致するセルグループを返す．
+ClibCellGroup
+ClibCellLibrary::find_logic_group(
+  const Expr& expr,
+  SizeType ni
+) const
+{
+  return find_logic_group(expr.to_tv(ni));
+}
+
+// @brief 論理関数と NPN 同値なセルクラスを返す．
+ClibCellClass
+ClibCellLibrary::find_logic_class(
+  const TvFunc& func,
+  ClibIOMap& iomap
+) const
+{
+  if ( mImpl ) {
+    return ClibCellClass{mImpl->find_logic_class(func, iomap)};
+  }
+  // デフォルト値
+  return {};
+}
+
+// @brief パタングラフ生成の統計情報を返す．
+ClibPatGenStats
+ClibCellLibrary::pg_stats() const
+{
+  if ( mImpl ) {
+    return mImpl->pg_stats();
+  }
+  // デフォルト値
+  return {};
+}
+
 // @brief 総パタン数を返す．
 SizeType
 ClibCellLibrary::pg_pat_num() const
@@ -663,16 +1116,119 @@ ClibCellLibrary::pg_edge_inv(
   return false;
 }
 
+// @brief ノードの深さを返す．
+SizeType
+ClibCellLibrary::pg_node_depth(
+  SizeType id
+) const
+{
+  if ( mImpl ) {
+    return mImpl->pg_node_depth(id);
+  }
+  // デフォルト値
+  return 0;
+}
+
+// @brief パタンの最大の深さを返す．
+SizeType
+ClibCellLibrary::pg_max_depth() const
+{
+  if ( mImpl ) {
+    return mImpl->pg_max_depth();
+  }
+  // デフォルト値
+  return 0;
+}
+
+BEGIN_NONAMESPACE
+
+// 空のパタン番号のリスト
+const vector<SizeType> empty_pat_list;
+
+END_NONAMESPACE
+
+// @brief 根の種類，深さ，入力数からパタン番号のリストを返す．
+const vector<SizeType>&
+ClibCellLibrary::pg_pat_list(
+  ClibPatType root_type,
+  SizeType depth,
+  SizeType input_num
+) const
+{
+  if ( mImpl ) {
+    return mImpl->pg_pat_list(root_type, depth, input_num);
+  }
+  // デフォルト値
+  return empty_pat_list;
+}
+
+// @brief 論理関数と NPN 同値なパタン番号のリストを返す．
+const vector<SizeType>&
+ClibCellLibrary::pg_pat_list(
+  const TvFunc& func
+) const
+{
+  ClibIOMap iomap;
+  return pg_pat_list(func, iomap);
+}
+
+// @brief 論理関数と NPN 同値なパタン番号のリストを返す．
+const vector<SizeType>&
+ClibCellLibrary::pg_pat_list(
+  const TvFunc& func,
+  ClibIOMap& iomap
+) const
+{
+  if ( mImpl ) {
+    return mImpl->pg_pat_list(func, iomap);
+  }
+  // デフォルト値
+  return empty_pat_list;
+}
+
 // @brief 内容を出力する．
 void
 ClibCellLibrary::display(
-  ostream& s
+  ostream& s,
+  SizeType thread_num
 ) const
 {
   Writer writer{*this};
+  writer.run(s, thread_num);
+}
+
+// @brief 内容を liberty 形式で出力する．
+void
+ClibCellLibrary::write_liberty(
+  ostream& s,
+  SizeType thread_num
+) const
+{
+  LibertyWriter writer{*this};
+  writer.run(s, thread_num);
+}
+
+// @brief タイミング情報の LUT を列指向のバイナリ形式で出力する．
+void
+ClibCellLibrary::write_timing_table(
+  ostream& s
+) const
+{
+  TimingTableWriter writer{*this};
   writer.run(s);
 }
 
+// @brief 内容の差分を求める．
+vector<ClibDiffItem>
+ClibCellLibrary::diff(
+  const ClibCellLibrary& right,
+  const ClibDiffParam& param
+) const
+{
+  LibraryDiff differ{*this, right, param};
+  return differ.run();
+}
+
 // @brief 内容をバイナリダンプする．
 void
 ClibCellLibrary::dump(
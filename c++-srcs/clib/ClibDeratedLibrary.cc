@@ -0,0 +1,196 @@
+/// @file ClibDeratedLibrary.cc
+/// @brief ClibDeratedLibrary の実装ファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2024 Yusuke Matsunaga
+/// All rights reserved.
+
+#include "ym/ClibDeratedLibrary.h"
+#include "ym/ClibOperatingConditions.h"
+#include "ym/ClibCell.h"
+#include "ym/ClibPin.h"
+#include "ym/ClibTiming.h"
+#include "ym/ClibInternalPower.h"
+#include "ym/ClibLut.h"
+#include "ym/ClibCapacitance.h"
+#include "ym/Range.h"
+#include "LutGrid.h"
+
+
+BEGIN_NAMESPACE_YM_CLIB
+
+//////////////////////////////////////////////////////////////////////
+// クラス ClibDeratedLibrary
+//////////////////////////////////////////////////////////////////////
+
+// @brief 動作条件の値を指定したコンストラクタ
+ClibDeratedLibrary::ClibDeratedLibrary(
+  const ClibCellLibrary& library,
+  double process,
+  double voltage,
+  double temperature
+) : mLibrary{library},
+    mProcess{process},
+    mVoltage{voltage},
+    mTemperature{temperature}
+{
+  // 補正係数は LUT の種類ごとに一度だけ求めておく．
+  double cell_rise = factor("cell_rise");
+  double cell_fall = factor("cell_fall");
+  double rise_transition = factor("rise_transition");
+  double fall_transition = factor("fall_transition");
+  double rise_propagation = factor("rise_propagation");
+  double fall_propagation = factor("fall_propagation");
+  double internal_power = factor("internal_power");
+  mPinCapFactor = factor("pin_cap");
+  mLeakageFactor = factor("cell_leakage_power");
+
+  // 同一のタイミングは複数の入力ピンで共有されているので
+  // 一度処理した LUT は add_lut() でスキップされる．
+  for ( auto cell: mLibrary.cell_list() ) {
+    for ( auto ipos: Range(cell.input2_num()) ) {
+      for ( auto opos: Range(cell.output2_num()) ) {
+	for ( auto sense: {ClibTimingSense::positive_unate,
+			   ClibTimingSense::negative_unate} ) {
+	  for ( auto timing: cell.timing_list(ipos, opos, sense) ) {
+	    add_lut(timing.cell_rise(), cell_rise);
+	    add_lut(timing.cell_fall(), cell_fall);
+	    add_lut(timing.rise_transition(), rise_transition);
+	    add_lut(timing.fall_transition(), fall_transition);
+	    add_lut(timing.rise_propagation(), rise_propagation);
+	    add_lut(timing.fall_propagation(), fall_propagation);
+	  }
+	}
+      }
+    }
+    for ( auto ipower: cell.internal_power_list() ) {
+      add_lut(ipower.rise_power(), internal_power);
+      add_lut(ipower.fall_power(), internal_power);
+    }
+  }
+}
+
+// @brief 動作条件を指定したコンストラクタ
+ClibDeratedLibrary::ClibDeratedLibrary(
+  const ClibCellLibrary& library,
+  const ClibOperatingConditions& op_cond
+) : ClibDeratedLibrary{library,
+		       op_cond.process(),
+		       op_cond.voltage(),
+		       op_cond.temperature()}
+{
+}
+
+// @brief 補正係数を返す．
+double
+ClibDeratedLibrary::factor(
+  const string& name
+) const
+{
+  auto dp = mProcess - mLibrary.nom_process();
+  auto dt = mTemperature - mLibrary.nom_temperature();
+  auto dv = mVoltage - mLibrary.nom_voltage();
+  auto kp = mLibrary.k_factor("k_process_" + name);
+  auto kt = mLibrary.k_factor("k_temp_" + name);
+  auto kv = mLibrary.k_factor("k_volt_" + name);
+  return (1.0 + kp * dp) * (1.0 + kt * dt) * (1.0 + kv * dv);
+}
+
+// @brief 補正後の LUT の格子点の値を返す．
+double
+ClibDeratedLibrary::grid_value(
+  const ClibLut& lut,
+  const vector<SizeType>& pos_array
+) const
+{
+  auto offset = lut_offset(lut);
+  auto pos = LutGrid::grid_pos(lut, pos_array);
+  return mLutValues[offset + pos];
+}
+
+// @brief 補正後の LUT の値を返す．
+double
+ClibDeratedLibrary::value(
+  const ClibLut& lut,
+  const vector<double>& val_array
+) const
+{
+  auto offset = lut_offset(lut);
+  LutGrid::Weight weight_list[LutGrid::MAX_WEIGHT];
+  auto num = LutGrid::weights(lut, val_array, weight_list);
+  double ans = 0.0;
+  for ( SizeType k = 0; k < num; ++ k ) {
+    auto& gw = weight_list[k];
+    ans += gw.weight * mLutValues[offset + gw.pos];
+  }
+  return ans;
+}
+
+// @brief 補正後のピンの負荷容量を返す．
+ClibCapacitance
+ClibDeratedLibrary::capacitance(
+  const ClibPin& pin
+) const
+{
+  return ClibCapacitance{pin.capacitance().value() * mPinCapFactor};
+}
+
+// @brief 補正後のピンの立ち上がり時の負荷容量を返す．
+ClibCapacitance
+ClibDeratedLibrary::rise_capacitance(
+  const ClibPin& pin
+) const
+{
+  return ClibCapacitance{pin.rise_capacitance().value() * mPinCapFactor};
+}
+
+// @brief 補正後のピンの立ち下がり時の負荷容量を返す．
+ClibCapacitance
+ClibDeratedLibrary::fall_capacitance(
+  const ClibPin& pin
+) const
+{
+  return ClibCapacitance{pin.fall_capacitance().value() * mPinCapFactor};
+}
+
+// @brief 補正後のセル全体のリーク電力を返す．
+double
+ClibDeratedLibrary::cell_leakage_power(
+  const ClibCell& cell
+) const
+{
+  return cell.cell_leakage_power() * mLeakageFactor;
+}
+
+// @brief 補正後の LUT の値を追加する．
+void
+ClibDeratedLibrary::add_lut(
+  const ClibLut& lut,
+  double factor
+)
+{
+  if ( !lut.is_valid() || mLutDict.count(lut._impl()) > 0 ) {
+    return;
+  }
+  auto offset = mLutValues.size();
+  mLutDict.emplace(lut._impl(), offset);
+  LutGrid::append_values(lut, mLutValues);
+  for ( auto k = offset; k < mLutValues.size(); ++ k ) {
+    mLutValues[k] *= factor;
+  }
+}
+
+// @brief LUT の値の先頭位置を返す．
+SizeType
+ClibDeratedLibrary::lut_offset(
+  const ClibLut& lut
+) const
+{
+  auto p = mLutDict.find(lut._impl());
+  if ( p == mLutDict.end() ) {
+    throw std::invalid_argument{"lut does not belong to this library"};
+  }
+  return p->second;
+}
+
+END_NAMESPACE_YM_CLIB
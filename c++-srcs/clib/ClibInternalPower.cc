@@ -0,0 +1,109 @@
+/// @file ClibInternalPower.cc
+/// @brief ClibInternalPower の実装ファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2024 Yusuke Matsunaga
+/// All rights reserved.
+
+#include "ym/ClibInternalPower.h"
+#include "ym/ClibPin.h"
+#include "ym/ClibLut.h"
+#include "ci/CiInternalPower.h"
+#include "ci/CiCellLibrary.h"
+
+
+BEGIN_NAMESPACE_YM_CLIB
+
+//////////////////////////////////////////////////////////////////////
+// クラス ClibInternalPower
+//////////////////////////////////////////////////////////////////////
+
+// @brief 対象のピンを返す．
+ClibPin
+ClibInternalPower::pin() const
+{
+  _check_valid();
+  return ClibPin{_cell(), _impl()->pin()};
+}
+
+// @brief 関連するピンを返す．
+ClibPin
+ClibInternalPower::related_pin() const
+{
+  _check_valid();
+  return ClibPin{_cell(), _impl()->related_pin()};
+}
+
+// @brief 条件式を返す．
+Expr
+ClibInternalPower::when() const
+{
+  _check_valid();
+  return _impl()->when();
+}
+
+// @brief 立ち上がり時のエネルギーテーブルを返す．
+ClibLut
+ClibInternalPower::rise_power() const
+{
+  _check_valid();
+  return ClibLut{_cell(), _impl()->rise_power()};
+}
+
+// @brief 立ち下がり時のエネルギーテーブルを返す．
+ClibLut
+ClibInternalPower::fall_power() const
+{
+  _check_valid();
+  return ClibLut{_cell(), _impl()->fall_power()};
+}
+
+// @brief 立ち上がり時のエネルギーを計算する．
+double
+ClibInternalPower::calc_rise_energy(
+  ClibTime input_transition,
+  ClibCapacitance output_capacitance
+) const
+{
+  _check_valid();
+  return _impl()->calc_rise_energy(input_transition.value(),
+				   output_capacitance.value());
+}
+
+// @brief 立ち下がり時のエネルギーを計算する．
+double
+ClibInternalPower::calc_fall_energy(
+  ClibTime input_transition,
+  ClibCapacitance output_capacitance
+) const
+{
+  _check_valid();
+  return _impl()->calc_fall_energy(input_transition.value(),
+				   output_capacitance.value());
+}
+
+// @brief 立ち上がり時のエネルギーをまとめて計算する．
+vector<double>
+ClibInternalPower::calc_rise_energy_list(
+  const vector<double>& input_transition_list,
+  const vector<double>& output_capacitance_list
+) const
+{
+  _check_valid();
+  return _impl()->calc_rise_energy_list(input_transition_list,
+					output_capacitance_list);
+}
+
+// @brief 立ち下がり時のエネルギーをまとめて計算する．
+vector<double>
+ClibInternalPower::calc_fall_energy_list(
+  const vector<double>& input_transition_list,
+  const vector<double>& output_capacitance_list
+) const
+{
+  _check_valid();
+  return _impl()->calc_fall_energy_list(input_transition_list,
+					output_capacitance_list);
+}
+
+END_NAMESPACE_YM_CLIB
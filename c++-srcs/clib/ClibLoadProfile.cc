@@ -0,0 +1,111 @@
+/// @file ClibLoadProfile.cc
+/// @brief ClibLoadProfile の実装ファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2024 Yusuke Matsunaga
+/// All rights reserved.
+
+#include "ym/ClibLoadProfile.h"
+#include <iomanip>
+#include <limits>
+
+
+BEGIN_NAMESPACE_YM_CLIB
+
+BEGIN_NONAMESPACE
+
+// JSON の文字列を出力する．
+void
+write_json_string(
+  ostream& s,
+  const string& str
+)
+{
+  s << '"';
+  for ( unsigned char c: str ) {
+    switch ( c ) {
+    case '"':  s << "\\\""; break;
+    case '\\': s << "\\\\"; break;
+    case '\n': s << "\\n"; break;
+    case '\r': s << "\\r"; break;
+    case '\t': s << "\\t"; break;
+    default:
+      if ( c < 0x20 ) {
+	s << "\\u" << std::hex << std::setw(4) << std::setfill('0')
+	  << static_cast<int>(c)
+	  << std::dec << std::setfill(' ');
+      }
+      else {
+	s << c;
+      }
+    }
+  }
+  s << '"';
+}
+
+END_NONAMESPACE
+
+//////////////////////////////////////////////////////////////////////
+// クラス ClibLoadProfile
+//////////////////////////////////////////////////////////////////////
+
+// @brief 全フェーズの経過時間の和を返す．
+double
+ClibLoadProfile::total_time() const
+{
+  double ans = 0.0;
+  for ( auto& phase: phase_list ) {
+    ans += phase.wall_time;
+  }
+  return ans;
+}
+
+// @brief 最大常駐メモリ量(バイト)を返す．
+SizeType
+ClibLoadProfile::peak_rss() const
+{
+  SizeType ans = 0;
+  for ( auto& phase: phase_list ) {
+    ans = std::max(ans, phase.peak_rss);
+  }
+  return ans;
+}
+
+// @brief 内容を JSON 形式で出力する．
+void
+ClibLoadProfile::write_json(
+  ostream& s
+) const
+{
+  auto old_prec = s.precision(std::numeric_limits<double>::max_digits10);
+  s << "{\"filename\": ";
+  write_json_string(s, filename);
+  s << ", \"total_time\": " << total_time()
+    << ", \"peak_rss\": " << peak_rss()
+    << ", \"phases\": [";
+  const char* comma = "";
+  for ( auto& phase: phase_list ) {
+    s << comma
+      << "{\"name\": ";
+    write_json_string(s, phase.name);
+    s << ", \"wall_time\": " << phase.wall_time
+      << ", \"bytes\": " << phase.bytes
+      << ", \"objects\": " << phase.object_num
+      << ", \"peak_rss\": " << phase.peak_rss
+      << "}";
+    comma = ", ";
+  }
+  s << "]}";
+  s.precision(old_prec);
+}
+
+// @brief 内容を JSON 形式の文字列で返す．
+string
+ClibLoadProfile::json() const
+{
+  ostringstream buf;
+  write_json(buf);
+  return buf.str();
+}
+
+END_NAMESPACE_YM_CLIB
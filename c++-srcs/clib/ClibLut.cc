@@ -86,4 +86,58 @@ ClibLut::value(
   return _impl()->value(val_array);
 }
 
+// @brief 値をまとめて計算する．
+vector<double>
+ClibLut::value_list(
+  const vector<vector<double>>& input_list
+) const
+{
+  _check_valid();
+  SizeType d = dimension();
+  if ( input_list.size() != d ) {
+    throw std::invalid_argument{"input_list.size() should be equal to dimension()"};
+  }
+  SizeType n = d > 0 ? input_list[0].size() : 0;
+  const double* src_list[3];
+  for ( SizeType i = 0; i < d; ++ i ) {
+    if ( input_list[i].size() != n ) {
+      throw std::invalid_argument{"all elements of input_list should have the same size"};
+    }
+    src_list[i] = input_list[i].data();
+  }
+  vector<double> output_list(n);
+  _impl()->value_list(n, src_list, output_list.data());
+  return output_list;
+}
+
+// @brief 値をまとめて計算する(生の配列版)．
+void
+ClibLut::value_list(
+  SizeType n,
+  const double* const input_list[],
+  double* output_list
+) const
+{
+  _check_valid();
+  _impl()->value_list(n, input_list, output_list);
+}
+
+// @brief インデックス値の配列を返す．
+const vector<double>&
+ClibLut::index_array(
+  SizeType var
+) const
+{
+  _check_valid();
+  return _impl()->index_array(var);
+}
+
+// @brief 格子点の値の配列を返す．
+const vector<double>&
+ClibLut::value_array() const
+{
+  _check_valid();
+  return _impl()->value_array();
+}
+
 END_NAMESPACE_YM_CLIB
@@ -0,0 +1,392 @@
+/// @file ClibMultiCorner.cc
+/// @brief ClibMultiCorner の実装ファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2024 Yusuke Matsunaga
+/// All rights reserved.
+
+#include "ym/ClibMultiCorner.h"
+#include "ym/ClibCell.h"
+#include "ym/ClibPin.h"
+#include "ym/ClibTiming.h"
+#include "ym/ClibInternalPower.h"
+#include "ym/ClibLut.h"
+#include "ym/ClibCapacitance.h"
+#include "ym/Range.h"
+#include "LutGrid.h"
+
+
+BEGIN_NAMESPACE_YM_CLIB
+
+BEGIN_NONAMESPACE
+
+// 構造が異なる時の例外を送出する．
+void
+mismatch(
+  const ClibCellLibrary& library,
+  const string& cell_name
+)
+{
+  ostringstream buf;
+  buf << library.name() << ": structure mismatch at cell "
+      << cell_name;
+  throw std::invalid_argument{buf.str()};
+}
+
+// 2つの LUT の形が等しい時 true を返す．
+bool
+same_shape(
+  const ClibLut& lut1,
+  const ClibLut& lut2
+)
+{
+  if ( lut1.is_valid() != lut2.is_valid() ) {
+    return false;
+  }
+  if ( !lut1.is_valid() ) {
+    return true;
+  }
+  auto d = lut1.dimension();
+  if ( lut2.dimension() != d ) {
+    return false;
+  }
+  for ( auto i: Range(d) ) {
+    if ( lut1.variable_type(i) != lut2.variable_type(i) ) {
+      return false;
+    }
+    auto n = lut1.index_num(i);
+    if ( lut2.index_num(i) != n ) {
+      return false;
+    }
+    for ( auto j: Range(n) ) {
+      if ( lut1.index(i, j) != lut2.index(i, j) ) {
+	return false;
+      }
+    }
+  }
+  return true;
+}
+
+// ピン名を返す．
+//
+// 不正値の場合は空文字列を返す．
+string
+pin_name(
+  const ClibPin& pin
+)
+{
+  if ( pin.is_valid() ) {
+    return pin.name();
+  }
+  return string{};
+}
+
+// タイミングの LUT のリストを返す．
+vector<ClibLut>
+lut_list(
+  const ClibTiming& timing
+)
+{
+  return vector<ClibLut>{timing.cell_rise(),
+			 timing.cell_fall(),
+			 timing.rise_transition(),
+			 timing.fall_transition(),
+			 timing.rise_propagation(),
+			 timing.fall_propagation()};
+}
+
+END_NONAMESPACE
+
+
+//////////////////////////////////////////////////////////////////////
+// クラス ClibMultiCorner
+//////////////////////////////////////////////////////////////////////
+
+// @brief ライブラリのリストを指定したコンストラクタ
+ClibMultiCorner::ClibMultiCorner(
+  const vector<ClibCellLibrary>& library_list
+)
+{
+  vector<vector<double>> lut_values_list(library_list.size());
+  for ( auto i: Range(library_list.size()) ) {
+    add_corner(library_list[i], lut_values_list[i]);
+  }
+  set_lut_values(lut_values_list);
+}
+
+// @brief liberty 形式のファイルを読み込んでライブラリを生成する．
+ClibMultiCorner
+ClibMultiCorner::read_liberty(
+  const vector<string>& filename_list
+)
+{
+  // 2つめ以降のライブラリは値を取り出したら捨てる．
+  ClibMultiCorner mc;
+  vector<vector<double>> lut_values_list(filename_list.size());
+  for ( auto i: Range(filename_list.size()) ) {
+    auto library = ClibCellLibrary::read_liberty(filename_list[i]);
+    mc.add_corner(library, lut_values_list[i]);
+  }
+  mc.set_lut_values(lut_values_list);
+  return mc;
+}
+
+// @brief LUT の格子点の値を返す．
+double
+ClibMultiCorner::grid_value(
+  SizeType corner,
+  const ClibLut& lut,
+  const vector<SizeType>& pos_array
+) const
+{
+  _check_corner(corner);
+  auto offset = lut_offset(lut);
+  auto pos = LutGrid::grid_pos(lut, pos_array);
+  return mLutValues[(offset + pos) * corner_num() + corner];
+}
+
+// @brief LUT の値を返す．
+double
+ClibMultiCorner::value(
+  SizeType corner,
+  const ClibLut& lut,
+  const vector<double>& val_array
+) const
+{
+  _check_corner(corner);
+  auto offset = lut_offset(lut);
+  LutGrid::Weight weight_list[LutGrid::MAX_WEIGHT];
+  auto num = LutGrid::weights(lut, val_array, weight_list);
+  auto n = corner_num();
+  double ans = 0.0;
+  for ( SizeType k = 0; k < num; ++ k ) {
+    auto& gw = weight_list[k];
+    ans += gw.weight * mLutValues[(offset + gw.pos) * n + corner];
+  }
+  return ans;
+}
+
+// @brief 全コーナーの LUT の値を返す．
+vector<double>
+ClibMultiCorner::values(
+  const ClibLut& lut,
+  const vector<double>& val_array
+) const
+{
+  auto offset = lut_offset(lut);
+  LutGrid::Weight weight_list[LutGrid::MAX_WEIGHT];
+  auto num = LutGrid::weights(lut, val_array, weight_list);
+  auto n = corner_num();
+  vector<double> ans(n, 0.0);
+  auto dst = ans.data();
+  for ( SizeType k = 0; k < num; ++ k ) {
+    auto& gw = weight_list[k];
+    auto weight = gw.weight;
+    // 全コーナーの値が連続しているのでこのループはベクトル化される．
+    auto src = mLutValues.data() + (offset + gw.pos) * n;
+    for ( SizeType c = 0; c < n; ++ c ) {
+      dst[c] += weight * src[c];
+    }
+  }
+  return ans;
+}
+
+// @brief ピンの負荷容量を返す．
+ClibCapacitance
+ClibMultiCorner::capacitance(
+  SizeType corner,
+  const ClibPin& pin
+) const
+{
+  return ClibCapacitance{mPinCapValues[pin_offset(corner, pin) + 0]};
+}
+
+// @brief ピンの立ち上がり時の負荷容量を返す．
+ClibCapacitance
+ClibMultiCorner::rise_capacitance(
+  SizeType corner,
+  const ClibPin& pin
+) const
+{
+  return ClibCapacitance{mPinCapValues[pin_offset(corner, pin) + 1]};
+}
+
+// @brief ピンの立ち下がり時の負荷容量を返す．
+ClibCapacitance
+ClibMultiCorner::fall_capacitance(
+  SizeType corner,
+  const ClibPin& pin
+) const
+{
+  return ClibCapacitance{mPinCapValues[pin_offset(corner, pin) + 2]};
+}
+
+// @brief コーナーを追加する．
+void
+ClibMultiCorner::add_corner(
+  const ClibCellLibrary& library,
+  vector<double>& lut_values
+)
+{
+  bool first = mCornerNameList.empty();
+  if ( first ) {
+    mLibrary = library;
+  }
+  else if ( library.cell_num() != mLibrary.cell_num() ) {
+    ostringstream buf;
+    buf << library.name() << ": cell_num() mismatch";
+    throw std::invalid_argument{buf.str()};
+  }
+  mCornerNameList.push_back(library.name());
+
+  // 同一のタイミングは複数の入力ピンで共有されているので
+  // 一度処理した LUT はスキップする．
+  std::unordered_set<const CiLut*> lut_mark;
+  auto add_lut = [&](const ClibLut& lut,
+		     const ClibLut& base_lut,
+		     const string& cell_name) {
+    if ( !same_shape(lut, base_lut) ) {
+      mismatch(library, cell_name);
+    }
+    if ( !lut.is_valid() || lut_mark.count(lut._impl()) > 0 ) {
+      return;
+    }
+    lut_mark.emplace(lut._impl());
+    if ( first ) {
+      mLutDict.emplace(base_lut._impl(), lut_values.size());
+    }
+    else if ( mLutDict.at(base_lut._impl()) != lut_values.size() ) {
+      // 共有のされ方が異なる．
+      mismatch(library, cell_name);
+    }
+    LutGrid::append_values(lut, lut_values);
+  };
+
+  // セルは名前で対応をとる．
+  // セル数が等しいので余分なセルがあることはない．
+  // 値は代表のライブラリのセルの順に並べる．
+  for ( auto cell_id: Range(mLibrary.cell_num()) ) {
+    auto base_cell = mLibrary.cell(cell_id);
+    auto cell_name = base_cell.name();
+    auto cell = library.cell(cell_name);
+    if ( !cell.is_valid() ||
+	 cell.pin_num() != base_cell.pin_num() ||
+	 cell.input2_num() != base_cell.input2_num() ||
+	 cell.output2_num() != base_cell.output2_num() ||
+	 cell.internal_power_num() != base_cell.internal_power_num() ) {
+      mismatch(library, cell_name);
+    }
+
+    // ピン
+    // ピンの順番は論理関数の入力番号を決めるので
+    // 名前だけでなく順番も一致しなければならない．
+    for ( auto pin_id: Range(cell.pin_num()) ) {
+      auto pin = cell.pin(pin_id);
+      auto base_pin = base_cell.pin(pin_id);
+      if ( pin.name() != base_pin.name() ||
+	   pin.direction() != base_pin.direction() ) {
+	mismatch(library, cell_name);
+      }
+      if ( first ) {
+	mPinDict.emplace(base_pin._impl(), mPinDict.size());
+      }
+      mPinCapValues.push_back(pin.capacitance().value());
+      mPinCapValues.push_back(pin.rise_capacitance().value());
+      mPinCapValues.push_back(pin.fall_capacitance().value());
+    }
+
+    // タイミング
+    for ( auto ipos: Range(cell.input2_num()) ) {
+      for ( auto opos: Range(cell.output2_num()) ) {
+	for ( auto sense: {ClibTimingSense::positive_unate,
+			   ClibTimingSense::negative_unate} ) {
+	  auto timing_list = cell.timing_list(ipos, opos, sense);
+	  auto base_timing_list = base_cell.timing_list(ipos, opos, sense);
+	  if ( timing_list.size() != base_timing_list.size() ) {
+	    mismatch(library, cell_name);
+	  }
+	  for ( auto i: Range(timing_list.size()) ) {
+	    auto timing = timing_list[i];
+	    auto base_timing = base_timing_list[i];
+	    if ( timing.type() != base_timing.type() ) {
+	      mismatch(library, cell_name);
+	    }
+	    auto lut_list1 = lut_list(timing);
+	    auto base_lut_list = lut_list(base_timing);
+	    for ( auto j: Range(lut_list1.size()) ) {
+	      add_lut(lut_list1[j], base_lut_list[j], cell_name);
+	    }
+	  }
+	}
+      }
+    }
+
+    // 内部電力
+    for ( auto i: Range(cell.internal_power_num()) ) {
+      auto ip = cell.internal_power(i);
+      auto base_ip = base_cell.internal_power(i);
+      if ( ip.pin().name() != base_ip.pin().name() ||
+	   pin_name(ip.related_pin()) != pin_name(base_ip.related_pin()) ) {
+	mismatch(library, cell_name);
+      }
+      add_lut(ip.rise_power(), base_ip.rise_power(), cell_name);
+      add_lut(ip.fall_power(), base_ip.fall_power(), cell_name);
+    }
+  }
+}
+
+// @brief コーナーごとの LUT の値を並べ替えて設定する．
+void
+ClibMultiCorner::set_lut_values(
+  const vector<vector<double>>& lut_values_list
+)
+{
+  auto n = lut_values_list.size();
+  if ( n == 0 ) {
+    return;
+  }
+  auto g = lut_values_list[0].size();
+  mLutValues.clear();
+  mLutValues.resize(g * n);
+  for ( auto c: Range(n) ) {
+    auto& src = lut_values_list[c];
+    if ( src.size() != g ) {
+      ostringstream buf;
+      buf << mCornerNameList[c] << ": number of LUT values mismatch";
+      throw std::invalid_argument{buf.str()};
+    }
+    for ( SizeType k = 0; k < g; ++ k ) {
+      mLutValues[k * n + c] = src[k];
+    }
+  }
+}
+
+// @brief LUT の値の先頭位置を返す．
+SizeType
+ClibMultiCorner::lut_offset(
+  const ClibLut& lut
+) const
+{
+  auto p = mLutDict.find(lut._impl());
+  if ( p == mLutDict.end() ) {
+    throw std::invalid_argument{"lut does not belong to this library"};
+  }
+  return p->second;
+}
+
+// @brief ピンの負荷容量の先頭位置を返す．
+SizeType
+ClibMultiCorner::pin_offset(
+  SizeType corner,
+  const ClibPin& pin
+) const
+{
+  _check_corner(corner);
+  auto p = mPinDict.find(pin._impl());
+  if ( p == mPinDict.end() ) {
+    throw std::invalid_argument{"pin does not belong to this library"};
+  }
+  return (corner * mPinDict.size() + p->second) * 3;
+}
+
+END_NAMESPACE_YM_CLIB
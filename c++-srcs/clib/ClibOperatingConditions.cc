@@ -0,0 +1,64 @@
+/// @file ClibOperatingConditions.cc
+/// @brief ClibOperatingConditions の実装ファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2024 Yusuke Matsunaga
+/// All rights reserved.
+
+#include "ym/ClibOperatingConditions.h"
+#include "ci/CiOperatingConditions.h"
+#include "ci/CiCellLibrary.h"
+
+
+BEGIN_NAMESPACE_YM_CLIB
+
+//////////////////////////////////////////////////////////////////////
+// クラス ClibOperatingConditions
+//////////////////////////////////////////////////////////////////////
+
+// @brief 名前を返す．
+string
+ClibOperatingConditions::name() const
+{
+  _check_valid();
+  auto oc = mLibrary->operating_conditions(mId);
+  return oc->name();
+}
+
+// @brief プロセス係数を返す．
+double
+ClibOperatingConditions::process() const
+{
+  _check_valid();
+  auto oc = mLibrary->operating_conditions(mId);
+  return oc->process();
+}
+
+// @brief 温度を返す．
+double
+ClibOperatingConditions::temperature() const
+{
+  _check_valid();
+  auto oc = mLibrary->operating_conditions(mId);
+  return oc->temperature();
+}
+
+// @brief 電圧を返す．
+double
+ClibOperatingConditions::voltage() const
+{
+  _check_valid();
+  auto oc = mLibrary->operating_conditions(mId);
+  return oc->voltage();
+}
+
+// @brief 配線の RC ツリーの種類を返す．
+string
+ClibOperatingConditions::tree_type() const
+{
+  _check_valid();
+  auto oc = mLibrary->operating_conditions(mId);
+  return oc->tree_type();
+}
+
+END_NAMESPACE_YM_CLIB
@@ -8,8 +8,10 @@
 
 #include "ym/ClibPatGraph.h"
 #include "ym/ClibCellClass.h"
+#include "ym/ClibIOMap.h"
 #include "ci/CiPatGraph.h"
 #include "ci/CiCellLibrary.h"
+#include "ym/TvFunc.h"
 
 
 BEGIN_NAMESPACE_YM_CLIB
@@ -74,4 +76,29 @@ ClibPatGraph::edge(
   return pg->edge(pos);
 }
 
+// @brief 根の深さを返す．
+SizeType
+ClibPatGraph::depth() const
+{
+  _check_valid();
+  auto pg = mLibrary->_pat_graph(mId);
+  return mLibrary->pg_node_depth(pg->root_id());
+}
+
+// @brief 論理関数を返す．
+TvFunc
+ClibPatGraph::func() const
+{
+  _check_valid();
+  return mLibrary->pg_pat_func(mId);
+}
+
+// @brief func() から NPN 正規形への変換マップを返す．
+ClibIOMap
+ClibPatGraph::rep_map() const
+{
+  _check_valid();
+  return mLibrary->pg_pat_map(mId);
+}
+
 END_NAMESPACE_YM_CLIB
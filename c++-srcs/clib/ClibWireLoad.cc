@@ -0,0 +1,128 @@
+/// @file ClibWireLoad.cc
+/// @brief ClibWireLoad の実装ファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2024 Yusuke Matsunaga
+/// All rights reserved.
+
+#include "ym/ClibWireLoad.h"
+#include "ci/CiWireLoad.h"
+#include "ci/CiCellLibrary.h"
+
+
+BEGIN_NAMESPACE_YM_CLIB
+
+//////////////////////////////////////////////////////////////////////
+// クラス ClibWireLoad
+//////////////////////////////////////////////////////////////////////
+
+// @brief 名前を返す．
+string
+ClibWireLoad::name() const
+{
+  _check_valid();
+  auto wl = mLibrary->wire_load(mId);
+  return wl->name();
+}
+
+// @brief wire_load_table の時 true を返す．
+bool
+ClibWireLoad::is_table() const
+{
+  _check_valid();
+  auto wl = mLibrary->wire_load(mId);
+  return wl->is_table();
+}
+
+// @brief 単位長あたりの抵抗を返す．
+double
+ClibWireLoad::resistance() const
+{
+  _check_valid();
+  auto wl = mLibrary->wire_load(mId);
+  return wl->resistance();
+}
+
+// @brief 単位長あたりの容量を返す．
+double
+ClibWireLoad::capacitance() const
+{
+  _check_valid();
+  auto wl = mLibrary->wire_load(mId);
+  return wl->capacitance();
+}
+
+// @brief 単位長あたりの面積を返す．
+double
+ClibWireLoad::area() const
+{
+  _check_valid();
+  auto wl = mLibrary->wire_load(mId);
+  return wl->area();
+}
+
+// @brief 外挿用の傾きを返す．
+double
+ClibWireLoad::slope() const
+{
+  _check_valid();
+  auto wl = mLibrary->wire_load(mId);
+  return wl->slope();
+}
+
+// @brief ファンアウト数から配線長を求める．
+double
+ClibWireLoad::wire_length(
+  SizeType fanout
+) const
+{
+  _check_valid();
+  auto wl = mLibrary->wire_load(mId);
+  return wl->wire_length(fanout);
+}
+
+// @brief ファンアウト数から配線容量を求める．
+double
+ClibWireLoad::wire_capacitance(
+  SizeType fanout
+) const
+{
+  _check_valid();
+  auto wl = mLibrary->wire_load(mId);
+  return wl->wire_capacitance(fanout);
+}
+
+// @brief ファンアウト数から配線抵抗を求める．
+double
+ClibWireLoad::wire_resistance(
+  SizeType fanout
+) const
+{
+  _check_valid();
+  auto wl = mLibrary->wire_load(mId);
+  return wl->wire_resistance(fanout);
+}
+
+// @brief ファンアウト数から配線面積を求める．
+double
+ClibWireLoad::wire_area(
+  SizeType fanout
+) const
+{
+  _check_valid();
+  auto wl = mLibrary->wire_load(mId);
+  return wl->wire_area(fanout);
+}
+
+// @brief ファンアウト数のリストから配線容量のリストを求める．
+vector<double>
+ClibWireLoad::wire_capacitance_list(
+  const vector<SizeType>& fanout_list
+) const
+{
+  _check_valid();
+  auto wl = mLibrary->wire_load(mId);
+  return wl->wire_capacitance_list(fanout_list);
+}
+
+END_NAMESPACE_YM_CLIB
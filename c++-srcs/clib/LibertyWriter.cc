@@ -0,0 +1,653 @@
+/// @file LibertyWriter.cc
+/// @brief LibertyWriter の実装ファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2024 Yusuke Matsunaga
+/// All rights reserved.
+
+#include "LibertyWriter.h"
+#include "OutBuf.h"
+#include "ym/ClibCell.h"
+#include "ym/ClibPin.h"
+#include "ym/ClibLut.h"
+#include "ym/ClibTiming.h"
+#include "ym/ClibArea.h"
+#include "ym/ClibCapacitance.h"
+#include "ym/ClibResistance.h"
+#include "ym/ClibTime.h"
+#include "ym/Expr.h"
+#include "ym/Range.h"
+
+
+BEGIN_NAMESPACE_YM_CLIB
+
+BEGIN_NONAMESPACE
+
+// 遅延モデルを表す文字列
+const char*
+delay_model_str(
+  ClibDelayModel delay_model
+)
+{
+  switch ( delay_model ) {
+  case ClibDelayModel::generic_cmos:   return "generic_cmos";
+  case ClibDelayModel::table_lookup:   return "table_lookup";
+  case ClibDelayModel::piecewise_cmos: return "piecewise_cmos";
+  case ClibDelayModel::cmos2:          return "cmos2";
+  case ClibDelayModel::dcm:            return "dcm";
+  case ClibDelayModel::polynomial:     return "polynomial";
+  default: break;
+  }
+  return "generic_cmos";
+}
+
+// ピンの方向を表す文字列
+const char*
+direction_str(
+  ClibDirection dir
+)
+{
+  switch ( dir ) {
+  case ClibDirection::input:    return "input";
+  case ClibDirection::output:   return "output";
+  case ClibDirection::inout:    return "inout";
+  case ClibDirection::internal: return "internal";
+  default: break;
+  }
+  return "input";
+}
+
+// タイミングの種類を表す文字列
+const char*
+timing_type_str(
+  ClibTimingType timing_type
+)
+{
+  switch ( timing_type ) {
+  case ClibTimingType::combinational:            return "combinational";
+  case ClibTimingType::combinational_rise:       return "combinational_rise";
+  case ClibTimingType::combinational_fall:       return "combinational_fall";
+  case ClibTimingType::three_state_enable:       return "three_state_enable";
+  case ClibTimingType::three_state_disable:      return "three_state_disable";
+  case ClibTimingType::three_state_enable_rise:  return "three_state_enable_rise";
+  case ClibTimingType::three_state_enable_fall:  return "three_state_enable_fall";
+  case ClibTimingType::three_state_disable_rise: return "three_state_disable_rise";
+  case ClibTimingType::three_state_disable_fall: return "three_state_disable_fall";
+  case ClibTimingType::rising_edge:              return "rising_edge";
+  case ClibTimingType::falling_edge:             return "falling_edge";
+  case ClibTimingType::preset:                   return "preset";
+  case ClibTimingType::clear:                    return "clear";
+  case ClibTimingType::hold_rising:              return "hold_rising";
+  case ClibTimingType::hold_falling:             return "hold_falling";
+  case ClibTimingType::setup_rising:             return "setup_rising";
+  case ClibTimingType::setup_falling:            return "setup_falling";
+  case ClibTimingType::recovery_rising:          return "recovery_rising";
+  case ClibTimingType::recovery_falling:         return "recovery_falling";
+  case ClibTimingType::skew_rising:              return "skew_rising";
+  case ClibTimingType::skew_falling:             return "skew_falling";
+  case ClibTimingType::removal_rising:           return "removal_rising";
+  case ClibTimingType::removal_falling:          return "removal_falling";
+  case ClibTimingType::non_seq_setup_rising:     return "non_seq_setup_rising";
+  case ClibTimingType::non_seq_setup_falling:    return "non_seq_setup_falling";
+  case ClibTimingType::non_seq_hold_rising:      return "non_seq_hold_rising";
+  case ClibTimingType::non_seq_hold_falling:     return "non_seq_hold_falling";
+  case ClibTimingType::nochange_high_high:       return "nochange_high_high";
+  case ClibTimingType::nochange_high_low:        return "nochange_high_low";
+  case ClibTimingType::nochange_low_high:        return "nochange_low_high";
+  case ClibTimingType::nochange_low_low:         return "nochange_low_low";
+  default: break;
+  }
+  return "combinational";
+}
+
+// LUT の変数の種類を表す文字列
+const char*
+var_type_str(
+  ClibVarType var_type
+)
+{
+  switch ( var_type ) {
+  case ClibVarType::input_net_transition:                     return "input_net_transition";
+  case ClibVarType::input_transition_time:                    return "input_transition_time";
+  case ClibVarType::total_output_net_capacitance:             return "total_output_net_capacitance";
+  case ClibVarType::equal_or_opposite_output_net_capacitance: return "equal_or_opposite_output_net_capacitance";
+  case ClibVarType::output_net_length:                        return "output_net_length";
+  case ClibVarType::output_net_wire_cap:                      return "output_net_wire_cap";
+  case ClibVarType::output_net_pin_cap:                       return "output_net_pin_cap";
+  case ClibVarType::related_out_total_output_net_capacitance: return "related_out_total_output_net_capacitance";
+  case ClibVarType::related_out_output_net_length:            return "related_out_output_net_length";
+  case ClibVarType::related_out_output_net_wire_cap:          return "related_out_output_net_wire_cap";
+  case ClibVarType::related_out_output_net_pin_cap:           return "related_out_output_net_pin_cap";
+  case ClibVarType::constrained_pin_transition:               return "constrained_pin_transition";
+  case ClibVarType::related_pin_transition:                   return "related_pin_transition";
+  default: break;
+  }
+  return "none";
+}
+
+// clear_preset_var の値を表す文字列
+const char*
+cpv_str(
+  ClibCPV cpv
+)
+{
+  switch ( cpv ) {
+  case ClibCPV::L: return "L";
+  case ClibCPV::H: return "H";
+  case ClibCPV::N: return "N";
+  case ClibCPV::T: return "T";
+  case ClibCPV::X: return "X";
+  default: break;
+  }
+  return "X";
+}
+
+// 論理式を liberty 形式で出力する．
+void
+put_expr(
+  OutBuf& s,
+  const Expr& expr,
+  const vector<string>& var_names
+)
+{
+  if ( expr.is_zero() ) {
+    s << '0';
+  }
+  else if ( expr.is_one() ) {
+    s << '1';
+  }
+  else if ( expr.is_posi_literal() ) {
+    s << var_names[expr.varid()];
+  }
+  else if ( expr.is_nega_literal() ) {
+    s << '!' << var_names[expr.varid()];
+  }
+  else {
+    const char* op = expr.is_and() ? " & " : expr.is_or() ? " | " : " ^ ";
+    s << '(';
+    const char* sep = "";
+    for ( auto& opr: expr.operand_list() ) {
+      s << sep;
+      put_expr(s, opr, var_names);
+      sep = op;
+    }
+    s << ')';
+  }
+}
+
+// 論理式を属性として出力する．
+void
+put_expr_attr(
+  OutBuf& s,
+  const char* indent,
+  const char* attr_name,
+  const Expr& expr,
+  const vector<string>& var_names
+)
+{
+  if ( expr.is_invalid() ) {
+    return;
+  }
+  s << indent << attr_name << " : \"";
+  put_expr(s, expr, var_names);
+  s << "\";\n";
+}
+
+// 文字列型の属性を出力する．
+void
+put_str_attr(
+  OutBuf& s,
+  const char* attr_name,
+  const string& value
+)
+{
+  if ( value.empty() ) {
+    return;
+  }
+  s << "  " << attr_name << " : \"" << value << "\";\n";
+}
+
+// 物理量の属性を出力する．
+template<class T>
+void
+put_value_attr(
+  OutBuf& s,
+  const char* indent,
+  const char* attr_name,
+  const T& value
+)
+{
+  s << indent << attr_name << " : " << value.value() << ";\n";
+}
+
+// 0 でない場合に物理量の属性を出力する．
+template<class T>
+void
+put_nonzero_attr(
+  OutBuf& s,
+  const char* indent,
+  const char* attr_name,
+  const T& value
+)
+{
+  if ( value.value() != 0.0 ) {
+    put_value_attr(s, indent, attr_name, value);
+  }
+}
+
+END_NONAMESPACE
+
+
+//////////////////////////////////////////////////////////////////////
+// クラス LibertyWriter
+//////////////////////////////////////////////////////////////////////
+
+// @brief コンストラクタ
+LibertyWriter::LibertyWriter(
+  const ClibCellLibrary& library
+) : mLibrary{library}
+{
+  // LUT テンプレートを登録する．
+  for ( auto cell: mLibrary.cell_list() ) {
+    for ( auto opos: Range(cell.output2_num()) ) {
+      for ( auto ipos: Range(cell.input2_num()) ) {
+	for ( auto sense: {ClibTimingSense::positive_unate,
+			   ClibTimingSense::negative_unate} ) {
+	  for ( auto timing: cell.timing_list(ipos, opos, sense) ) {
+	    reg_lut(timing.cell_rise());
+	    reg_lut(timing.cell_fall());
+	    reg_lut(timing.rise_transition());
+	    reg_lut(timing.fall_transition());
+	    reg_lut(timing.rise_propagation());
+	    reg_lut(timing.fall_propagation());
+	  }
+	}
+      }
+    }
+  }
+}
+
+// @brief セルライブラリの内容を出力する．
+void
+LibertyWriter::run(
+  ostream& s,
+  SizeType thread_num
+) const
+{
+  OutBuf buf;
+  write_header(buf);
+  write_templates(buf);
+
+  auto cell_list = mLibrary.cell_list();
+  buf.write_parallel(s, cell_list.size(), thread_num,
+		     [&](OutBuf& cell_buf, SizeType pos) {
+		       write_cell(cell_buf, cell_list[pos]);
+		     });
+
+  buf << "}\n";
+  buf.flush(s);
+}
+
+// @brief ライブラリの属性を出力する．
+void
+LibertyWriter::write_header(
+  OutBuf& s
+) const
+{
+  s << "library (" << mLibrary.name() << ") {\n";
+  s << "  technology (";
+  switch ( mLibrary.technology() ) {
+  case ClibTechnology::cmos: s << "cmos"; break;
+  case ClibTechnology::fpga: s << "fpga"; break;
+  default: break;
+  }
+  s << ");\n";
+  s << "  delay_model : " << delay_model_str(mLibrary.delay_model()) << ";\n";
+  put_str_attr(s, "bus_naming_style", mLibrary.bus_naming_style());
+  put_str_attr(s, "date", mLibrary.date());
+  put_str_attr(s, "revision", mLibrary.revision());
+  put_str_attr(s, "comment", mLibrary.comment());
+  put_str_attr(s, "time_unit", mLibrary.time_unit());
+  put_str_attr(s, "voltage_unit", mLibrary.voltage_unit());
+  put_str_attr(s, "current_unit", mLibrary.current_unit());
+  put_str_attr(s, "pulling_resistance_unit", mLibrary.pulling_resistance_unit());
+  if ( mLibrary.capacitive_load_unit() != 0.0 ) {
+    s << "  capacitive_load_unit ("
+      << mLibrary.capacitive_load_unit() << ", "
+      << mLibrary.capacitive_load_unit_str() << ");\n";
+  }
+  put_str_attr(s, "leakage_power_unit", mLibrary.leakage_power_unit());
+  s << '\n';
+}
+
+// @brief LUTテンプレートを出力する．
+void
+LibertyWriter::write_templates(
+  OutBuf& s
+) const
+{
+  for ( auto id: Range(mTemplateList.size()) ) {
+    const auto& lut = mTemplateList[id];
+    s << "  lu_table_template (lut_template_" << id << ") {\n";
+    SizeType d = lut.dimension();
+    for ( auto i: Range(d) ) {
+      s << "    variable_" << (i + 1) << " : "
+	<< var_type_str(lut.variable_type(i)) << ";\n";
+    }
+    for ( auto i: Range(d) ) {
+      s << "    index_" << (i + 1) << " (\"";
+      const char* comma = "";
+      for ( auto j: Range(lut.index_num(i)) ) {
+	s << comma << lut.index(i, j);
+	comma = ", ";
+      }
+      s << "\");\n";
+    }
+    s << "  }\n";
+  }
+  if ( !mTemplateList.empty() ) {
+    s << '\n';
+  }
+}
+
+// @brief セルの内容を出力する．
+void
+LibertyWriter::write_cell(
+  OutBuf& s,
+  const ClibCell& cell
+) const
+{
+  s << "  cell (" << cell.name() << ") {\n";
+  put_value_attr(s, "    ", "area", cell.area());
+
+  // 論理式用の変数名のリストを作る．
+  auto ni2 = cell.input2_num();
+  vector<string> var_names(ni2 + 2);
+  for ( auto pin: cell.pin_list() ) {
+    if ( pin.is_input() || pin.is_inout() ) {
+      var_names[pin.input_id()] = pin.name();
+    }
+  }
+  if ( cell.is_ff() || cell.is_latch() ) {
+    var_names[ni2 + 0] = cell.qvar1();
+    var_names[ni2 + 1] = cell.qvar2();
+    write_seq(s, cell, var_names);
+  }
+
+  for ( auto pin: cell.pin_list() ) {
+    write_pin(s, cell, pin, var_names);
+  }
+  s << "  }\n";
+}
+
+// @brief FF/ラッチの情報を出力する．
+void
+LibertyWriter::write_seq(
+  OutBuf& s,
+  const ClibCell& cell,
+  const vector<string>& var_names
+) const
+{
+  const char* indent = "      ";
+  if ( cell.is_ff() ) {
+    s << "    ff (" << cell.qvar1() << ", " << cell.qvar2() << ") {\n";
+    put_expr_attr(s, indent, "clocked_on", cell.clock_expr(), var_names);
+    put_expr_attr(s, indent, "clocked_on_also", cell.clock2_expr(), var_names);
+    put_expr_attr(s, indent, "next_state", cell.next_state_expr(), var_names);
+  }
+  else {
+    s << "    latch (" << cell.qvar1() << ", " << cell.qvar2() << ") {\n";
+    put_expr_attr(s, indent, "enable", cell.enable_expr(), var_names);
+    put_expr_attr(s, indent, "enable_also", cell.enable2_expr(), var_names);
+    put_expr_attr(s, indent, "data_in", cell.data_in_expr(), var_names);
+  }
+  if ( cell.has_clear() ) {
+    put_expr_attr(s, indent, "clear", cell.clear_expr(), var_names);
+  }
+  if ( cell.has_preset() ) {
+    put_expr_attr(s, indent, "preset", cell.preset_expr(), var_names);
+  }
+  if ( cell.has_clear() && cell.has_preset() ) {
+    s << indent << "clear_preset_var1 : "
+      << cpv_str(cell.clear_preset_var1()) << ";\n"
+      << indent << "clear_preset_var2 : "
+      << cpv_str(cell.clear_preset_var2()) << ";\n";
+  }
+  s << "    }\n";
+}
+
+// @brief ピンの内容を出力する．
+void
+LibertyWriter::write_pin(
+  OutBuf& s,
+  const ClibCell& cell,
+  const ClibPin& pin,
+  const vector<string>& var_names
+) const
+{
+  const char* indent = "      ";
+  s << "    pin (" << pin.name() << ") {\n"
+    << indent << "direction : " << direction_str(pin.direction()) << ";\n";
+  if ( pin.is_input() || pin.is_inout() ) {
+    put_value_attr(s, indent, "capacitance", pin.capacitance());
+    put_value_attr(s, indent, "rise_capacitance", pin.rise_capacitance());
+    put_value_attr(s, indent, "fall_capacitance", pin.fall_capacitance());
+  }
+  if ( pin.is_output() || pin.is_inout() ) {
+    auto opos = pin.output_id();
+    if ( cell.has_logic(opos) ) {
+      put_expr_attr(s, indent, "function", cell.logic_expr(opos), var_names);
+      if ( cell.has_tristate(opos) ) {
+	put_expr_attr(s, indent, "three_state", cell.tristate_expr(opos), var_names);
+      }
+    }
+    put_nonzero_attr(s, indent, "max_fanout", pin.max_fanout());
+    put_nonzero_attr(s, indent, "min_fanout", pin.min_fanout());
+    put_nonzero_attr(s, indent, "max_capacitance", pin.max_capacitance());
+    put_nonzero_attr(s, indent, "min_capacitance", pin.min_capacitance());
+    put_nonzero_attr(s, indent, "max_transition", pin.max_transition());
+    put_nonzero_attr(s, indent, "min_transition", pin.min_transition());
+    write_timing_list(s, cell, opos, var_names);
+  }
+  s << "    }\n";
+}
+
+// @brief 出力ピンのタイミング情報を出力する．
+void
+LibertyWriter::write_timing_list(
+  OutBuf& s,
+  const ClibCell& cell,
+  SizeType opos,
+  const vector<string>& var_names
+) const
+{
+  // 同一のタイミング情報は複数の入力ピンで共有されているので
+  // まとめてから出力する．
+  struct TimingEntry
+  {
+    ClibTiming timing;
+    vector<SizeType> ipos_list;
+    bool posi{false};
+    bool nega{false};
+  };
+  vector<TimingEntry> entry_list;
+  for ( auto ipos: Range(cell.input2_num()) ) {
+    for ( auto sense: {ClibTimingSense::positive_unate,
+		       ClibTimingSense::negative_unate} ) {
+      for ( auto timing: cell.timing_list(ipos, opos, sense) ) {
+	TimingEntry* entry = nullptr;
+	for ( auto& e: entry_list ) {
+	  if ( e.timing == timing ) {
+	    entry = &e;
+	    break;
+	  }
+	}
+	if ( entry == nullptr ) {
+	  entry_list.push_back(TimingEntry{timing, {}});
+	  entry = &entry_list.back();
+	}
+	if ( entry->ipos_list.empty() || entry->ipos_list.back() != ipos ) {
+	  entry->ipos_list.push_back(ipos);
+	}
+	if ( sense == ClibTimingSense::positive_unate ) {
+	  entry->posi = true;
+	}
+	else {
+	  entry->nega = true;
+	}
+      }
+    }
+  }
+
+  const char* indent = "        ";
+  for ( auto& entry: entry_list ) {
+    auto& timing = entry.timing;
+    auto type = timing.type();
+    s << "      timing () {\n"
+      << indent << "related_pin : \"";
+    const char* sp = "";
+    for ( auto ipos: entry.ipos_list ) {
+      s << sp << var_names[ipos];
+      sp = " ";
+    }
+    s << "\";\n"
+      << indent << "timing_type : " << timing_type_str(type) << ";\n";
+    if ( type != ClibTimingType::rising_edge &&
+	 type != ClibTimingType::falling_edge ) {
+      s << indent << "timing_sense : ";
+      if ( entry.posi && entry.nega ) {
+	s << "non_unate";
+      }
+      else if ( entry.posi ) {
+	s << "positive_unate";
+      }
+      else {
+	s << "negative_unate";
+      }
+      s << ";\n";
+    }
+    auto cond = timing.timing_cond();
+    if ( cond.is_valid() && !cond.is_one() ) {
+      put_expr_attr(s, indent, "when", cond, var_names);
+    }
+
+    switch ( mLibrary.delay_model() ) {
+    case ClibDelayModel::generic_cmos:
+    case ClibDelayModel::piecewise_cmos:
+      put_value_attr(s, indent, "intrinsic_rise", timing.intrinsic_rise());
+      put_value_attr(s, indent, "intrinsic_fall", timing.intrinsic_fall());
+      put_value_attr(s, indent, "slope_rise", timing.slope_rise());
+      put_value_attr(s, indent, "slope_fall", timing.slope_fall());
+      if ( mLibrary.delay_model() == ClibDelayModel::generic_cmos ) {
+	put_value_attr(s, indent, "rise_resistance", timing.rise_resistance());
+	put_value_attr(s, indent, "fall_resistance", timing.fall_resistance());
+      }
+      break;
+
+    case ClibDelayModel::table_lookup:
+      write_lut(s, "cell_rise", timing.cell_rise());
+      write_lut(s, "rise_transition", timing.rise_transition());
+      write_lut(s, "rise_propagation", timing.rise_propagation());
+      write_lut(s, "cell_fall", timing.cell_fall());
+      write_lut(s, "fall_transition", timing.fall_transition());
+      write_lut(s, "fall_propagation", timing.fall_propagation());
+      break;
+
+    default:
+      break;
+    }
+    s << "      }\n";
+  }
+}
+
+// @brief LUT の内容を出力する．
+void
+LibertyWriter::write_lut(
+  OutBuf& s,
+  const char* label,
+  const ClibLut& lut
+) const
+{
+  if ( lut.is_invalid() ) {
+    return;
+  }
+
+  auto id = mTemplateDict.at(template_key(lut));
+  s << "        " << label << " (lut_template_" << id << ") {\n";
+  SizeType d = lut.dimension();
+  vector<SizeType> n_array(d);
+  for ( auto i: Range(d) ) {
+    auto n = lut.index_num(i);
+    n_array[i] = n;
+    s << "          index_" << (i + 1) << " (\"";
+    const char* comma = "";
+    for ( auto j: Range(n) ) {
+      s << comma << lut.index(i, j);
+      comma = ", ";
+    }
+    s << "\");\n";
+  }
+
+  // 最後の変数の値を1行にまとめて出力する．
+  s << "          values (";
+  SizeType nrow = 1;
+  for ( auto i: Range(d - 1) ) {
+    nrow *= n_array[i];
+  }
+  auto ncol = n_array[d - 1];
+  vector<SizeType> pos_array(d, 0);
+  for ( auto r: Range(nrow) ) {
+    // r を最後以外の変数の座標に分解する．
+    SizeType tmp = r;
+    for ( SizeType i = d - 1; i -- > 0; ) {
+      pos_array[i] = tmp % n_array[i];
+      tmp /= n_array[i];
+    }
+    if ( r > 0 ) {
+      s << ", \\\n                  ";
+    }
+    s << '"';
+    const char* comma = "";
+    for ( auto c: Range(ncol) ) {
+      pos_array[d - 1] = c;
+      s << comma << lut.grid_value(pos_array);
+      comma = ", ";
+    }
+    s << '"';
+  }
+  s << ");\n"
+    << "        }\n";
+}
+
+// @brief LUT をテンプレートに登録する．
+void
+LibertyWriter::reg_lut(
+  const ClibLut& lut
+)
+{
+  if ( lut.is_invalid() ) {
+    return;
+  }
+  auto key = template_key(lut);
+  if ( mTemplateDict.count(key) == 0 ) {
+    mTemplateDict.emplace(key, mTemplateList.size());
+    mTemplateList.push_back(lut);
+  }
+}
+
+// @brief LUT のテンプレート用のキーを作る．
+string
+LibertyWriter::template_key(
+  const ClibLut& lut
+)
+{
+  OutBuf buf;
+  SizeType d = lut.dimension();
+  for ( auto i: Range(d) ) {
+    buf << static_cast<int>(lut.variable_type(i))
+	<< ':' << lut.index_num(i) << ';';
+  }
+  return buf.str();
+}
+
+END_NAMESPACE_YM_CLIB
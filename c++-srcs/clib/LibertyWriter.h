@@ -0,0 +1,151 @@
+#ifndef LIBERTYWRITER_H
+#define LIBERTYWRITER_H
+
+/// @file LibertyWriter.h
+/// @brief LibertyWriter のヘッダファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2024 Yusuke Matsunaga
+/// All rights reserved.
+
+#include "ym/ClibCellLibrary.h"
+#include "ym/ClibLut.h"
+#include "ym/ClibTiming.h"
+
+
+BEGIN_NAMESPACE_YM_CLIB
+
+class OutBuf;
+
+//////////////////////////////////////////////////////////////////////
+/// @class LibertyWriter LibertyWriter.h "LibertyWriter.h"
+/// @brief セルライブラリを liberty 形式で出力するクラス
+///
+/// 各セルの内容は OutBuf に書き込んでからまとめて出力する．
+/// スレッド数を指定した場合にはセルごとのバッファを複数の
+/// スレッドで作り，元の順番で連結して出力する．
+///
+/// LUTテンプレートは LUT の変数の種類とインデックス数ごとに
+/// まとめて出力する．
+/// 個々の LUT では常にインデックスの値を明示的に出力する．
+//////////////////////////////////////////////////////////////////////
+class LibertyWriter
+{
+public:
+
+  /// @brief コンストラクタ
+  LibertyWriter(
+    const ClibCellLibrary& library ///< [in] セルライブラリ
+  );
+
+  /// @brief デストラクタ
+  ~LibertyWriter() = default;
+
+
+public:
+  //////////////////////////////////////////////////////////////////////
+  // 外部インターフェイス
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief セルライブラリの内容を出力する．
+  ///
+  /// thread_num が 1 以下の場合は単一のスレッドで処理を行う．
+  void
+  run(
+    ostream& s,         ///< [in] 出力ストリーム
+    SizeType thread_num ///< [in] スレッド数
+  ) const;
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // 内部で用いられる関数
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief ライブラリの属性を出力する．
+  void
+  write_header(
+    OutBuf& s
+  ) const;
+
+  /// @brief LUTテンプレートを出力する．
+  void
+  write_templates(
+    OutBuf& s
+  ) const;
+
+  /// @brief セルの内容を出力する．
+  void
+  write_cell(
+    OutBuf& s,
+    const ClibCell& cell
+  ) const;
+
+  /// @brief FF/ラッチの情報を出力する．
+  void
+  write_seq(
+    OutBuf& s,
+    const ClibCell& cell,
+    const vector<string>& var_names
+  ) const;
+
+  /// @brief ピンの内容を出力する．
+  void
+  write_pin(
+    OutBuf& s,
+    const ClibCell& cell,
+    const ClibPin& pin,
+    const vector<string>& var_names
+  ) const;
+
+  /// @brief 出力ピンのタイミング情報を出力する．
+  void
+  write_timing_list(
+    OutBuf& s,
+    const ClibCell& cell,
+    SizeType opos,
+    const vector<string>& var_names
+  ) const;
+
+  /// @brief LUT の内容を出力する．
+  void
+  write_lut(
+    OutBuf& s,
+    const char* label,
+    const ClibLut& lut
+  ) const;
+
+  /// @brief LUT をテンプレートに登録する．
+  void
+  reg_lut(
+    const ClibLut& lut
+  );
+
+  /// @brief LUT のテンプレート用のキーを作る．
+  static
+  string
+  template_key(
+    const ClibLut& lut
+  );
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // データメンバ
+  //////////////////////////////////////////////////////////////////////
+
+  // セルライブラリ
+  ClibCellLibrary mLibrary;
+
+  // テンプレートの代表となる LUT のリスト
+  vector<ClibLut> mTemplateList;
+
+  // テンプレート番号の辞書
+  // キーは template_key() の値
+  std::unordered_map<string, SizeType> mTemplateDict;
+
+};
+
+END_NAMESPACE_YM_CLIB
+
+#endif // LIBERTYWRITER_H
@@ -0,0 +1,558 @@
+/// @file LibraryDiff.cc
+/// @brief LibraryDiff の実装ファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2024 Yusuke Matsunaga
+/// All rights reserved.
+
+#include "LibraryDiff.h"
+#include "ym/ClibCell.h"
+#include "ym/ClibPin.h"
+#include "ym/ClibTiming.h"
+#include "ym/ClibLut.h"
+#include "ym/ClibArea.h"
+#include "ym/ClibCapacitance.h"
+#include "ym/ClibTime.h"
+#include "ym/Range.h"
+#include <atomic>
+#include <thread>
+#include <exception>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+
+BEGIN_NAMESPACE_YM_CLIB
+
+BEGIN_NONAMESPACE
+
+// 2つの値の差の絶対値を返す．
+//
+// どちらかが NaN の場合は無限大を返す．
+inline
+double
+abs_delta(
+  double val1,
+  double val2
+)
+{
+  auto delta = std::abs(val2 - val1);
+  if ( std::isnan(delta) ) {
+    return std::numeric_limits<double>::infinity();
+  }
+  return delta;
+}
+
+// 2つの値が許容誤差を超えて異なる時 true を返す．
+//
+// NaN との比較も異なるとみなすため否定形で比較する．
+inline
+bool
+is_different(
+  double val1,
+  double val2,
+  double tolerance
+)
+{
+  return !(std::abs(val2 - val1) <= tolerance);
+}
+
+// 一方にしかない要素を表す差分を作る．
+ClibDiffItem
+make_missing(
+  const ClibDiffItem& base,
+  ClibDiffItem::Kind kind,
+  bool in_first
+)
+{
+  auto item = base;
+  item.kind = kind;
+  if ( in_first ) {
+    item.value1 = 1.0;
+  }
+  else {
+    item.value2 = 1.0;
+  }
+  return item;
+}
+
+// 入出力ピンの組に対するタイミングとそのセンスのリストを作る．
+//
+// non_unate のタイミングとエッジのタイミングは両方のリストに
+// 含まれているので non_unate として1回だけ登録する．
+vector<pair<ClibTiming, ClibTimingSense>>
+make_timing_list(
+  const ClibCell& cell,
+  SizeType ipos,
+  SizeType opos
+)
+{
+  auto p_list = cell.timing_list(ipos, opos, ClibTimingSense::positive_unate);
+  auto n_list = cell.timing_list(ipos, opos, ClibTimingSense::negative_unate);
+  auto in_list = [](const ClibTimingList& timing_list,
+		    const ClibTiming& timing) {
+    for ( auto timing1: timing_list ) {
+      if ( timing1 == timing ) {
+	return true;
+      }
+    }
+    return false;
+  };
+  vector<pair<ClibTiming, ClibTimingSense>> ans_list;
+  for ( auto timing: p_list ) {
+    auto sense = in_list(n_list, timing) ?
+      ClibTimingSense::non_unate : ClibTimingSense::positive_unate;
+    ans_list.push_back({timing, sense});
+  }
+  for ( auto timing: n_list ) {
+    if ( !in_list(p_list, timing) ) {
+      ans_list.push_back({timing, ClibTimingSense::negative_unate});
+    }
+  }
+  return ans_list;
+}
+
+// 差分の種類を表す文字列
+const char*
+kind_str(
+  ClibDiffItem::Kind kind
+)
+{
+  switch ( kind ) {
+  case ClibDiffItem::Cell:     return "cell";
+  case ClibDiffItem::Pin:      return "pin";
+  case ClibDiffItem::Timing:   return "timing";
+  case ClibDiffItem::Attr:     return "attr";
+  case ClibDiffItem::LutShape: return "lut_shape";
+  case ClibDiffItem::LutValue: return "lut_value";
+  }
+  return "";
+}
+
+END_NONAMESPACE
+
+
+//////////////////////////////////////////////////////////////////////
+// クラス LibraryDiff
+//////////////////////////////////////////////////////////////////////
+
+// @brief コンストラクタ
+LibraryDiff::LibraryDiff(
+  const ClibCellLibrary& library1,
+  const ClibCellLibrary& library2,
+  const ClibDiffParam& param
+) : mLibrary1{library1},
+    mLibrary2{library2},
+    mParam{param}
+{
+}
+
+// @brief 差分を求める．
+vector<ClibDiffItem>
+LibraryDiff::run() const
+{
+  auto n = mLibrary1.cell_num();
+  auto max_diff = mParam.max_diff;
+  vector<vector<ClibDiffItem>> item_list_array(n);
+  std::atomic<SizeType> next{0};
+  std::atomic<SizeType> count{0};
+  // セルは番号順に取り出されるので，打ち切った時点で
+  // 比較の済んでいるセルは常に先頭から連続した範囲となる．
+  auto diff_one = [&]() {
+    for ( ; ; ) {
+      if ( max_diff > 0 && count >= max_diff ) {
+	break;
+      }
+      SizeType pos = next ++;
+      if ( pos >= n ) {
+	break;
+      }
+      auto cell1 = mLibrary1.cell(pos);
+      auto& item_list = item_list_array[pos];
+      auto cell2 = mLibrary2.cell(std::string_view{cell1.name()});
+      if ( cell2.is_valid() ) {
+	diff_cell(cell1, cell2, item_list);
+      }
+      else {
+	ClibDiffItem base;
+	base.cell_name = cell1.name();
+	item_list.push_back(make_missing(base, ClibDiffItem::Cell, true));
+      }
+      count += item_list.size();
+    }
+  };
+  if ( mParam.thread_num <= 1 || n <= 1 ) {
+    diff_one();
+  }
+  else {
+    // セル数より多くのスレッドを作っても意味がない．
+    auto thread_num = std::min(mParam.thread_num, n);
+    // ワーカーで送出された例外は join() 後に送出し直す．
+    vector<std::exception_ptr> error_list(thread_num);
+    auto worker = [&](SizeType id) {
+      try {
+	diff_one();
+      }
+      catch ( ... ) {
+	error_list[id] = std::current_exception();
+	// 他のスレッドも打ち切らせる．
+	next = n;
+      }
+    };
+    vector<std::thread> thread_list;
+    thread_list.reserve(thread_num);
+    for ( SizeType i = 0; i < thread_num; ++ i ) {
+      thread_list.emplace_back(worker, i);
+    }
+    for ( auto& th: thread_list ) {
+      th.join();
+    }
+    for ( auto& error: error_list ) {
+      if ( error ) {
+	std::rethrow_exception(error);
+      }
+    }
+  }
+
+  vector<ClibDiffItem> ans_list;
+  for ( auto& item_list: item_list_array ) {
+    for ( auto& item: item_list ) {
+      if ( max_diff > 0 && ans_list.size() >= max_diff ) {
+	return ans_list;
+      }
+      ans_list.push_back(std::move(item));
+    }
+  }
+
+  // 2つめのライブラリにしかないセル
+  for ( auto cell2: mLibrary2.cell_list() ) {
+    if ( max_diff > 0 && ans_list.size() >= max_diff ) {
+      break;
+    }
+    auto cell1 = mLibrary1.cell(std::string_view{cell2.name()});
+    if ( !cell1.is_valid() ) {
+      ClibDiffItem base;
+      base.cell_name = cell2.name();
+      ans_list.push_back(make_missing(base, ClibDiffItem::Cell, false));
+    }
+  }
+  return ans_list;
+}
+
+// @brief セルを比較する．
+void
+LibraryDiff::diff_cell(
+  const ClibCell& cell1,
+  const ClibCell& cell2,
+  vector<ClibDiffItem>& item_list
+) const
+{
+  ClibDiffItem base;
+  base.cell_name = cell1.name();
+  diff_value(base, "area", cell1.area().value(), cell2.area().value(),
+	     item_list);
+
+  // ピン
+  for ( auto pin1: cell1.pin_list() ) {
+    auto pin2 = cell2.pin(std::string_view{pin1.name()});
+    auto pin_base = base;
+    pin_base.pin_name = pin1.name();
+    if ( pin2.is_valid() ) {
+      diff_pin(cell1, pin1, pin2, item_list);
+    }
+    else {
+      item_list.push_back(make_missing(pin_base, ClibDiffItem::Pin, true));
+    }
+  }
+  for ( auto pin2: cell2.pin_list() ) {
+    auto pin1 = cell1.pin(std::string_view{pin2.name()});
+    if ( !pin1.is_valid() ) {
+      auto pin_base = base;
+      pin_base.pin_name = pin2.name();
+      item_list.push_back(make_missing(pin_base, ClibDiffItem::Pin, false));
+    }
+  }
+
+  // タイミング
+  // 一方にしかないピンに関するものは比較しない．
+  for ( auto ipos1: Range(cell1.input2_num()) ) {
+    auto ipin1 = cell1.input2(ipos1);
+    auto ipin2 = cell2.pin(std::string_view{ipin1.name()});
+    if ( !ipin2.is_valid() || !(ipin2.is_input() || ipin2.is_inout()) ) {
+      continue;
+    }
+    auto ipos2 = ipin2.input_id();
+    for ( auto opos1: Range(cell1.output2_num()) ) {
+      auto opin1 = cell1.output2(opos1);
+      auto opin2 = cell2.pin(std::string_view{opin1.name()});
+      if ( !opin2.is_valid() || !(opin2.is_output() || opin2.is_inout()) ) {
+	continue;
+      }
+      auto opos2 = opin2.output_id();
+      diff_timing_list(cell1, ipos1, opos1, cell2, ipos2, opos2, item_list);
+    }
+  }
+}
+
+// @brief ピンを比較する．
+void
+LibraryDiff::diff_pin(
+  const ClibCell& cell1,
+  const ClibPin& pin1,
+  const ClibPin& pin2,
+  vector<ClibDiffItem>& item_list
+) const
+{
+  ClibDiffItem base;
+  base.cell_name = cell1.name();
+  base.pin_name = pin1.name();
+  diff_value(base, "direction",
+	     static_cast<double>(pin1.direction()),
+	     static_cast<double>(pin2.direction()),
+	     item_list);
+  if ( pin1.direction() != pin2.direction() ) {
+    return;
+  }
+  if ( pin1.is_input() || pin1.is_inout() ) {
+    diff_value(base, "capacitance",
+	       pin1.capacitance().value(), pin2.capacitance().value(),
+	       item_list);
+    diff_value(base, "rise_capacitance",
+	       pin1.rise_capacitance().value(), pin2.rise_capacitance().value(),
+	       item_list);
+    diff_value(base, "fall_capacitance",
+	       pin1.fall_capacitance().value(), pin2.fall_capacitance().value(),
+	       item_list);
+  }
+  if ( pin1.is_output() || pin1.is_inout() ) {
+    diff_value(base, "max_fanout",
+	       pin1.max_fanout().value(), pin2.max_fanout().value(),
+	       item_list);
+    diff_value(base, "max_capacitance",
+	       pin1.max_capacitance().value(), pin2.max_capacitance().value(),
+	       item_list);
+    diff_value(base, "max_transition",
+	       pin1.max_transition().value(), pin2.max_transition().value(),
+	       item_list);
+  }
+}
+
+// @brief 入出力ピンの組に対するタイミングを比較する．
+void
+LibraryDiff::diff_timing_list(
+  const ClibCell& cell1,
+  SizeType ipos1,
+  SizeType opos1,
+  const ClibCell& cell2,
+  SizeType ipos2,
+  SizeType opos2,
+  vector<ClibDiffItem>& item_list
+) const
+{
+  ClibDiffItem base;
+  base.cell_name = cell1.name();
+  base.pin_name = cell1.output2(opos1).name();
+  base.related_pin_name = cell1.input2(ipos1).name();
+  auto timing_list1 = make_timing_list(cell1, ipos1, opos1);
+  auto timing_list2 = make_timing_list(cell2, ipos2, opos2);
+  auto n2 = timing_list2.size();
+  vector<bool> used(n2, false);
+  for ( auto& p1: timing_list1 ) {
+    auto& timing1 = p1.first;
+    auto timing_base = base;
+    timing_base.timing_type = timing1.type();
+    timing_base.timing_sense = p1.second;
+    // 種類とセンスの等しいタイミングを出現順に対応づける．
+    bool found = false;
+    for ( SizeType i = 0; i < n2; ++ i ) {
+      if ( used[i] ) {
+	continue;
+      }
+      auto& timing2 = timing_list2[i].first;
+      if ( timing2.type() != timing1.type() ||
+	   timing_list2[i].second != p1.second ) {
+	continue;
+      }
+      used[i] = true;
+      found = true;
+      diff_lut(timing_base, "cell_rise",
+	       timing1.cell_rise(), timing2.cell_rise(), item_list);
+      diff_lut(timing_base, "cell_fall",
+	       timing1.cell_fall(), timing2.cell_fall(), item_list);
+      diff_lut(timing_base, "rise_transition",
+	       timing1.rise_transition(), timing2.rise_transition(), item_list);
+      diff_lut(timing_base, "fall_transition",
+	       timing1.fall_transition(), timing2.fall_transition(), item_list);
+      diff_lut(timing_base, "rise_propagation",
+	       timing1.rise_propagation(), timing2.rise_propagation(), item_list);
+      diff_lut(timing_base, "fall_propagation",
+	       timing1.fall_propagation(), timing2.fall_propagation(), item_list);
+      break;
+    }
+    if ( !found ) {
+      item_list.push_back(make_missing(timing_base, ClibDiffItem::Timing, true));
+    }
+  }
+  for ( SizeType i = 0; i < n2; ++ i ) {
+    if ( !used[i] ) {
+      auto timing_base = base;
+      timing_base.timing_type = timing_list2[i].first.type();
+      timing_base.timing_sense = timing_list2[i].second;
+      item_list.push_back(make_missing(timing_base, ClibDiffItem::Timing, false));
+    }
+  }
+}
+
+// @brief LUT を比較する．
+void
+LibraryDiff::diff_lut(
+  const ClibDiffItem& base,
+  const char* name,
+  const ClibLut& lut1,
+  const ClibLut& lut2,
+  vector<ClibDiffItem>& item_list
+) const
+{
+  auto item = base;
+  item.kind = ClibDiffItem::LutShape;
+  item.attr_name = name;
+  if ( !lut1.is_valid() || !lut2.is_valid() ) {
+    if ( lut1.is_valid() != lut2.is_valid() ) {
+      item.value1 = lut1.is_valid() ? 1.0 : 0.0;
+      item.value2 = lut2.is_valid() ? 1.0 : 0.0;
+      item_list.push_back(item);
+    }
+    return;
+  }
+
+  auto d = lut1.dimension();
+  if ( lut2.dimension() != d ) {
+    item.attr_name += ".dimension";
+    item.value1 = d;
+    item.value2 = lut2.dimension();
+    item_list.push_back(item);
+    return;
+  }
+  for ( auto i: Range(d) ) {
+    auto suffix = std::to_string(i + 1);
+    if ( lut1.variable_type(i) != lut2.variable_type(i) ) {
+      item.attr_name = string{name} + ".variable_" + suffix;
+      item.value1 = static_cast<double>(lut1.variable_type(i));
+      item.value2 = static_cast<double>(lut2.variable_type(i));
+      item_list.push_back(item);
+      return;
+    }
+    auto ni = lut1.index_num(i);
+    if ( lut2.index_num(i) != ni ) {
+      item.attr_name = string{name} + ".index_" + suffix;
+      item.value1 = ni;
+      item.value2 = lut2.index_num(i);
+      item_list.push_back(item);
+      return;
+    }
+    for ( auto j: Range(ni) ) {
+      auto val1 = lut1.index(i, j);
+      auto val2 = lut2.index(i, j);
+      if ( is_different(val1, val2, mParam.tolerance) ) {
+	item.attr_name = string{name} + ".index_" + suffix;
+	item.value1 = val1;
+	item.value2 = val2;
+	item.grid_pos = {j};
+	item_list.push_back(item);
+	return;
+      }
+    }
+  }
+
+  // 差が最大となる格子点を求める．
+  SizeType n = 1;
+  for ( auto i: Range(d) ) {
+    n *= lut1.index_num(i);
+  }
+  vector<SizeType> pos_array(d, 0);
+  double max_delta = 0.0;
+  bool found = false;
+  for ( SizeType k = 0; k < n; ++ k ) {
+    auto val1 = lut1.grid_value(pos_array);
+    auto val2 = lut2.grid_value(pos_array);
+    auto delta = abs_delta(val1, val2);
+    if ( is_different(val1, val2, mParam.tolerance) &&
+	 ( !found || delta > max_delta ) ) {
+      max_delta = delta;
+      found = true;
+      item.value1 = val1;
+      item.value2 = val2;
+      item.grid_pos = pos_array;
+    }
+    for ( SizeType i = d; i > 0; -- i ) {
+      if ( ++ pos_array[i - 1] < lut1.index_num(i - 1) ) {
+	break;
+      }
+      pos_array[i - 1] = 0;
+    }
+  }
+  if ( found ) {
+    item.kind = ClibDiffItem::LutValue;
+    item_list.push_back(item);
+  }
+}
+
+// @brief 数値属性を比較する．
+void
+LibraryDiff::diff_value(
+  const ClibDiffItem& base,
+  const string& name,
+  double val1,
+  double val2,
+  vector<ClibDiffItem>& item_list
+) const
+{
+  if ( is_different(val1, val2, mParam.tolerance) ) {
+    auto item = base;
+    item.kind = ClibDiffItem::Attr;
+    item.attr_name = name;
+    item.value1 = val1;
+    item.value2 = val2;
+    item_list.push_back(item);
+  }
+}
+
+
+//////////////////////////////////////////////////////////////////////
+// クラス ClibDiffItem
+//////////////////////////////////////////////////////////////////////
+
+// @brief ClibDiffItem のストリーム出力演算子
+ostream&
+operator<<(
+  ostream& s,
+  const ClibDiffItem& item
+)
+{
+  s << kind_str(item.kind) << ": " << item.cell_name;
+  if ( item.pin_name != string{} ) {
+    s << " " << item.pin_name;
+  }
+  if ( item.related_pin_name != string{} ) {
+    s << " (" << item.related_pin_name
+      << ", " << item.timing_type
+      << ", " << item.timing_sense
+      << ")";
+  }
+  if ( item.attr_name != string{} ) {
+    s << " " << item.attr_name;
+  }
+  if ( !item.grid_pos.empty() ) {
+    s << " [";
+    const char* comma = "";
+    for ( auto pos: item.grid_pos ) {
+      s << comma << pos;
+      comma = ", ";
+    }
+    s << "]";
+  }
+  s << ": " << item.value1 << " -> " << item.value2;
+  return s;
+}
+
+END_NAMESPACE_YM_CLIB
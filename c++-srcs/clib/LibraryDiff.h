@@ -0,0 +1,125 @@
+#ifndef LIBRARYDIFF_H
+#define LIBRARYDIFF_H
+
+/// @file LibraryDiff.h
+/// @brief LibraryDiff のヘッダファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2024 Yusuke Matsunaga
+/// All rights reserved.
+
+#include "ym/ClibCellLibrary.h"
+#include "ym/ClibDiff.h"
+
+
+BEGIN_NAMESPACE_YM_CLIB
+
+//////////////////////////////////////////////////////////////////////
+/// @class LibraryDiff LibraryDiff.h "LibraryDiff.h"
+/// @brief 2つのセルライブラリの差分を求めるクラス
+///
+/// 1つめのライブラリのセルごとに比較を行う．
+/// スレッド数を指定した場合にはセルごとの比較を複数のスレッドで行い，
+/// 元のセルの順番で結果を連結する．
+/// 差分の最大数を指定した場合，結果はその数で打ち切られるが，
+/// いずれの場合も結果はスレッド数によらない．
+//////////////////////////////////////////////////////////////////////
+class LibraryDiff
+{
+public:
+
+  /// @brief コンストラクタ
+  LibraryDiff(
+    const ClibCellLibrary& library1, ///< [in] 1つめのライブラリ
+    const ClibCellLibrary& library2, ///< [in] 2つめのライブラリ
+    const ClibDiffParam& param       ///< [in] 比較の条件
+  );
+
+  /// @brief デストラクタ
+  ~LibraryDiff() = default;
+
+
+public:
+  //////////////////////////////////////////////////////////////////////
+  // 外部インターフェイス
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief 差分を求める．
+  vector<ClibDiffItem>
+  run() const;
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // 内部で用いられる関数
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief セルを比較する．
+  void
+  diff_cell(
+    const ClibCell& cell1,
+    const ClibCell& cell2,
+    vector<ClibDiffItem>& item_list
+  ) const;
+
+  /// @brief ピンを比較する．
+  void
+  diff_pin(
+    const ClibCell& cell1,
+    const ClibPin& pin1,
+    const ClibPin& pin2,
+    vector<ClibDiffItem>& item_list
+  ) const;
+
+  /// @brief 入出力ピンの組に対するタイミングを比較する．
+  void
+  diff_timing_list(
+    const ClibCell& cell1,
+    SizeType ipos1,
+    SizeType opos1,
+    const ClibCell& cell2,
+    SizeType ipos2,
+    SizeType opos2,
+    vector<ClibDiffItem>& item_list
+  ) const;
+
+  /// @brief LUT を比較する．
+  void
+  diff_lut(
+    const ClibDiffItem& base,
+    const char* name,
+    const ClibLut& lut1,
+    const ClibLut& lut2,
+    vector<ClibDiffItem>& item_list
+  ) const;
+
+  /// @brief 数値属性を比較する．
+  void
+  diff_value(
+    const ClibDiffItem& base,
+    const string& name,
+    double val1,
+    double val2,
+    vector<ClibDiffItem>& item_list
+  ) const;
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // データメンバ
+  //////////////////////////////////////////////////////////////////////
+
+  // 1つめのライブラリ
+  ClibCellLibrary mLibrary1;
+
+  // 2つめのライブラリ
+  ClibCellLibrary mLibrary2;
+
+  // 比較の条件
+  ClibDiffParam mParam;
+
+};
+
+END_NAMESPACE_YM_CLIB
+
+#endif // LIBRARYDIFF_H
@@ -0,0 +1,147 @@
+/// @file LutGrid.cc
+/// @brief LutGrid の実装ファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2024 Yusuke Matsunaga
+/// All rights reserved.
+
+#include "LutGrid.h"
+#include "ym/Range.h"
+
+
+BEGIN_NAMESPACE_YM_CLIB
+
+//////////////////////////////////////////////////////////////////////
+// クラス LutGrid
+//////////////////////////////////////////////////////////////////////
+
+// @brief 格子点の総数を返す．
+SizeType
+LutGrid::grid_num(
+  const ClibLut& lut
+)
+{
+  SizeType n = 1;
+  for ( auto i: Range(lut.dimension()) ) {
+    n *= lut.index_num(i);
+  }
+  return n;
+}
+
+// @brief 格子点座標から LUT の値の中での位置を求める．
+SizeType
+LutGrid::grid_pos(
+  const ClibLut& lut,
+  const vector<SizeType>& pos_array
+)
+{
+  SizeType d = lut.dimension();
+  if ( pos_array.size() != d ) {
+    ostringstream buf;
+    buf << "pos_array.size() should be " << d;
+    throw std::invalid_argument{buf.str()};
+  }
+  SizeType pos = 0;
+  for ( auto i: Range(d) ) {
+    if ( pos_array[i] >= lut.index_num(i) ) {
+      throw std::out_of_range{"pos_array is out of range"};
+    }
+    pos = pos * lut.index_num(i) + pos_array[i];
+  }
+  return pos;
+}
+
+// @brief 補間に用いる格子点と重みのリストを求める．
+SizeType
+LutGrid::weights(
+  const ClibLut& lut,
+  const vector<double>& val_array,
+  Weight weight_list[]
+)
+{
+  SizeType d = lut.dimension();
+  if ( val_array.size() != d ) {
+    ostringstream buf;
+    buf << "val_array.size() should be " << d;
+    throw std::invalid_argument{buf.str()};
+  }
+
+  SizeType idx[3];
+  double w0[3];
+  double w1[3];
+  SizeType stride[3];
+  SizeType s = 1;
+  for ( SizeType i = d; i > 0; -- i ) {
+    stride[i - 1] = s;
+    s *= lut.index_num(i - 1);
+  }
+  for ( auto i: Range(d) ) {
+    auto n = lut.index_num(i);
+    auto val = val_array[i];
+    if ( n == 1 ) {
+      idx[i] = 0;
+      w0[i] = 1.0;
+      w1[i] = 0.0;
+      continue;
+    }
+    SizeType a = 0;
+    if ( val >= lut.index(i, n - 1) ) {
+      a = n - 2;
+    }
+    else {
+      while ( a < n - 2 && val >= lut.index(i, a + 1) ) {
+	++ a;
+      }
+    }
+    double x0 = lut.index(i, a);
+    double x1 = lut.index(i, a + 1);
+    double w = x1 - x0;
+    idx[i] = a;
+    w0[i] = (x1 - val) / w;
+    w1[i] = (val - x0) / w;
+  }
+
+  SizeType num = 0;
+  for ( SizeType b = 0; b < (1U << d); ++ b ) {
+    double weight = 1.0;
+    SizeType pos = 0;
+    bool valid = true;
+    for ( auto i: Range(d) ) {
+      auto bit = (b >> i) & 1U;
+      if ( bit && lut.index_num(i) == 1 ) {
+	valid = false;
+	break;
+      }
+      weight *= bit ? w1[i] : w0[i];
+      pos += (idx[i] + bit) * stride[i];
+    }
+    if ( valid ) {
+      weight_list[num] = Weight{pos, weight};
+      ++ num;
+    }
+  }
+  return num;
+}
+
+// @brief 格子点の値を順に追加する．
+void
+LutGrid::append_values(
+  const ClibLut& lut,
+  vector<double>& values
+)
+{
+  SizeType d = lut.dimension();
+  SizeType n = grid_num(lut);
+  vector<SizeType> pos_array(d, 0);
+  for ( SizeType k = 0; k < n; ++ k ) {
+    values.push_back(lut.grid_value(pos_array));
+    for ( SizeType l = d; l > 0; -- l ) {
+      if ( ++ pos_array[l - 1] < lut.index_num(l - 1) ) {
+	break;
+      }
+      pos_array[l - 1] = 0;
+    }
+  }
+}
+
+END_NAMESPACE_YM_CLIB
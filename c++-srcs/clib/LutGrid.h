@@ -0,0 +1,89 @@
+#ifndef LUTGRID_H
+#define LUTGRID_H
+
+/// @file LutGrid.h
+/// @brief LutGrid のヘッダファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2024 Yusuke Matsunaga
+/// All rights reserved.
+
+#include "ym/ClibLut.h"
+
+
+BEGIN_NAMESPACE_YM_CLIB
+
+//////////////////////////////////////////////////////////////////////
+/// @class LutGrid LutGrid.h "LutGrid.h"
+/// @brief LUT の格子点の値を別の配列に持つクラスのための関数群
+///
+/// 格子点は最後の軸が最も速く変わる順に並べる．
+/// ClibMultiCorner と ClibDeratedLibrary で用いられる．
+//////////////////////////////////////////////////////////////////////
+class LutGrid
+{
+public:
+
+  /// @brief 補間に用いる格子点
+  struct Weight
+  {
+    // LUT の値の中での位置
+    SizeType pos;
+
+    // 重み
+    double weight;
+  };
+
+  /// @brief 重みのリストの最大長
+  static
+  const SizeType MAX_WEIGHT = 8;
+
+
+public:
+  //////////////////////////////////////////////////////////////////////
+  // 外部インターフェイス
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief 格子点の総数を返す．
+  static
+  SizeType
+  grid_num(
+    const ClibLut& lut ///< [in] 対象の LUT
+  );
+
+  /// @brief 格子点座標から LUT の値の中での位置を求める．
+  ///
+  /// 座標が範囲外の場合は std::out_of_range 例外を送出する．
+  static
+  SizeType
+  grid_pos(
+    const ClibLut& lut,               ///< [in] 対象の LUT
+    const vector<SizeType>& pos_array ///< [in] 格子点座標
+  );
+
+  /// @brief 補間に用いる格子点と重みのリストを求める．
+  /// @return weight_list に設定した要素数を返す．
+  ///
+  /// 補間の方法は CiLut::value() と同じ．
+  /// weight_list は MAX_WEIGHT 以上の大きさを持たなければならない．
+  static
+  SizeType
+  weights(
+    const ClibLut& lut,              ///< [in] 対象の LUT
+    const vector<double>& val_array, ///< [in] 入力の値の配列
+    Weight weight_list[]             ///< [out] 格子点と重みのリスト
+  );
+
+  /// @brief 格子点の値を順に追加する．
+  static
+  void
+  append_values(
+    const ClibLut& lut,    ///< [in] 対象の LUT
+    vector<double>& values ///< [out] 値を追加するリスト
+  );
+
+};
+
+END_NAMESPACE_YM_CLIB
+
+#endif // LUTGRID_H
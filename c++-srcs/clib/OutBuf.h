@@ -0,0 +1,276 @@
+#ifndef OUTBUF_H
+#define OUTBUF_H
+
+/// @file OutBuf.h
+/// @brief OutBuf のヘッダファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2024 Yusuke Matsunaga
+/// All rights reserved.
+
+#include "ym/clib.h"
+#include "ym/ClibArea.h"
+#include "ym/ClibCapacitance.h"
+#include "ym/ClibResistance.h"
+#include "ym/ClibTime.h"
+#include <charconv>
+#include <atomic>
+#include <thread>
+#include <exception>
+#include <algorithm>
+
+
+BEGIN_NAMESPACE_YM_CLIB
+
+//////////////////////////////////////////////////////////////////////
+/// @class OutBuf OutBuf.h "OutBuf.h"
+/// @brief 出力用の文字列バッファ
+///
+/// ostream を介さずに std::string に追記していく．
+/// 数値は std::to_chars() で変換する．
+/// 実数は precision が 0 の時は元の値に戻せる最短の表記で，
+/// それ以外の時は ostream の既定の書式(%g)と同じ表記で出力する．
+//////////////////////////////////////////////////////////////////////
+class OutBuf
+{
+public:
+
+  /// @brief コンストラクタ
+  explicit
+  OutBuf(
+    int precision = 0 ///< [in] 実数の有効桁数
+  ) : mPrecision{precision}
+  {
+  }
+
+  /// @brief デストラクタ
+  ~OutBuf() = default;
+
+
+public:
+  //////////////////////////////////////////////////////////////////////
+  // 外部インターフェイス
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief 内容を返す．
+  const string&
+  str() const
+  {
+    return mBuf;
+  }
+
+  /// @brief 内容をストリームに書き出してクリアする．
+  void
+  flush(
+    ostream& s ///< [in] 出力先のストリーム
+  )
+  {
+    s.write(mBuf.data(), mBuf.size());
+    mBuf.clear();
+  }
+
+  /// @brief 要素ごとの出力を複数のスレッドで作って順番に出力する．
+  ///
+  /// func(buf, pos) で pos 番目の要素の内容を buf に書き込む．
+  /// 自身の内容を先に出力する．
+  /// thread_num が 1 以下の場合は単一のスレッドで処理を行う．
+  /// スレッド数は n を超えない．
+  /// いずれの場合も出力結果は同一となる．
+  /// func が例外を送出した場合は全てのスレッドの終了を待ってから
+  /// その例外を送出し直す．この時，要素の内容は出力されない．
+  template<class F>
+  void
+  write_parallel(
+    ostream& s,          ///< [in] 出力先のストリーム
+    SizeType n,          ///< [in] 要素数
+    SizeType thread_num, ///< [in] スレッド数
+    F&& func             ///< [in] 個々の要素を出力する関数
+  )
+  {
+    flush(s);
+    if ( thread_num <= 1 || n <= 1 ) {
+      for ( SizeType pos = 0; pos < n; ++ pos ) {
+	func(*this, pos);
+	flush(s);
+      }
+      return;
+    }
+
+    // 要素数より多くのスレッドを作っても意味がない．
+    thread_num = std::min(thread_num, n);
+    vector<OutBuf> buf_list(n, OutBuf{mPrecision});
+    std::atomic<SizeType> next{0};
+    // ワーカーで送出された例外は join() 後に送出し直す．
+    vector<std::exception_ptr> error_list(thread_num);
+    auto worker = [&](SizeType id) {
+      try {
+	for ( ; ; ) {
+	  SizeType pos = next ++;
+	  if ( pos >= n ) {
+	    break;
+	  }
+	  func(buf_list[pos], pos);
+	}
+      }
+      catch ( ... ) {
+	error_list[id] = std::current_exception();
+	// 他のスレッドも打ち切らせる．
+	next = n;
+      }
+    };
+    vector<std::thread> thread_list;
+    thread_list.reserve(thread_num);
+    for ( SizeType i = 0; i < thread_num; ++ i ) {
+      thread_list.emplace_back(worker, i);
+    }
+    for ( auto& th: thread_list ) {
+      th.join();
+    }
+    for ( auto& error: error_list ) {
+      if ( error ) {
+	std::rethrow_exception(error);
+      }
+    }
+    // 元の順番で連結する．
+    for ( auto& buf: buf_list ) {
+      buf.flush(s);
+    }
+  }
+
+  /// @brief 文字を追加する．
+  OutBuf&
+  operator<<(
+    char c
+  )
+  {
+    mBuf.push_back(c);
+    return *this;
+  }
+
+  /// @brief 文字列を追加する．
+  OutBuf&
+  operator<<(
+    const char* str
+  )
+  {
+    mBuf.append(str);
+    return *this;
+  }
+
+  /// @brief 文字列を追加する．
+  OutBuf&
+  operator<<(
+    const string& str
+  )
+  {
+    mBuf.append(str);
+    return *this;
+  }
+
+  /// @brief 符号なし整数を追加する．
+  OutBuf&
+  operator<<(
+    SizeType val
+  )
+  {
+    char tmp[24];
+    auto res = std::to_chars(tmp, tmp + sizeof(tmp), val);
+    mBuf.append(tmp, res.ptr);
+    return *this;
+  }
+
+  /// @brief 整数を追加する．
+  OutBuf&
+  operator<<(
+    int val
+  )
+  {
+    char tmp[16];
+    auto res = std::to_chars(tmp, tmp + sizeof(tmp), val);
+    mBuf.append(tmp, res.ptr);
+    return *this;
+  }
+
+  /// @brief 実数を追加する．
+  OutBuf&
+  operator<<(
+    double val
+  )
+  {
+    char tmp[32];
+    auto res = mPrecision == 0 ?
+      std::to_chars(tmp, tmp + sizeof(tmp), val) :
+      std::to_chars(tmp, tmp + sizeof(tmp), val,
+		    std::chars_format::general, mPrecision);
+    mBuf.append(tmp, res.ptr);
+    return *this;
+  }
+
+  /// @brief 面積を追加する．
+  OutBuf&
+  operator<<(
+    const ClibArea& val
+  )
+  {
+    return operator<<(val.value());
+  }
+
+  /// @brief 容量を追加する．
+  OutBuf&
+  operator<<(
+    const ClibCapacitance& val
+  )
+  {
+    return operator<<(val.value());
+  }
+
+  /// @brief 抵抗を追加する．
+  OutBuf&
+  operator<<(
+    const ClibResistance& val
+  )
+  {
+    return operator<<(val.value());
+  }
+
+  /// @brief 時間を追加する．
+  OutBuf&
+  operator<<(
+    const ClibTime& val
+  )
+  {
+    return operator<<(val.value());
+  }
+
+  /// @brief その他の型の値を追加する．
+  ///
+  /// ストリーム出力演算子を用いるので遅い．
+  template<class T>
+  OutBuf&
+  operator<<(
+    const T& val
+  )
+  {
+    ostringstream tmp;
+    tmp << val;
+    mBuf.append(tmp.str());
+    return *this;
+  }
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // データメンバ
+  //////////////////////////////////////////////////////////////////////
+
+  // 実数の有効桁数
+  int mPrecision;
+
+  // 本体
+  string mBuf;
+
+};
+
+END_NAMESPACE_YM_CLIB
+
+#endif // OUTBUF_H
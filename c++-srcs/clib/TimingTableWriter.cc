@@ -0,0 +1,270 @@
+/// @file TimingTableWriter.cc
+/// @brief TimingTableWriter の実装ファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2024 Yusuke Matsunaga
+/// All rights reserved.
+
+#include "TimingTableWriter.h"
+#include "ym/ClibCell.h"
+#include "ym/ClibPin.h"
+#include "ym/ClibTiming.h"
+#include "ym/Range.h"
+
+
+BEGIN_NAMESPACE_YM_CLIB
+
+BEGIN_NONAMESPACE
+
+// 出力形式の識別子
+const char MAGIC[8] = { 'Y', 'M', 'C', 'L', 'T', 'B', 'L', '1' };
+
+// セクション数
+const SizeType SECTION_NUM = 15;
+
+// 8 バイト境界に切り上げる．
+inline
+std::uint64_t
+align8(
+  std::uint64_t pos
+)
+{
+  return (pos + 7) & ~static_cast<std::uint64_t>(7);
+}
+
+// 1つのセクションの内容
+struct Section
+{
+  const void* data;
+  std::uint64_t size;
+};
+
+// vector の内容をセクションにする．
+template<class T>
+Section
+make_section(
+  const vector<T>& vec
+)
+{
+  return Section{vec.data(), vec.size() * sizeof(T)};
+}
+
+// 64ビットの値を書き出す．
+inline
+void
+write_64(
+  ostream& s,
+  std::uint64_t val
+)
+{
+  s.write(reinterpret_cast<const char*>(&val), sizeof(val));
+}
+
+END_NONAMESPACE
+
+
+//////////////////////////////////////////////////////////////////////
+// クラス TimingTableWriter
+//////////////////////////////////////////////////////////////////////
+
+// @brief コンストラクタ
+TimingTableWriter::TimingTableWriter(
+  const ClibCellLibrary& library
+)
+{
+  // (入力ピン, 出力ピン) ごとにタイミング情報をたどる．
+  for ( auto cell: library.cell_list() ) {
+    auto cell_id = string_id(cell.name());
+    for ( auto ipos: Range(cell.input2_num()) ) {
+      auto ipin_id = string_id(cell.input2(ipos).name());
+      for ( auto opos: Range(cell.output2_num()) ) {
+	auto opin_id = string_id(cell.output2(opos).name());
+	// non_unate のタイミングとエッジのタイミングは両方のリストに
+	// 含まれているので non_unate として1回だけ出力する．
+	auto p_list = cell.timing_list(ipos, opos, ClibTimingSense::positive_unate);
+	auto n_list = cell.timing_list(ipos, opos, ClibTimingSense::negative_unate);
+	auto in_list = [](const ClibTimingList& timing_list,
+			  const ClibTiming& timing) {
+	  for ( auto timing1: timing_list ) {
+	    if ( timing1 == timing ) {
+	      return true;
+	    }
+	  }
+	  return false;
+	};
+	for ( auto timing: p_list ) {
+	  auto sense = in_list(n_list, timing) ?
+	    ClibTimingSense::non_unate : ClibTimingSense::positive_unate;
+	  add_timing(cell_id, ipin_id, opin_id, sense, timing);
+	}
+	for ( auto timing: n_list ) {
+	  if ( !in_list(p_list, timing) ) {
+	    add_timing(cell_id, ipin_id, opin_id,
+		       ClibTimingSense::negative_unate, timing);
+	  }
+	}
+      }
+    }
+  }
+}
+
+// @brief 内容を出力する．
+void
+TimingTableWriter::run(
+  ostream& s
+) const
+{
+  // 文字列テーブルを作る．
+  vector<std::uint64_t> string_begin;
+  string_begin.reserve(mStringList.size() + 1);
+  string string_data;
+  for ( auto& str: mStringList ) {
+    string_begin.push_back(string_data.size());
+    string_data.append(str);
+  }
+  string_begin.push_back(string_data.size());
+
+  Section section_list[SECTION_NUM] = {
+    make_section(mCellCol),
+    make_section(mRelatedPinCol),
+    make_section(mPinCol),
+    make_section(mTimingTypeCol),
+    make_section(mTimingSenseCol),
+    make_section(mTableKindCol),
+    make_section(mDimensionCol),
+    make_section(mVarTypeCol),
+    make_section(mAxisSizeCol),
+    make_section(mIndexBeginCol),
+    make_section(mValueBeginCol),
+    make_section(mIndexValues),
+    make_section(mValues),
+    make_section(string_begin),
+    Section{string_data.data(), string_data.size()}
+  };
+
+  // 各セクションの位置を求める．
+  std::uint64_t pos = sizeof(MAGIC) + sizeof(std::uint64_t) * (5 + SECTION_NUM);
+  std::uint64_t offset_list[SECTION_NUM];
+  for ( auto i: Range(SECTION_NUM) ) {
+    pos = align8(pos);
+    offset_list[i] = pos;
+    pos += section_list[i].size;
+  }
+
+  // ヘッダ
+  s.write(MAGIC, sizeof(MAGIC));
+  write_64(s, mCellCol.size());
+  write_64(s, mStringList.size());
+  write_64(s, mIndexValues.size());
+  write_64(s, mValues.size());
+  write_64(s, SECTION_NUM);
+  for ( auto offset: offset_list ) {
+    write_64(s, offset);
+  }
+
+  // 本体
+  pos = sizeof(MAGIC) + sizeof(std::uint64_t) * (5 + SECTION_NUM);
+  const char pad[8] = { 0 };
+  for ( auto i: Range(SECTION_NUM) ) {
+    auto& section = section_list[i];
+    s.write(pad, offset_list[i] - pos);
+    s.write(static_cast<const char*>(section.data), section.size);
+    pos = offset_list[i] + section.size;
+  }
+}
+
+// @brief タイミングの LUT をすべて追加する．
+void
+TimingTableWriter::add_timing(
+  std::uint32_t cell_id,
+  std::uint32_t ipin_id,
+  std::uint32_t opin_id,
+  ClibTimingSense timing_sense,
+  const ClibTiming& timing
+)
+{
+  auto type = timing.type();
+  auto add = [&](TableKind kind, const ClibLut& lut) {
+    if ( lut.is_valid() ) {
+      add_row(cell_id, ipin_id, opin_id, type, timing_sense, kind, lut);
+    }
+  };
+  add(CellRise, timing.cell_rise());
+  add(CellFall, timing.cell_fall());
+  add(RiseTransition, timing.rise_transition());
+  add(FallTransition, timing.fall_transition());
+  add(RisePropagation, timing.rise_propagation());
+  add(FallPropagation, timing.fall_propagation());
+}
+
+// @brief LUT を1行分追加する．
+void
+TimingTableWriter::add_row(
+  std::uint32_t cell_id,
+  std::uint32_t ipin_id,
+  std::uint32_t opin_id,
+  ClibTimingType timing_type,
+  ClibTimingSense timing_sense,
+  TableKind kind,
+  const ClibLut& lut
+)
+{
+  mCellCol.push_back(cell_id);
+  mRelatedPinCol.push_back(ipin_id);
+  mPinCol.push_back(opin_id);
+  mTimingTypeCol.push_back(static_cast<std::uint8_t>(timing_type));
+  mTimingSenseCol.push_back(static_cast<std::uint8_t>(timing_sense));
+  mTableKindCol.push_back(kind);
+  auto d = lut.dimension();
+  mDimensionCol.push_back(d);
+  mIndexBeginCol.push_back(mIndexValues.size());
+  mValueBeginCol.push_back(mValues.size());
+  for ( auto i: Range(3) ) {
+    if ( i < d ) {
+      auto n = lut.index_num(i);
+      mVarTypeCol.push_back(static_cast<std::uint8_t>(lut.variable_type(i)));
+      mAxisSizeCol.push_back(n);
+      for ( auto j: Range(n) ) {
+	mIndexValues.push_back(lut.index(i, j));
+      }
+    }
+    else {
+      mVarTypeCol.push_back(static_cast<std::uint8_t>(ClibVarType::none));
+      mAxisSizeCol.push_back(0);
+    }
+  }
+
+  // 格子点の値を最後の軸が最も速く変わる順に並べる．
+  SizeType n = 1;
+  for ( auto i: Range(d) ) {
+    n *= lut.index_num(i);
+  }
+  vector<SizeType> pos_array(d, 0);
+  for ( SizeType k = 0; k < n; ++ k ) {
+    mValues.push_back(lut.grid_value(pos_array));
+    for ( SizeType i = d; i > 0; -- i ) {
+      if ( ++ pos_array[i - 1] < lut.index_num(i - 1) ) {
+	break;
+      }
+      pos_array[i - 1] = 0;
+    }
+  }
+}
+
+// @brief 文字列番号を返す．
+std::uint32_t
+TimingTableWriter::string_id(
+  const string& str
+)
+{
+  auto p = mStringDict.find(str);
+  if ( p != mStringDict.end() ) {
+    return p->second;
+  }
+  std::uint32_t id = mStringList.size();
+  mStringList.push_back(str);
+  mStringDict.emplace(str, id);
+  return id;
+}
+
+END_NAMESPACE_YM_CLIB
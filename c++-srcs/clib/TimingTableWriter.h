@@ -0,0 +1,152 @@
+#ifndef TIMINGTABLEWRITER_H
+#define TIMINGTABLEWRITER_H
+
+/// @file TimingTableWriter.h
+/// @brief TimingTableWriter のヘッダファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2024 Yusuke Matsunaga
+/// All rights reserved.
+
+#include "ym/ClibCellLibrary.h"
+#include "ym/ClibLut.h"
+
+
+BEGIN_NAMESPACE_YM_CLIB
+
+//////////////////////////////////////////////////////////////////////
+/// @class TimingTableWriter TimingTableWriter.h "TimingTableWriter.h"
+/// @brief タイミング情報の LUT を列指向のバイナリ形式で出力するクラス
+///
+/// 1つの行は (セル, 入力ピン, 出力ピン, タイミング, テーブルの種類)
+/// に対応する．
+/// 出力形式は以下の通り．数値はすべてネイティブのバイトオーダーで，
+/// 各セクションの先頭は 8 バイト境界に揃えてあるので，
+/// ファイルをそのままメモリマップして配列として参照できる．
+///
+/// - ヘッダ
+///   - magic:        char[8] = "YMCLTBL1"
+///   - row_num:      uint64  行数(N)
+///   - string_num:   uint64  文字列数(S)
+///   - index_num:    uint64  インデックス値の総数
+///   - value_num:    uint64  テーブル値の総数
+///   - section_num:  uint64  セクション数(= 15)
+///   - offset:       uint64[section_num] 各セクションのファイル先頭からの位置
+/// - セクション
+///   -  0: cell         uint32[N]   セル名の文字列番号
+///   -  1: related_pin  uint32[N]   入力ピン名の文字列番号
+///   -  2: pin          uint32[N]   出力ピン名の文字列番号
+///   -  3: timing_type  uint8[N]    ClibTimingType の値
+///   -  4: timing_sense uint8[N]    ClibTimingSense の値
+///                                  (エッジのタイミングは non_unate)
+///   -  5: table_kind   uint8[N]    テーブルの種類(TableKind の値)
+///   -  6: dimension    uint8[N]    テーブルの次元
+///   -  7: var_type     uint8[N*3]  各軸の ClibVarType の値
+///   -  8: axis_size    uint32[N*3] 各軸のインデックス数(未使用の軸は 0)
+///   -  9: index_begin  uint64[N]   index_values 上の先頭位置
+///   - 10: value_begin  uint64[N]   values 上の先頭位置
+///   - 11: index_values double[]    各行の軸のインデックス値を軸の順に連結したもの
+///   - 12: values       double[]    各行のテーブル値(最後の軸が最も速く変わる)
+///   - 13: string_begin uint64[S+1] string_data 上の各文字列の先頭位置
+///   - 14: string_data  char[]      文字列の本体(終端文字なし)
+//////////////////////////////////////////////////////////////////////
+class TimingTableWriter
+{
+public:
+
+  /// @brief テーブルの種類
+  enum TableKind : std::uint8_t {
+    CellRise        = 0,
+    CellFall        = 1,
+    RiseTransition  = 2,
+    FallTransition  = 3,
+    RisePropagation = 4,
+    FallPropagation = 5
+  };
+
+  /// @brief コンストラクタ
+  TimingTableWriter(
+    const ClibCellLibrary& library ///< [in] セルライブラリ
+  );
+
+  /// @brief デストラクタ
+  ~TimingTableWriter() = default;
+
+
+public:
+  //////////////////////////////////////////////////////////////////////
+  // 外部インターフェイス
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief 内容を出力する．
+  void
+  run(
+    ostream& s ///< [in] 出力ストリーム
+  ) const;
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // 内部で用いられる関数
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief タイミングの LUT をすべて追加する．
+  void
+  add_timing(
+    std::uint32_t cell_id,
+    std::uint32_t ipin_id,
+    std::uint32_t opin_id,
+    ClibTimingSense timing_sense,
+    const ClibTiming& timing
+  );
+
+  /// @brief LUT を1行分追加する．
+  void
+  add_row(
+    std::uint32_t cell_id,
+    std::uint32_t ipin_id,
+    std::uint32_t opin_id,
+    ClibTimingType timing_type,
+    ClibTimingSense timing_sense,
+    TableKind kind,
+    const ClibLut& lut
+  );
+
+  /// @brief 文字列番号を返す．
+  std::uint32_t
+  string_id(
+    const string& str
+  );
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // データメンバ
+  //////////////////////////////////////////////////////////////////////
+
+  // 各列の内容
+  vector<std::uint32_t> mCellCol;
+  vector<std::uint32_t> mRelatedPinCol;
+  vector<std::uint32_t> mPinCol;
+  vector<std::uint8_t> mTimingTypeCol;
+  vector<std::uint8_t> mTimingSenseCol;
+  vector<std::uint8_t> mTableKindCol;
+  vector<std::uint8_t> mDimensionCol;
+  vector<std::uint8_t> mVarTypeCol;
+  vector<std::uint32_t> mAxisSizeCol;
+  vector<std::uint64_t> mIndexBeginCol;
+  vector<std::uint64_t> mValueBeginCol;
+  vector<double> mIndexValues;
+  vector<double> mValues;
+
+  // 文字列のリスト
+  vector<string> mStringList;
+
+  // 文字列番号の辞書
+  std::unordered_map<string, std::uint32_t> mStringDict;
+
+};
+
+END_NAMESPACE_YM_CLIB
+
+#endif // TIMINGTABLEWRITER_H
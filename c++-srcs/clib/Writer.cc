@@ -7,6 +7,7 @@
 /// All rights reserved.
 
 #include "Writer.h"
+#include "OutBuf.h"
 #include "ym/ClibCellLibrary.h"
 #include "ym/ClibCell.h"
 #include "ym/ClibIOMap.h"
@@ -279,11 +280,16 @@ Writer::Writer(
 // @brief セルライブラリの内容を出力する．
 void
 Writer::run(
-  ostream& s
+  ostream& os,
+  SizeType thread_num
 ) const
 {
+  // 出力はいったん OutBuf に書き込む．
+  // 実数の書式は ostream の既定値に合わせる．
+  OutBuf s{6};
+
   // ライブラリ名
-  s << "Library(" << mLibrary.name() << ")" << endl;
+  s << "Library(" << mLibrary.name() << ")" << '\n';
 
   // テクノロジ
   s << "  technology: ";
@@ -292,59 +298,62 @@ Writer::run(
   case ClibTechnology::fpga: s << "fpga"; break;
   default: ASSERT_NOT_REACHED; break;
   }
-  s << endl;
+  s << '\n';
 
   // 遅延モデル
   s << "  delay_model: "
-    << mLibrary.delay_model() << endl;
+    << mLibrary.delay_model() << '\n';
 
   // バス命名規則
   s << "  bus_naming_style: "
-    << mLibrary.bus_naming_style() << endl;
+    << mLibrary.bus_naming_style() << '\n';
 
   // 日付
   s << "  date: "
-    << mLibrary.date() << endl;
+    << mLibrary.date() << '\n';
 
   // リビジョン
   s << "  revision: "
-    << mLibrary.revision() << endl;
+    << mLibrary.revision() << '\n';
 
   // コメント
   s << "  comment: "
-    << mLibrary.comment() << endl;
+    << mLibrary.comment() << '\n';
 
   // 時間単位
   s << "  time_unit: "
-    << mLibrary.time_unit() << endl;
+    << mLibrary.time_unit() << '\n';
 
   // 電圧単位
   s << "  voltage_unit: "
-    << mLibrary.voltage_unit() << endl;
+    << mLibrary.voltage_unit() << '\n';
 
   // 電流単位
   s << "  current_unit: "
-    << mLibrary.current_unit() << endl;
+    << mLibrary.current_unit() << '\n';
 
   // 抵抗単位
   s << "  pulling_resistance_unit: "
-    << mLibrary.pulling_resistance_unit() << endl;
+    << mLibrary.pulling_resistance_unit() << '\n';
 
   // 容量単位
   s << "  capacitive_load_unit: "
     << mLibrary.capacitive_load_unit()
-    << mLibrary.capacitive_load_unit_str() << endl;
+    << mLibrary.capacitive_load_unit_str() << '\n';
 
   // 電力単位
   s << "  leakage_power_unit: "
-    << mLibrary.leakage_power_unit() << endl;
+    << mLibrary.leakage_power_unit() << '\n';
 
-  s << endl;
+  s << '\n';
 
   // セル
-  for ( auto cell: mLibrary.cell_list() ) {
-    display_cell(s, cell);
-  }
+  // セルごとの出力は独立しているので並列に作る．
+  auto cell_list = mLibrary.cell_list();
+  s.write_parallel(os, cell_list.size(), thread_num,
+		   [&](OutBuf& buf, SizeType pos) {
+		     display_cell(buf, cell_list[pos]);
+		   });
 
   // セルグループ
   for ( auto cgroup: mLibrary.cell_group_list() ) {
@@ -359,12 +368,13 @@ Writer::run(
   // パタングラフの情報
   display_patgraph(s);
 
+  s.flush(os);
 }
 
 // セルクラスの情報を出力する．
 void
 Writer::display_class(
-  ostream& s,
+  OutBuf& s,
   const ClibCellClass& cclass
 ) const
 {
@@ -382,34 +392,34 @@ Writer::display_class(
 
   s << "Class#"
     << mClassDict.at(cclass.key())
-    << endl;
+    << '\n';
   if ( mClassNameDict.count(cclass.key()) > 0 ) {
     auto name = mClassNameDict.at(cclass.key());
     s << "  Name = " << name
-      << endl;
+      << '\n';
   }
   auto n = cclass.idmap_num();
   if ( n > 0 ) {
-    s << "  Idmap List:" << endl;
+    s << "  Idmap List:" << '\n';
     for ( auto& idmap: cclass.idmap_list() ) {
-      s << "         " << idmap << endl;
+      s << "         " << idmap << '\n';
     }
-    s << endl;
+    s << '\n';
   }
   for ( auto group: cclass.cell_group_list() ) {
     if ( group.cell_list().size() == 0 ) {
       continue;
     }
     s << "  Group#" << mGroupDict.at(group.key())
-      << ": Map = " << group.iomap() << endl;
+      << ": Map = " << group.iomap() << '\n';
   }
-  s << endl;
+  s << '\n';
 }
 
 // セルグループの情報を出力する．
 void
 Writer::display_group(
-  ostream& s,
+  OutBuf& s,
   const ClibCellGroup& group
 ) const
 {
@@ -422,23 +432,23 @@ Writer::display_group(
     << mGroupDict.at(group.key())
     << "(Class#"
     << mClassDict.at(group.rep_class().key())
-    << ")" << endl;
+    << ")" << '\n';
   if ( mGroupNameDict.count(group.key()) > 0 ) {
     auto name = mGroupNameDict.at(group.key());
     s << "  Name = " << name
-      << endl;
+      << '\n';
   }
   s << "  Cell =";
   for ( auto cell: group.cell_list() ) {
     s << " " << cell.name();
   }
-  s << endl
-    << endl;
+  s << '\n'
+    << '\n';
 }
 
 void
 Writer::display_cell(
-  ostream& s,
+  OutBuf& s,
   const ClibCell& cell
 ) const
 {
@@ -447,7 +457,7 @@ Writer::display_cell(
     << mCellDict.at(cell.key())
     << "(Group#"
     << mGroupDict.at(cell.group().key())
-    << ")" << endl
+    << ")" << '\n'
     << "  type = ";
   if ( cell.is_logic() ) {
     s << "Combinational Logic";
@@ -464,10 +474,10 @@ Writer::display_cell(
   else {
     ASSERT_NOT_REACHED;
   }
-  s << endl;
+  s << '\n';
 
   // 面積
-  s << "  area = " << cell.area() << endl;
+  s << "  area = " << cell.area() << '\n';
 
   // 論理式の出力用にピン名の辞書を作る．
   unordered_map<SizeType, string> var_names;
@@ -483,28 +493,28 @@ Writer::display_cell(
     var_names.emplace(cell.input2_num(), cell.qvar1());
     s << "  Next State         = "
       << ewriter.dump_to_string(cell.next_state_expr(), var_names)
-      << endl
+      << '\n'
       << "  Clock              = "
       << ewriter.dump_to_string(cell.clock_expr(), var_names)
-      << endl;
+      << '\n';
     if ( cell.clock2_expr().is_valid() ) {
       s << "  Clock2             = "
 	<< ewriter.dump_to_string(cell.clock2_expr(), var_names)
-	<< endl;
+	<< '\n';
     }
     if ( cell.has_clear() ) {
       s << "  Clear              = "
 	<< ewriter.dump_to_string(cell.clear_expr(), var_names)
-	<< endl;
+	<< '\n';
     }
     if ( cell.has_preset() ) {
       s << "  Preset             = "
 	<< ewriter.dump_to_string(cell.preset_expr(), var_names)
-	<< endl;
+	<< '\n';
     }
     if ( cell.has_clear() && cell.has_preset() ) {
-      s << "  Clear Preset Var1  = " << cell.clear_preset_var1() << endl
-	<< "  Clear Preset Var2  = " << cell.clear_preset_var2() << endl;
+      s << "  Clear Preset Var1  = " << cell.clear_preset_var1() << '\n'
+	<< "  Clear Preset Var2  = " << cell.clear_preset_var2() << '\n';
     }
   }
   if ( cell.is_latch() ) {
@@ -512,28 +522,28 @@ Writer::display_cell(
     var_names.emplace(cell.input2_num(), cell.qvar1());
     s << "  Data In            = "
       << ewriter.dump_to_string(cell.data_in_expr(), var_names)
-      << endl
+      << '\n'
       << "  Enable             = "
       << ewriter.dump_to_string(cell.enable_expr(), var_names)
-      << endl;
+      << '\n';
     if ( cell.enable2_expr().is_valid() ) {
       s << "  Enable2            = "
 	<< ewriter.dump_to_string(cell.enable2_expr(), var_names)
-	<< endl;
+	<< '\n';
     }
     if ( cell.has_clear() ) {
       s << "  Clear              = "
 	<< ewriter.dump_to_string(cell.clear_expr(), var_names)
-	<< endl;
+	<< '\n';
     }
     if ( cell.has_preset() ) {
       s << "  Preset             = "
 	<< ewriter.dump_to_string(cell.preset_expr(), var_names)
-	<< endl;
+	<< '\n';
     }
     if ( cell.has_clear() && cell.has_preset() ) {
-      s << "  Clear Preset Var1  = " << cell.clear_preset_var1() << endl
-	<< "  Clear Preset Var2  = " << cell.clear_preset_var2() << endl;
+      s << "  Clear Preset Var1  = " << cell.clear_preset_var1() << '\n'
+	<< "  Clear Preset Var2  = " << cell.clear_preset_var2() << '\n';
     }
   }
 
@@ -542,61 +552,61 @@ Writer::display_cell(
     s << "  Pin#" << pin.pin_id() << "[ " << pin.name() << " ]: ";
     if ( pin.is_input() ) {
       // 入力ピン
-      s << "Input#" << pin.input_id() << endl
-	<< "    Capacitance      = " << pin.capacitance() << endl
-	<< "    Rise Capacitance = " << pin.rise_capacitance() << endl
-	<< "    Fall Capacitance = " << pin.fall_capacitance() << endl;
+      s << "Input#" << pin.input_id() << '\n'
+	<< "    Capacitance      = " << pin.capacitance() << '\n'
+	<< "    Rise Capacitance = " << pin.rise_capacitance() << '\n'
+	<< "    Fall Capacitance = " << pin.fall_capacitance() << '\n';
     }
     else if ( pin.is_output() ) {
       // 出力ピン
       auto opos = pin.output_id();
-      s << "Output# " << opos << endl;
+      s << "Output# " << opos << '\n';
       if ( cell.has_logic(opos) ) {
 	s << "    Logic            = "
 	  << ewriter.dump_to_string(cell.logic_expr(opos), var_names)
-	  << endl;
+	  << '\n';
 	if ( cell.has_tristate(opos) ) {
 	  s << "    Tristate         = "
 	    << ewriter.dump_to_string(cell.tristate_expr(opos), var_names)
-	    << endl;
+	    << '\n';
 	}
       }
-      s << "    Max Fanout       = " << pin.max_fanout() << endl
-	<< "    Min Fanout       = " << pin.min_fanout() << endl
-	<< "    Max Capacitance  = " << pin.max_capacitance() << endl
-	<< "    Min Capacitance  = " << pin.min_capacitance() << endl
-	<< "    Max Transition   = " << pin.max_transition() << endl
-	<< "    Min Transition   = " << pin.min_transition() << endl;
+      s << "    Max Fanout       = " << pin.max_fanout() << '\n'
+	<< "    Min Fanout       = " << pin.min_fanout() << '\n'
+	<< "    Max Capacitance  = " << pin.max_capacitance() << '\n'
+	<< "    Min Capacitance  = " << pin.min_capacitance() << '\n'
+	<< "    Max Transition   = " << pin.max_transition() << '\n'
+	<< "    Min Transition   = " << pin.min_transition() << '\n';
     }
     else if ( pin.is_inout() ) {
       // 入出力ピン
       auto opos = pin.output_id();
       s << "Inout#(" << pin.input_id()
-	<< ", " << opos << ")" << endl;
+	<< ", " << opos << ")" << '\n';
       if ( cell.has_logic(opos) ) {
 	s << "    Logic            = "
 	  << ewriter.dump_to_string(cell.logic_expr(opos), var_names)
-	  << endl;
+	  << '\n';
 	if ( cell.has_tristate(opos) ) {
 	  s << "    Tristate         = "
 	    << ewriter.dump_to_string(cell.tristate_expr(opos), var_names)
-	    << endl;
+	    << '\n';
 	}
       }
-      s << "    Capacitance      = " << pin.capacitance() << endl
-	<< "    Rise Capacitance = " << pin.rise_capacitance() << endl
-	<< "    Fall Capacitance = " << pin.fall_capacitance() << endl
-	<< "    Max Fanout       = " << pin.max_fanout() << endl
-	<< "    Min Fanout       = " << pin.min_fanout() << endl
-	<< "    Max Capacitance  = " << pin.max_capacitance() << endl
-	<< "    Min Capacitance  = " << pin.min_capacitance() << endl
-	<< "    Max Transition   = " << pin.max_transition() << endl
-	<< "    Min Transition   = " << pin.min_transition() << endl;
+      s << "    Capacitance      = " << pin.capacitance() << '\n'
+	<< "    Rise Capacitance = " << pin.rise_capacitance() << '\n'
+	<< "    Fall Capacitance = " << pin.fall_capacitance() << '\n'
+	<< "    Max Fanout       = " << pin.max_fanout() << '\n'
+	<< "    Min Fanout       = " << pin.min_fanout() << '\n'
+	<< "    Max Capacitance  = " << pin.max_capacitance() << '\n'
+	<< "    Min Capacitance  = " << pin.min_capacitance() << '\n'
+	<< "    Max Transition   = " << pin.max_transition() << '\n'
+	<< "    Min Transition   = " << pin.min_transition() << '\n';
     }
     else if ( pin.is_internal() ) {
       // 内部ピン
       auto ipos = pin.internal_id();
-      s << "Internal#(" << ipos << ")" << endl;
+      s << "Internal#(" << ipos << ")" << '\n';
     }
   }
 
@@ -609,13 +619,13 @@ Writer::display_cell(
       display_timing(s, cell, ipos, opos, ClibTimingSense::negative_unate);
     }
   }
-  s << endl;
+  s << '\n';
 }
 
 // タイミング情報を出力する．
 void
 Writer::display_timing(
-  ostream& s,
+  OutBuf& s,
   const ClibCell& cell,
   SizeType ipos,
   SizeType opos,
@@ -623,10 +633,10 @@ Writer::display_timing(
 ) const
 {
   for ( auto timing: cell.timing_list(ipos, opos, sense) ) {
-    s << "  Timing:" << endl
-      << "    Type             = " << timing.type() << endl
-      << "    Input Pin        = " << cell.input(ipos).name() << endl
-      << "    Output Pin       = " << cell.output(opos).name() << endl
+    s << "  Timing:" << '\n'
+      << "    Type             = " << timing.type() << '\n'
+      << "    Input Pin        = " << cell.input(ipos).name() << '\n'
+      << "    Output Pin       = " << cell.output(opos).name() << '\n'
       << "    Sense            = ";
     if ( sense == ClibTimingSense::positive_unate ) {
       s << "positive unate";
@@ -637,17 +647,17 @@ Writer::display_timing(
     else {
       ASSERT_NOT_REACHED;
     }
-    s << endl;
+    s << '\n';
     if ( !timing.timing_cond().is_one() ) {
-      s << "    When             = " << timing.timing_cond() << endl;
+      s << "    When             = " << timing.timing_cond() << '\n';
     }
 
     switch ( mLibrary.delay_model() ) {
     case ClibDelayModel::generic_cmos:
-      s << "    Rise Intrinsic   = " << timing.intrinsic_rise() << endl
-	<< "    Rise Resistance  = " << timing.rise_resistance() << endl
-	<< "    Fall Intrinsic   = " << timing.intrinsic_fall() << endl
-	<< "    Fall Resistance  = " << timing.fall_resistance() << endl;
+      s << "    Rise Intrinsic   = " << timing.intrinsic_rise() << '\n'
+	<< "    Rise Resistance  = " << timing.rise_resistance() << '\n'
+	<< "    Fall Intrinsic   = " << timing.intrinsic_fall() << '\n'
+	<< "    Fall Resistance  = " << timing.fall_resistance() << '\n';
       break;
 
     case ClibDelayModel::table_lookup:
@@ -681,7 +691,7 @@ Writer::display_timing(
 // LUT の情報を出力する．
 void
 Writer::display_lut(
-  ostream& s,
+  OutBuf& s,
   const string& label,
   const ClibLut& lut
 ) const
@@ -691,9 +701,9 @@ Writer::display_lut(
   }
 
   SizeType d = lut.dimension();
-  s << "    " << label << endl;
+  s << "    " << label << '\n';
   for ( auto i: Range(d) ) {
-    s << "      Variable_" << (i + 1) << " = " << lut.variable_type(i) << endl;
+    s << "      Variable_" << (i + 1) << " = " << lut.variable_type(i) << '\n';
   }
   for ( auto i: Range(d) ) {
     s << "      Index_" << (i + 1) << "    = ";
@@ -704,7 +714,7 @@ Writer::display_lut(
       s << comma << lut.index(i, j);
       comma = ", ";
     }
-    s << ")" << endl;
+    s << ")" << '\n';
   }
 
   if ( d == 1) {
@@ -717,10 +727,10 @@ Writer::display_lut(
       s << comma << lut.grid_value(pos_array);
       comma = ", ";
     }
-    s << ")" << endl;
+    s << ")" << '\n';
   }
   else if ( d == 2 ) {
-    s << "      Values = (" << endl;
+    s << "      Values = (" << '\n';
     auto n1 = lut.index_num(0);
     auto n2 = lut.index_num(1);
     vector<SizeType> pos_array(2);
@@ -733,12 +743,12 @@ Writer::display_lut(
 	s << comma << lut.grid_value(pos_array);
 	comma = ", ";
       }
-      s << ")" << endl;
+      s << ")" << '\n';
     }
-    s << "               )" << endl;
+    s << "               )" << '\n';
   }
   else if ( d == 3 ) {
-    s << "      Values = (" << endl;
+    s << "      Values = (" << '\n';
     auto n1 = lut.index_num(0);
     auto n2 = lut.index_num(1);
     auto n3 = lut.index_num(2);
@@ -759,19 +769,19 @@ Writer::display_lut(
 	s << ")";
 	comma2 = ", ";
       }
-      s << ")" << endl;
+      s << ")" << '\n';
     }
-    s << "                )" << endl;
+    s << "                )" << '\n';
   }
 }
 
 // @brief パタングラフの情報を出力する．
 void
 Writer::display_patgraph(
-  ostream& s
+  OutBuf& s
 ) const
 {
-  s << "==== PatMgr dump start ====" << endl;
+  s << "==== PatMgr dump start ====" << '\n';
 
   // ノードの種類の出力
   auto nn = mLibrary.pg_node_num();
@@ -792,9 +802,9 @@ Writer::display_patgraph(
       ASSERT_NOT_REACHED;
       break;
     }
-    s << endl;
+    s << '\n';
   }
-  s << endl;
+  s << '\n';
 
   // 枝の情報の出力
   auto ne = mLibrary.pg_edge_num();
@@ -805,9 +815,9 @@ Writer::display_patgraph(
     if ( mLibrary.pg_edge_inv(i) ) {
       s << " ***";
     }
-    s << endl;
+    s << '\n';
   }
-  s << endl;
+  s << '\n';
 
   // パタングラフの情報の出力
   auto np = mLibrary.pg_pat_num();
@@ -825,10 +835,10 @@ Writer::display_patgraph(
     for ( auto i: Range(n) ) {
       s << " " << pat.edge(i);
     }
-    s << endl;
+    s << '\n';
   }
 
-  s << "==== PatMgr dump end ====" << endl;
+  s << "==== PatMgr dump end ====" << '\n';
 }
 
 // @brief DFF のセルクラスに名前をつける．
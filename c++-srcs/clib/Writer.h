@@ -13,6 +13,8 @@
 
 BEGIN_NAMESPACE_YM_CLIB
 
+class OutBuf;
+
 //////////////////////////////////////////////////////////////////////
 /// @class Writer Writer.h "Writer.h"
 /// @brief ClibCellLibrary の内容を出力するためのクラス
@@ -40,9 +42,13 @@ public:
   //////////////////////////////////////////////////////////////////////
 
   /// @brief セルライブラリの内容を出力する．
+  ///
+  /// thread_num に 2 以上を指定するとセルごとの出力を複数のスレッドで
+  /// 作ってから元の順番で連結する．
   void
   run(
-    ostream& s ///< [in] 出力ストリーム
+    ostream& s,             ///< [in] 出力ストリーム
+    SizeType thread_num = 1 ///< [in] スレッド数
   ) const;
 
 
@@ -54,28 +60,28 @@ private:
   /// @brief セルクラスの情報を出力する．
   void
   display_class(
-    ostream& s,
+    OutBuf& s,
     const ClibCellClass& cclass
   ) const;
 
   /// @brief セルグループの情報を出力する．
   void
   display_group(
-    ostream& s,
+    OutBuf& s,
     const ClibCellGroup& group
   ) const;
 
   /// @brief セルの情報を出力する．
   void
   display_cell(
-    ostream& s,
+    OutBuf& s,
     const ClibCell& cell
   ) const;
 
   /// @brief タイミング情報を出力する．
   void
   display_timing(
-    ostream& s,
+    OutBuf& s,
     const ClibCell& cell,
     SizeType ipos,
     SizeType opos,
@@ -85,7 +91,7 @@ private:
   /// @brief LUT の情報を出力する．
   void
   display_lut(
-    ostream& s,
+    OutBuf& s,
     const string& label,
     const ClibLut& lut
   ) const;
@@ -93,7 +99,7 @@ private:
   /// @brief パタングラフの情報を出力する．
   void
   display_patgraph(
-    ostream& s
+    OutBuf& s
   ) const;
 
   /// @brief DFF のセルクラスに名前をつける．
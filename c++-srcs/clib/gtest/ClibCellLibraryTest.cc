@@ -8,8 +8,23 @@
 
 #include "gtest/gtest.h"
 #include "ym/ClibCellLibrary.h"
+#include "ym/ClibPatGraph.h"
+#include "ym/ClibCell.h"
+#include "ym/ClibPin.h"
+#include "ym/ClibTiming.h"
+#include "ym/ClibInternalPower.h"
+#include "ym/ClibLut.h"
+#include "ym/ClibCellGroup.h"
+#include "ym/ClibCellClass.h"
+#include "ym/ClibIOMap.h"
+#include "ym/ClibWireLoad.h"
+#include "ym/Expr.h"
+#include "ym/TvFunc.h"
 #include "ym/StreamMsgHandler.h"
 #include "ym/MsgMgr.h"
+#include <thread>
+#include <cstring>
+#include <cmath>
 
 
 BEGIN_NAMESPACE_YM_CLIB
@@ -85,6 +100,410 @@ TEST(ClibCellLibraryTest, read_liberty)
   }
 }
 
+TEST(ClibCellLibraryTest, display_parallel)
+{
+  string filename = string(DATA_DIR) + string("/HIT018.typ.snp");
+  auto library = ClibCellLibrary::read_liberty(filename);
+
+  ostringstream s1;
+  library.display(s1);
+
+  // 出力結果はスレッド数によらない．
+  ostringstream s4;
+  library.display(s4, 4);
+  EXPECT_EQ( s1.str(), s4.str() );
+}
+
+TEST(ClibCellLibraryTest, read_liberty_many)
+{
+  string filename = string(DATA_DIR) + string("/HIT018.typ.snp");
+  auto library = ClibCellLibrary::read_liberty(filename);
+  ostringstream s1;
+  library.display(s1);
+
+  vector<string> filename_list(4, filename);
+  auto lib_list = ClibCellLibrary::read_liberty_many(filename_list, {}, 4);
+  ASSERT_EQ( 4, lib_list.size() );
+  for ( auto& lib: lib_list ) {
+    ASSERT_TRUE( lib.is_valid() );
+    // それぞれ別のライブラリとなる．
+    EXPECT_NE( library, lib );
+    ostringstream s2;
+    lib.display(s2);
+    EXPECT_EQ( s1.str(), s2.str() );
+  }
+  EXPECT_NE( lib_list[0], lib_list[1] );
+
+  // 一つでも失敗したら例外を送出する．
+  filename_list[2] = string(DATA_DIR) + string("/no_such_file.lib");
+  EXPECT_THROW( ClibCellLibrary::read_liberty_many(filename_list, {}, 4),
+		std::invalid_argument );
+}
+
+TEST(ClibCellLibraryTest, read_liberty_profile)
+{
+  string filename = string(DATA_DIR) + string("/HIT018.typ.snp");
+  auto library0 = ClibCellLibrary::read_liberty(filename);
+  ostringstream s1;
+  library0.display(s1);
+
+  ClibLoadProfile profile;
+  auto library = ClibCellLibrary::read_liberty(filename, {}, profile);
+  // 計測しても内容は変わらない．
+  ostringstream s2;
+  library.display(s2);
+  EXPECT_EQ( s1.str(), s2.str() );
+
+  EXPECT_EQ( filename, profile.filename );
+  vector<string> exp_names{"read", "parse", "info", "cell",
+			   "signature", "grouping", "gen_pat", "wrap_up"};
+  ASSERT_EQ( exp_names.size(), profile.phase_list.size() );
+  double total = 0.0;
+  for ( SizeType i = 0; i < exp_names.size(); ++ i ) {
+    auto& phase = profile.phase_list[i];
+    EXPECT_EQ( exp_names[i], phase.name );
+    EXPECT_LE( 0.0, phase.wall_time );
+    EXPECT_LT( 0, phase.peak_rss );
+    total += phase.wall_time;
+  }
+  EXPECT_DOUBLE_EQ( total, profile.total_time() );
+
+  auto file_size = profile.phase_list[0].bytes;
+  EXPECT_LT( 0, file_size );
+  EXPECT_EQ( file_size, profile.phase_list[1].bytes );
+  EXPECT_LT( 0, profile.phase_list[1].object_num );
+  EXPECT_EQ( library.cell_num(), profile.phase_list[3].object_num );
+  EXPECT_EQ( library.pg_node_num(), profile.phase_list[6].object_num );
+
+  auto json = profile.json();
+  EXPECT_EQ( '{', json.front() );
+  EXPECT_EQ( '}', json.back() );
+  EXPECT_EQ( string::npos, json.find('\n') );
+  EXPECT_NE( string::npos, json.find("\"phases\": [{\"name\": \"read\"") );
+}
+
+TEST(ClibCellLibraryTest, pg_param)
+{
+  string filename = string(DATA_DIR) + string("/lib2.genlib");
+  auto library0 = ClibCellLibrary::read_mislib(filename);
+  auto stats0 = library0.pg_stats();
+  EXPECT_EQ( 0, stats0.input_pruned_expr_num );
+  EXPECT_EQ( 0, stats0.node_pruned_expr_num );
+  EXPECT_EQ( 0, stats0.class_pruned_pat_num );
+  EXPECT_EQ( library0.pg_pat_num(), stats0.pat_num );
+  EXPECT_EQ( library0.pg_node_num(), stats0.node_num );
+
+  ClibPatGenParam param;
+  param.max_input = 3;
+  param.max_pat_per_class = 2;
+  auto library = ClibCellLibrary::read_mislib(filename, param);
+
+  // 論理的な内容は変わらない．
+  EXPECT_EQ( library0.cell_num(), library.cell_num() );
+
+  auto stats = library.pg_stats();
+  EXPECT_EQ( stats0.expr_num, stats.expr_num );
+  EXPECT_LT( 0, stats.input_pruned_expr_num );
+  EXPECT_LT( 0, stats.class_pruned_pat_num );
+  EXPECT_EQ( library.pg_pat_num(), stats.pat_num );
+  EXPECT_EQ( library.pg_node_num(), stats.node_num );
+  EXPECT_GT( library0.pg_node_num(), library.pg_node_num() );
+  for ( SizeType i = 0; i < library.pg_pat_num(); ++ i ) {
+    auto pat = library.pg_pat(i);
+    EXPECT_GE( 3, pat.input_num() );
+  }
+
+  // ノード数の制限
+  ClibPatGenParam param2;
+  param2.max_node_num = 20;
+  auto library2 = ClibCellLibrary::read_mislib(filename, param2);
+  auto stats2 = library2.pg_stats();
+  EXPECT_LT( 0, stats2.node_pruned_expr_num );
+  EXPECT_GE( 20, library2.pg_node_num() );
+}
+
+TEST(ClibCellLibraryTest, lazy_pg)
+{
+  string filename = string(DATA_DIR) + string("/lib2.genlib");
+  auto library = ClibCellLibrary::read_mislib(filename);
+
+  // パタングラフに触れる前にダンプする．
+  string dump_buff;
+  {
+    ostringstream s;
+    library.dump(s);
+    dump_buff = s.str();
+  }
+  ClibCellLibrary library2;
+  {
+    istringstream s{dump_buff};
+    library2 = ClibCellLibrary::restore(s);
+  }
+  EXPECT_EQ( library.pg_pat_num(), library2.pg_pat_num() );
+  EXPECT_EQ( library.pg_node_num(), library2.pg_node_num() );
+
+  // 複数のスレッドから同時に参照する．
+  auto library3 = ClibCellLibrary::read_mislib(filename);
+  vector<SizeType> pat_num_list(4, 0);
+  vector<std::thread> thr_list;
+  for ( SizeType i = 0; i < 4; ++ i ) {
+    thr_list.push_back(std::thread{[&, i]() {
+      pat_num_list[i] = library3.pg_pat_num();
+    }});
+  }
+  for ( auto& thr: thr_list ) {
+    thr.join();
+  }
+  for ( auto n: pat_num_list ) {
+    EXPECT_EQ( library.pg_pat_num(), n );
+  }
+}
+
+TEST(ClibCellLibraryTest, pg_index)
+{
+  string filename = string(DATA_DIR) + string("/lib2.genlib");
+  auto library = ClibCellLibrary::read_mislib(filename);
+
+  SizeType n = 0;
+  for ( SizeType d = 0; d <= library.pg_max_depth(); ++ d ) {
+    for ( SizeType ni = 0; ni <= library.pg_max_input(); ++ ni ) {
+      for ( auto type: { ClibPatType::And, ClibPatType::Xor } ) {
+	for ( auto id: library.pg_pat_list(type, d, ni) ) {
+	  auto pat = library.pg_pat(id);
+	  EXPECT_EQ( type, library.pg_node_type(pat.root_id()) );
+	  EXPECT_EQ( d, pat.depth() );
+	  EXPECT_EQ( ni, pat.input_num() );
+	  ++ n;
+	}
+      }
+    }
+  }
+  EXPECT_EQ( library.pg_pat_num(), n );
+
+  for ( SizeType id = 0; id < library.pg_pat_num(); ++ id ) {
+    auto pat = library.pg_pat(id);
+    auto func = pat.func();
+    if ( pat.edge_num() == 0 ) {
+      // 論理ノードを含まないパタンは索引に含まれない．
+      continue;
+    }
+    EXPECT_EQ( pat.input_num(), func.input_num() );
+    ClibIOMap iomap;
+    auto& pat_list = library.pg_pat_list(func, iomap);
+    EXPECT_TRUE( std::find(pat_list.begin(), pat_list.end(), id) != pat_list.end() );
+    EXPECT_EQ( pat.rep_map(), iomap );
+
+    // 出力を反転した関数も NPN 同値なので同じリストが得られる．
+    auto& pat_list2 = library.pg_pat_list(~func);
+    EXPECT_EQ( pat_list, pat_list2 );
+  }
+
+  // 2入力の NAND と NOR は NPN 同値なので同じパタンが見つかる．
+  auto lit0 = TvFunc::posi_literal(2, 0);
+  auto lit1 = TvFunc::posi_literal(2, 1);
+  auto& nand_list = library.pg_pat_list(~(lit0 & lit1));
+  EXPECT_FALSE( nand_list.empty() );
+  EXPECT_EQ( nand_list, library.pg_pat_list(~(lit0 | lit1)) );
+  EXPECT_EQ( nand_list, library.pg_pat_list(lit0 & ~lit1) );
+
+  // 該当するパタンがない場合
+  EXPECT_TRUE( library.pg_pat_list(ClibPatType::And, 100, 2).empty() );
+}
+
+TEST(ClibCellLibraryTest, find_logic_group)
+{
+  string filename = string(DATA_DIR) + string("/lib2.genlib");
+  auto library = ClibCellLibrary::read_mislib(filename);
+
+  auto lit0 = Expr::posi_literal(0);
+  auto lit1 = Expr::posi_literal(1);
+  auto nand2 = ~(lit0 & lit1);
+  auto group = library.find_logic_group(nand2, 2);
+  EXPECT_TRUE( group.is_valid() );
+  EXPECT_EQ( library.nand_func(2), group );
+
+  // TvFunc でも同じ結果になる．
+  auto group2 = library.find_logic_group(nand2.to_tv(2));
+  EXPECT_EQ( group, group2 );
+
+  // 入力数が異なると別の関数となる．
+  auto group3 = library.find_logic_group(nand2, 3);
+  EXPECT_TRUE( group3.is_invalid() );
+
+  // NPN同値なクラスを探す．
+  ClibIOMap iomap;
+  auto cclass = library.find_logic_class((lit0 & ~lit1).to_tv(2), iomap);
+  EXPECT_TRUE( cclass.is_valid() );
+  EXPECT_EQ( group.rep_class(), cclass );
+}
+
+TEST(ClibCellLibraryTest, sorted_cell_list)
+{
+  string filename = string(DATA_DIR) + string("/lib2.genlib");
+  auto library = ClibCellLibrary::read_mislib(filename);
+
+  for ( auto group: library.cell_group_list() ) {
+    auto cell_list = group.sorted_cell_list(ClibCellOrder::Area);
+    EXPECT_EQ( group.cell_num(), cell_list.size() );
+    for ( SizeType i = 0; i < cell_list.size(); ++ i ) {
+      auto cell = cell_list[i];
+      EXPECT_EQ( cell, group.sorted_cell(ClibCellOrder::Area, i) );
+      auto next = group.next_cell(cell, ClibCellOrder::Area);
+      auto prev = group.prev_cell(cell, ClibCellOrder::Area);
+      if ( i + 1 < cell_list.size() ) {
+	EXPECT_EQ( cell_list[i + 1], next );
+	EXPECT_LE( cell.area().value(), next.area().value() );
+      }
+      else {
+	EXPECT_TRUE( next.is_invalid() );
+      }
+      if ( i > 0 ) {
+	EXPECT_EQ( cell_list[i - 1], prev );
+      }
+      else {
+	EXPECT_TRUE( prev.is_invalid() );
+      }
+    }
+  }
+
+  for ( auto cclass: library.npn_class_list() ) {
+    SizeType n = 0;
+    for ( auto group: cclass.cell_group_list() ) {
+      n += group.cell_num();
+    }
+    EXPECT_EQ( n, cclass.cell_num() );
+    for ( SizeType i = 1; i < cclass.cell_num(); ++ i ) {
+      auto cell0 = cclass.sorted_cell(ClibCellOrder::Area, i - 1);
+      auto cell1 = cclass.sorted_cell(ClibCellOrder::Area, i);
+      EXPECT_LE( cell0.area().value(), cell1.area().value() );
+      EXPECT_EQ( cell1, cclass.next_cell(cell0, ClibCellOrder::Area) );
+    }
+  }
+}
+
+TEST(ClibCellLibraryTest, sorted_cell_list_drive)
+{
+  // HIT018 は非線形遅延モデルなので駆動抵抗は遅延テーブルの傾きで求める．
+  // 駆動力の大きいセルほど面積が大きいので面積順とは異なる順番になる．
+  string filename = string(DATA_DIR) + string("/HIT018.typ.snp");
+  auto library = ClibCellLibrary::read_liberty(filename);
+
+  SizeType n_diff_orig = 0;
+  SizeType n_diff_area = 0;
+  for ( auto group: library.cell_group_list() ) {
+    if ( group.cell_num() < 2 ) {
+      continue;
+    }
+    auto drive_list = group.sorted_cell_list(ClibCellOrder::DriveResistance);
+    auto area_list = group.sorted_cell_list(ClibCellOrder::Area);
+    auto orig_list = group.cell_list();
+    ASSERT_EQ( orig_list.size(), drive_list.size() );
+    bool diff_orig = false;
+    bool diff_area = false;
+    for ( SizeType i = 0; i < drive_list.size(); ++ i ) {
+      if ( drive_list[i] != orig_list[i] ) {
+	diff_orig = true;
+      }
+      if ( drive_list[i] != area_list[i] ) {
+	diff_area = true;
+      }
+    }
+    if ( diff_orig ) {
+      ++ n_diff_orig;
+    }
+    if ( diff_area ) {
+      ++ n_diff_area;
+    }
+  }
+  EXPECT_TRUE( n_diff_orig > 0 );
+  EXPECT_TRUE( n_diff_area > 0 );
+}
+
+TEST(ClibCellLibraryTest, cell_by_name)
+{
+  string filename = string(DATA_DIR) + string("/lib2.genlib");
+  auto library = ClibCellLibrary::read_mislib(filename);
+
+  for ( auto cell: library.cell_list() ) {
+    auto name = cell.name();
+    EXPECT_EQ( cell, library.cell(name) );
+    EXPECT_EQ( cell, library.cell(std::string_view{name}) );
+  }
+  EXPECT_TRUE( library.cell("no_such_cell").is_invalid() );
+
+  vector<string> name_list{"nand2", "no_such_cell", "nand2"};
+  auto cell_list = library.cell_list(name_list);
+  EXPECT_EQ( 3, cell_list.size() );
+  EXPECT_EQ( library.cell("nand2"), cell_list[0] );
+  EXPECT_TRUE( cell_list[1].is_invalid() );
+  EXPECT_EQ( cell_list[0], cell_list[2] );
+}
+
+TEST(ClibCellLibraryTest, pin_by_name)
+{
+  string filename = string(DATA_DIR) + string("/lib2.genlib");
+  auto library = ClibCellLibrary::read_mislib(filename);
+
+  for ( auto cell: library.cell_list() ) {
+    vector<string> name_list;
+    for ( auto pin: cell.pin_list() ) {
+      auto name = pin.name();
+      EXPECT_EQ( pin.pin_id(), cell.pin(name).pin_id() );
+      name_list.push_back(name);
+    }
+    EXPECT_TRUE( cell.pin("no_such_pin").is_invalid() );
+
+    name_list.push_back("no_such_pin");
+    auto id_list = cell.pin_id_list(name_list);
+    SizeType n = cell.pin_num();
+    ASSERT_EQ( n + 1, id_list.size() );
+    for ( SizeType i = 0; i < n; ++ i ) {
+      EXPECT_EQ( i, id_list[i] );
+    }
+    EXPECT_EQ( CLIB_NULLID, id_list[n] );
+  }
+}
+
+TEST(ClibCellLibraryTest, subset)
+{
+  string filename = string(DATA_DIR) + string("/HIT018.typ.snp");
+  auto library = ClibCellLibrary::read_liberty(filename);
+
+  vector<string> name_list;
+  for ( SizeType i = 0; i < library.cell_num(); i += 50 ) {
+    name_list.push_back(library.cell(i).name());
+  }
+  // 重複した名前は無視される．
+  name_list.push_back(name_list.front());
+
+  auto sublib = library.subset(name_list);
+  EXPECT_EQ( library.name(), sublib.name() );
+  EXPECT_EQ( library.delay_model(), sublib.delay_model() );
+  SizeType n = name_list.size() - 1;
+  ASSERT_EQ( n, sublib.cell_num() );
+  for ( SizeType i = 0; i < n; ++ i ) {
+    auto cell0 = library.cell(name_list[i]);
+    auto cell = sublib.cell(i);
+    EXPECT_EQ( name_list[i], cell.name() );
+    EXPECT_EQ( cell, sublib.cell(name_list[i]) );
+    EXPECT_EQ( cell0.area(), cell.area() );
+    EXPECT_EQ( cell0.pin_num(), cell.pin_num() );
+    EXPECT_EQ( cell0.type(), cell.type() );
+    EXPECT_TRUE( cell.group().is_valid() );
+  }
+
+  // 部分ライブラリもダンプ/リストアできる．
+  ostringstream os;
+  sublib.dump(os);
+  istringstream is{os.str()};
+  auto sublib2 = ClibCellLibrary::restore(is);
+  EXPECT_EQ( n, sublib2.cell_num() );
+  EXPECT_EQ( sublib.cell_group_num(), sublib2.cell_group_num() );
+  EXPECT_EQ( sublib.pg_pat_num(), sublib2.pg_pat_num() );
+
+  EXPECT_THROW( library.subset({"no_such_cell"}), std::invalid_argument );
+}
+
 TEST(ClibCellLibraryTest, dump_restore)
 {
   try {
@@ -107,6 +526,10 @@ TEST(ClibCellLibraryTest, dump_restore)
     }
 
     EXPECT_EQ( library.cell_num(), library2.cell_num() );
+    for ( SizeType i = 0; i < library.cell_num(); ++ i ) {
+      auto name = library.cell(i).name();
+      EXPECT_EQ( library2.cell(i), library2.cell(name) );
+    }
   }
   catch ( AssertError obj ) {
     cout << obj << endl;
@@ -114,4 +537,658 @@ TEST(ClibCellLibraryTest, dump_restore)
   }
 }
 
+TEST(ClibCellLibraryTest, write_liberty)
+{
+  string filename = string(DATA_DIR) + string("/HIT018.typ.snp");
+  auto library = ClibCellLibrary::read_liberty(filename);
+
+  ostringstream s1;
+  library.write_liberty(s1);
+
+  // 出力結果はスレッド数によらない．
+  ostringstream s4;
+  library.write_liberty(s4, 4);
+  EXPECT_EQ( s1.str(), s4.str() );
+
+  // 出力したファイルを読み直す．
+  string tmp_filename = "ClibCellLibraryTest_write_liberty.lib";
+  {
+    ofstream ofs{tmp_filename};
+    ASSERT_TRUE( ofs );
+    ofs << s1.str();
+  }
+  auto library2 = ClibCellLibrary::read_liberty(tmp_filename);
+  ASSERT_EQ( library.cell_num(), library2.cell_num() );
+  for ( SizeType i = 0; i < library.cell_num(); ++ i ) {
+    auto cell1 = library.cell(i);
+    auto cell2 = library2.cell(i);
+    EXPECT_EQ( cell1.name(), cell2.name() );
+    EXPECT_EQ( cell1.area(), cell2.area() );
+    EXPECT_EQ( cell1.type(), cell2.type() );
+    ASSERT_EQ( cell1.pin_num(), cell2.pin_num() );
+    for ( SizeType j = 0; j < cell1.pin_num(); ++ j ) {
+      EXPECT_EQ( cell1.pin(j).name(), cell2.pin(j).name() );
+      EXPECT_EQ( cell1.pin(j).direction(), cell2.pin(j).direction() );
+    }
+    ASSERT_EQ( cell1.input2_num(), cell2.input2_num() );
+    ASSERT_EQ( cell1.output2_num(), cell2.output2_num() );
+    for ( SizeType ipos = 0; ipos < cell1.input2_num(); ++ ipos ) {
+      for ( SizeType opos = 0; opos < cell1.output2_num(); ++ opos ) {
+	for ( auto sense: {ClibTimingSense::positive_unate,
+			   ClibTimingSense::negative_unate} ) {
+	  EXPECT_EQ( cell1.timing_list(ipos, opos, sense).size(),
+		     cell2.timing_list(ipos, opos, sense).size() );
+	}
+      }
+    }
+  }
+  std::remove(tmp_filename.c_str());
+}
+
+TEST(ClibCellLibraryTest, write_timing_table)
+{
+  string filename = string(DATA_DIR) + string("/HIT018.typ.snp");
+  auto library = ClibCellLibrary::read_liberty(filename);
+
+  // 期待値として最初のセル(HIT18AND2P005)の A -> Y の最初の LUT を求めておく．
+  auto cell0 = library.cell(0);
+  ASSERT_EQ( "HIT18AND2P005", cell0.name() );
+  auto timing_list0 = cell0.timing_list(0, 0, ClibTimingSense::positive_unate);
+  ASSERT_TRUE( timing_list0.size() > 0 );
+  auto first_lut = timing_list0[0].cell_rise();
+  ASSERT_TRUE( first_lut.is_valid() );
+
+  ostringstream s;
+  library.write_timing_table(s);
+  auto buf = s.str();
+
+  auto get_64 = [&](SizeType pos) {
+    std::uint64_t val;
+    std::memcpy(&val, buf.data() + pos, sizeof(val));
+    return val;
+  };
+  ASSERT_TRUE( buf.size() > 48 );
+  EXPECT_EQ( string("YMCLTBL1"), buf.substr(0, 8) );
+  auto row_num = get_64(8);
+  auto value_num = get_64(32);
+  auto section_num = get_64(40);
+  ASSERT_TRUE( row_num > 0 );
+  ASSERT_EQ( 15, section_num );
+  vector<std::uint64_t> offset_list(section_num);
+  for ( SizeType i = 0; i < section_num; ++ i ) {
+    offset_list[i] = get_64(48 + i * 8);
+    EXPECT_EQ( 0, offset_list[i] % 8 );
+    ASSERT_TRUE( offset_list[i] <= buf.size() );
+  }
+
+  // 文字列番号から文字列を得る．
+  auto string_begin = reinterpret_cast<const std::uint64_t*>(buf.data() + offset_list[13]);
+  auto get_string = [&](std::uint32_t id) {
+    auto b = string_begin[id];
+    auto e = string_begin[id + 1];
+    return buf.substr(offset_list[14] + b, e - b);
+  };
+
+  // HIT18DFP010 の C -> Q は rising_edge のタイミングのみで，
+  // cell_rise, cell_fall, rise_transition, fall_transition の4つの
+  // LUT を持つ．エッジのタイミングは両方のセンスのリストに含まれるが
+  // non_unate として1回だけ出力される．
+  auto cell_col = reinterpret_cast<const std::uint32_t*>(buf.data() + offset_list[0]);
+  auto rpin_col = reinterpret_cast<const std::uint32_t*>(buf.data() + offset_list[1]);
+  auto pin_col = reinterpret_cast<const std::uint32_t*>(buf.data() + offset_list[2]);
+  auto type_col = reinterpret_cast<const std::uint8_t*>(buf.data() + offset_list[3]);
+  auto sense_col = reinterpret_cast<const std::uint8_t*>(buf.data() + offset_list[4]);
+  auto kind_col = reinterpret_cast<const std::uint8_t*>(buf.data() + offset_list[5]);
+  vector<int> kind_count(6, 0);
+  SizeType edge_row_num = 0;
+  for ( SizeType k = 0; k < row_num; ++ k ) {
+    if ( get_string(cell_col[k]) != "HIT18DFP010" ||
+	 get_string(pin_col[k]) != "Q" ) {
+      continue;
+    }
+    ++ edge_row_num;
+    EXPECT_EQ( "C", get_string(rpin_col[k]) );
+    EXPECT_EQ( static_cast<std::uint8_t>(ClibTimingType::rising_edge),
+	       type_col[k] );
+    EXPECT_EQ( static_cast<std::uint8_t>(ClibTimingSense::non_unate),
+	       sense_col[k] );
+    ASSERT_TRUE( kind_col[k] < 6 );
+    ++ kind_count[kind_col[k]];
+  }
+  EXPECT_EQ( 4, edge_row_num );
+  EXPECT_EQ( (vector<int>{1, 1, 1, 1, 0, 0}), kind_count );
+
+  // 最初の行のテーブル値を確認する．
+  EXPECT_EQ( first_lut.dimension(), buf[offset_list[6]] );
+  auto values = reinterpret_cast<const double*>(buf.data() + offset_list[12]);
+  SizeType n = 1;
+  for ( SizeType i = 0; i < first_lut.dimension(); ++ i ) {
+    n *= first_lut.index_num(i);
+  }
+  ASSERT_TRUE( n <= value_num );
+  vector<SizeType> pos_array(first_lut.dimension(), 0);
+  for ( SizeType k = 0; k < n; ++ k ) {
+    EXPECT_EQ( first_lut.grid_value(pos_array), values[k] );
+    for ( SizeType i = first_lut.dimension(); i > 0; -- i ) {
+      if ( ++ pos_array[i - 1] < first_lut.index_num(i - 1) ) {
+	break;
+      }
+      pos_array[i - 1] = 0;
+    }
+  }
+}
+
+TEST(ClibCellLibraryTest, internal_power)
+{
+  string filename = string(DATA_DIR) + string("/HIT018.typ.snp");
+  auto library = ClibCellLibrary::read_liberty(filename);
+
+  auto cell = library.cell("HIT18AND2P005");
+  ASSERT_TRUE( cell.is_valid() );
+  ASSERT_EQ( 2, cell.internal_power_num() );
+  EXPECT_EQ( 0.0, cell.cell_leakage_power() );
+  EXPECT_EQ( 0, cell.leakage_power_num() );
+
+  auto ip = cell.internal_power(0);
+  EXPECT_EQ( "Y", ip.pin().name() );
+  EXPECT_EQ( "A", ip.related_pin().name() );
+  EXPECT_TRUE( ip.when().is_one() );
+  // power グループは立ち上がり/立ち下がりで共通
+  EXPECT_DOUBLE_EQ( 0.019440,
+		    ip.calc_rise_energy(ClibTime{0.04}, ClibCapacitance{0.005}) );
+  EXPECT_DOUBLE_EQ( 0.019440,
+		    ip.calc_fall_energy(ClibTime{0.04}, ClibCapacitance{0.005}) );
+  EXPECT_DOUBLE_EQ( 0.035640,
+		    ip.calc_rise_energy(ClibTime{2.0}, ClibCapacitance{0.3}) );
+  EXPECT_EQ( "B", cell.internal_power(1).related_pin().name() );
+
+  // まとめて計算した結果は個別に計算した結果と等しい．
+  vector<double> tran_list{0.04, 0.5, 1.2, 2.0, 0.1};
+  vector<double> cap_list{0.005, 0.02, 0.1, 0.3, 0.25};
+  auto energy_list = ip.calc_rise_energy_list(tran_list, cap_list);
+  ASSERT_EQ( tran_list.size(), energy_list.size() );
+  for ( SizeType i = 0; i < tran_list.size(); ++ i ) {
+    auto exp_val = ip.calc_rise_energy(ClibTime{tran_list[i]},
+				       ClibCapacitance{cap_list[i]});
+    EXPECT_DOUBLE_EQ( exp_val, energy_list[i] );
+  }
+  EXPECT_THROW( ip.calc_rise_energy_list(tran_list, {0.1}),
+		std::invalid_argument );
+
+  // ダンプ/リストア後も同じ値となる．
+  ostringstream os;
+  library.dump(os);
+  istringstream is{os.str()};
+  auto library2 = ClibCellLibrary::restore(is);
+  auto cell2 = library2.cell("HIT18AND2P005");
+  ASSERT_EQ( cell.internal_power_num(), cell2.internal_power_num() );
+  SizeType n = 0;
+  for ( auto ip2: cell2.internal_power_list() ) {
+    auto ip1 = cell.internal_power(n);
+    EXPECT_EQ( ip1.pin().name(), ip2.pin().name() );
+    EXPECT_EQ( ip1.related_pin().name(), ip2.related_pin().name() );
+    EXPECT_EQ( ip1.calc_fall_energy_list(tran_list, cap_list),
+	       ip2.calc_fall_energy_list(tran_list, cap_list) );
+    ++ n;
+  }
+  EXPECT_EQ( cell.internal_power_num(), n );
+}
+
+TEST(ClibCellLibraryTest, leakage_power)
+{
+  string filename = string(DATA_DIR) + string("/leakage.lib");
+  auto library = ClibCellLibrary::read_liberty(filename);
+
+  auto cell = library.cell("NAND2");
+  ASSERT_TRUE( cell.is_valid() );
+  EXPECT_EQ( 1.5, cell.cell_leakage_power() );
+  ASSERT_EQ( 4, cell.leakage_power_num() );
+  EXPECT_EQ( 2, cell.leakage_input_num() );
+  EXPECT_EQ( 2.0, cell.leakage_power_value(1) );
+
+  // 入力状態の i 番目のビットが i 番目の入力(A, B の順)に対応する．
+  vector<std::uint64_t> exp_mask{0x1, 0x4, 0x2, 0x8};
+  for ( SizeType i = 0; i < 4; ++ i ) {
+    auto mask = cell.leakage_power_when_mask(i);
+    ASSERT_EQ( 1, mask.size() );
+    EXPECT_EQ( exp_mask[i], mask[0] );
+  }
+  EXPECT_EQ( 1.0, cell.calc_leakage_power(0) );
+  EXPECT_EQ( 3.0, cell.calc_leakage_power(1) );
+  EXPECT_EQ( 2.0, cell.calc_leakage_power(2) );
+  EXPECT_EQ( 4.0, cell.calc_leakage_power(3) );
+
+  vector<std::uint64_t> state_list{3, 0, 2, 1, 3};
+  auto value_list = cell.calc_leakage_power_list(state_list);
+  ASSERT_EQ( state_list.size(), value_list.size() );
+  for ( SizeType i = 0; i < state_list.size(); ++ i ) {
+    EXPECT_EQ( cell.calc_leakage_power(state_list[i]), value_list[i] );
+  }
+
+  EXPECT_DOUBLE_EQ( 2.5, cell.calc_average_leakage_power({0.5, 0.5}) );
+  EXPECT_DOUBLE_EQ( 2.1, cell.calc_average_leakage_power({0.2, 0.7}) );
+  EXPECT_THROW( cell.calc_average_leakage_power({0.5}),
+		std::invalid_argument );
+
+  // leakage_power を持たないセルは cell_leakage_power の値となる．
+  auto cell2 = library.cell("INV");
+  ASSERT_TRUE( cell2.is_valid() );
+  EXPECT_EQ( 0, cell2.leakage_power_num() );
+  EXPECT_EQ( 0.5, cell2.calc_leakage_power(0) );
+  EXPECT_EQ( 0.5, cell2.calc_leakage_power(1) );
+  EXPECT_EQ( 0.5, cell2.calc_average_leakage_power({0.3}) );
+
+  // ダンプ/リストア後も同じ値となる．
+  ostringstream os;
+  library.dump(os);
+  istringstream is{os.str()};
+  auto library2 = ClibCellLibrary::restore(is);
+  auto cell3 = library2.cell("NAND2");
+  EXPECT_EQ( cell.cell_leakage_power(), cell3.cell_leakage_power() );
+  EXPECT_EQ( value_list, cell3.calc_leakage_power_list(state_list) );
+  EXPECT_EQ( exp_mask[2], cell3.leakage_power_when_mask(2)[0] );
+}
+
+TEST(ClibCellLibraryTest, latch_enable)
+{
+  string filename = string(DATA_DIR) + string("/latch.lib");
+  auto library = ClibCellLibrary::read_liberty(filename);
+
+  // 入力番号は D = 0, G = 1 となる．
+  auto cell = library.cell("DLAT");
+  ASSERT_TRUE( cell.is_valid() );
+  EXPECT_TRUE( cell.is_latch() );
+  EXPECT_EQ( Expr::posi_literal(1), cell.enable_expr() );
+  EXPECT_TRUE( cell.enable2_expr().is_invalid() );
+  EXPECT_EQ( Expr::posi_literal(0), cell.data_in_expr() );
+
+  auto cell2 = library.cell("DLATN");
+  ASSERT_TRUE( cell2.is_valid() );
+  EXPECT_TRUE( cell2.is_latch() );
+  EXPECT_EQ( Expr::nega_literal(1), cell2.enable_expr() );
+  EXPECT_EQ( Expr::posi_literal(0), cell2.data_in_expr() );
+
+  // enable の論理が異なるので別のグループとなる．
+  EXPECT_NE( cell.group(), cell2.group() );
+}
+
+TEST(ClibCellLibraryTest, wire_load)
+{
+  string filename = string(DATA_DIR) + string("/HIT018.typ.snp");
+  auto library = ClibCellLibrary::read_liberty(filename);
+
+  ASSERT_EQ( 5, library.wire_load_num() );
+  EXPECT_EQ( 1, library.wire_load_selection_num() );
+  EXPECT_TRUE( library.default_wire_load().is_invalid() );
+
+  auto wl = library.wire_load("1k");
+  ASSERT_TRUE( wl.is_valid() );
+  EXPECT_EQ( library.wire_load(0), wl );
+  EXPECT_EQ( "1k", wl.name() );
+  EXPECT_FALSE( wl.is_table() );
+  EXPECT_EQ( 0.225, wl.resistance() );
+  EXPECT_EQ( 0.195, wl.capacitance() );
+  EXPECT_EQ( 0.0375, wl.slope() );
+  EXPECT_DOUBLE_EQ( 0.0, wl.wire_length(0) );
+  EXPECT_DOUBLE_EQ( 0.0750, wl.wire_length(1) );
+  // fanout_length の範囲外は slope で外挿する．
+  EXPECT_DOUBLE_EQ( 0.0750 + 2 * 0.0375, wl.wire_length(3) );
+  EXPECT_DOUBLE_EQ( 0.0750 * 0.195, wl.wire_capacitance(1) );
+  EXPECT_DOUBLE_EQ( (0.0750 + 0.0375) * 0.225, wl.wire_resistance(2) );
+  EXPECT_DOUBLE_EQ( 0.0, wl.wire_area(5) );
+  EXPECT_TRUE( library.wire_load("nosuch").is_invalid() );
+  EXPECT_THROW( library.wire_load(5), std::out_of_range );
+
+  vector<SizeType> fanout_list{0, 1, 2, 10};
+  auto cap_list = wl.wire_capacitance_list(fanout_list);
+  ASSERT_EQ( fanout_list.size(), cap_list.size() );
+  for ( SizeType i = 0; i < fanout_list.size(); ++ i ) {
+    EXPECT_EQ( wl.wire_capacitance(fanout_list[i]), cap_list[i] );
+  }
+
+  // ワイヤーロードセレクションが一つだけなのでそれが用いられる．
+  EXPECT_EQ( "1k", library.select_wire_load(0.0).name() );
+  EXPECT_EQ( "2k", library.select_wire_load(53760.0).name() );
+  EXPECT_EQ( "16k", library.select_wire_load(860000.0).name() );
+  EXPECT_TRUE( library.select_wire_load(1.0e7).is_invalid() );
+
+  // ダンプ/リストア後も同じ値となる．
+  ostringstream os;
+  library.dump(os);
+  istringstream is{os.str()};
+  auto library2 = ClibCellLibrary::restore(is);
+  ASSERT_EQ( library.wire_load_num(), library2.wire_load_num() );
+  auto wl2 = library2.wire_load("1k");
+  ASSERT_TRUE( wl2.is_valid() );
+  EXPECT_EQ( wl.wire_capacitance_list(fanout_list),
+	     wl2.wire_capacitance_list(fanout_list) );
+  EXPECT_EQ( "4k", library2.select_wire_load(200000.0).name() );
+
+  // 部分ライブラリにもワイヤーロードはコピーされる．
+  auto sublib = library.subset({library.cell(0).name()});
+  EXPECT_EQ( library.wire_load_num(), sublib.wire_load_num() );
+  EXPECT_EQ( "8k", sublib.select_wire_load(300000.0).name() );
+}
+
+TEST(ClibCellLibraryTest, wire_load_table)
+{
+  string filename = string(DATA_DIR) + string("/wire_load.lib");
+  auto library = ClibCellLibrary::read_liberty(filename);
+
+  ASSERT_EQ( 2, library.wire_load_num() );
+  EXPECT_EQ( "small", library.default_wire_load().name() );
+  EXPECT_EQ( "enclosed", library.default_wire_load_mode() );
+  EXPECT_EQ( 0.5, library.default_wire_load_capacitance() );
+  EXPECT_EQ( 0.0, library.default_wire_load_resistance() );
+
+  // 定義された点の間は線形補間する．
+  auto wl = library.wire_load("small");
+  ASSERT_TRUE( wl.is_valid() );
+  EXPECT_DOUBLE_EQ( 1.0, wl.wire_length(1) );
+  EXPECT_DOUBLE_EQ( 1.5, wl.wire_length(2) );
+  EXPECT_DOUBLE_EQ( 2.0, wl.wire_length(3) );
+  EXPECT_DOUBLE_EQ( 4.0, wl.wire_length(5) );
+  EXPECT_DOUBLE_EQ( 3.0, wl.wire_resistance(2) );
+  EXPECT_DOUBLE_EQ( 1.0, wl.wire_area(3) );
+
+  // wire_load_table は最後の区間の傾きで外挿する．
+  auto tbl = library.wire_load("tbl");
+  ASSERT_TRUE( tbl.is_valid() );
+  EXPECT_TRUE( tbl.is_table() );
+  EXPECT_DOUBLE_EQ( 0.1, tbl.wire_capacitance(1) );
+  EXPECT_DOUBLE_EQ( 0.3, tbl.wire_capacitance(2) );
+  EXPECT_DOUBLE_EQ( 0.7, tbl.wire_capacitance(4) );
+  EXPECT_DOUBLE_EQ( 2.0, tbl.wire_length(1) );
+  EXPECT_DOUBLE_EQ( 6.0, tbl.wire_length(3) );
+  EXPECT_DOUBLE_EQ( 0.0, tbl.wire_resistance(3) );
+
+  // 該当するものがない場合はデフォルトのワイヤーロードとなる．
+  EXPECT_EQ( wl, library.select_wire_load(50.0) );
+  EXPECT_EQ( tbl, library.select_wire_load(150.0) );
+  EXPECT_EQ( wl, library.select_wire_load(500.0) );
+  EXPECT_EQ( tbl, library.select_wire_load(100.0, "sel") );
+  EXPECT_TRUE( library.select_wire_load(500.0, "sel").is_invalid() );
+  EXPECT_THROW( library.select_wire_load(50.0, "nosuch"),
+		std::invalid_argument );
+
+  // ダンプ/リストア後も同じ値となる．
+  ostringstream os;
+  library.dump(os);
+  istringstream is{os.str()};
+  auto library2 = ClibCellLibrary::restore(is);
+  EXPECT_EQ( "small", library2.default_wire_load().name() );
+  EXPECT_EQ( "enclosed", library2.default_wire_load_mode() );
+  EXPECT_EQ( 0.5, library2.default_wire_load_capacitance() );
+  EXPECT_DOUBLE_EQ( 0.7, library2.wire_load("tbl").wire_capacitance(4) );
+  EXPECT_EQ( "tbl", library2.select_wire_load(150.0).name() );
+}
+
+TEST(ClibCellLibraryTest, diff)
+{
+  string filename = string(DATA_DIR) + string("/HIT018.typ.snp");
+  auto library = ClibCellLibrary::read_liberty(filename);
+
+  // 同じ内容なら差分はない．
+  auto library2 = ClibCellLibrary::read_liberty(filename);
+  EXPECT_TRUE( library.diff(library2).empty() );
+
+  // 部分ライブラリとの比較
+  ASSERT_TRUE( library.cell_num() > 3 );
+  vector<string> cell_names;
+  for ( SizeType i = 0; i < 3; ++ i ) {
+    cell_names.push_back(library.cell(i).name());
+  }
+  auto sub_library = library.subset(cell_names);
+  auto item_list = library.diff(sub_library);
+  ASSERT_EQ( library.cell_num() - 3, item_list.size() );
+  for ( auto& item: item_list ) {
+    EXPECT_EQ( ClibDiffItem::Cell, item.kind );
+    EXPECT_EQ( 1.0, item.value1 );
+    EXPECT_EQ( 0.0, item.value2 );
+  }
+  EXPECT_EQ( library.cell(3).name(), item_list[0].cell_name );
+
+  // 逆向きの比較
+  auto item_list2 = sub_library.diff(library);
+  ASSERT_EQ( library.cell_num() - 3, item_list2.size() );
+  EXPECT_EQ( 0.0, item_list2[0].value1 );
+  EXPECT_EQ( 1.0, item_list2[0].value2 );
+
+  // 結果はスレッド数によらない．
+  ClibDiffParam param;
+  param.max_diff = 5;
+  param.thread_num = 4;
+  auto item_list3 = library.diff(sub_library, param);
+  ASSERT_EQ( 5, item_list3.size() );
+  for ( SizeType i = 0; i < 5; ++ i ) {
+    EXPECT_EQ( item_list[i].cell_name, item_list3[i].cell_name );
+  }
+}
+
+BEGIN_NONAMESPACE
+
+// セル名と属性名が一致する差分を探す．
+const ClibDiffItem*
+find_diff(
+  const vector<ClibDiffItem>& item_list,
+  const string& cell_name,
+  const string& attr_name
+)
+{
+  for ( auto& item: item_list ) {
+    if ( item.cell_name == cell_name && item.attr_name == attr_name ) {
+      return &item;
+    }
+  }
+  return nullptr;
+}
+
+END_NONAMESPACE
+
+TEST(ClibCellLibraryTest, diff_value)
+{
+  // corner_diff.lib は corner_typ.lib の以下の値を変えたもの
+  // - INV の area: 1.0 -> 1.5
+  // - INV の A の capacitance: 0.0010 -> 0.0011
+  // - INV の cell_rise の (1, 1): 0.22 -> 0.25
+  // - NAND2 の A -> Y の cell_fall の (0, 0): 0.09 -> nan
+  string filename1 = string(DATA_DIR) + string("/corner_typ.lib");
+  string filename2 = string(DATA_DIR) + string("/corner_diff.lib");
+  auto library1 = ClibCellLibrary::read_liberty(filename1);
+  auto library2 = ClibCellLibrary::read_liberty(filename2);
+
+  ClibDiffParam param;
+  {
+    auto item_list = library1.diff(library2, param);
+    auto area = find_diff(item_list, "INV", "area");
+    ASSERT_TRUE( area != nullptr );
+    EXPECT_EQ( ClibDiffItem::Attr, area->kind );
+    EXPECT_DOUBLE_EQ( 1.0, area->value1 );
+    EXPECT_DOUBLE_EQ( 1.5, area->value2 );
+
+    auto cap = find_diff(item_list, "INV", "capacitance");
+    ASSERT_TRUE( cap != nullptr );
+    EXPECT_EQ( "A", cap->pin_name );
+    EXPECT_DOUBLE_EQ( 0.0010, cap->value1 );
+    EXPECT_DOUBLE_EQ( 0.0011, cap->value2 );
+
+    auto lut = find_diff(item_list, "INV", "cell_rise");
+    ASSERT_TRUE( lut != nullptr );
+    EXPECT_EQ( ClibDiffItem::LutValue, lut->kind );
+    EXPECT_EQ( (vector<SizeType>{1, 1}), lut->grid_pos );
+    EXPECT_DOUBLE_EQ( 0.22, lut->value1 );
+    EXPECT_DOUBLE_EQ( 0.25, lut->value2 );
+    EXPECT_TRUE( find_diff(item_list, "INV", "cell_fall") == nullptr );
+
+    // NaN は等しいとみなさない．
+    auto nan_lut = find_diff(item_list, "NAND2", "cell_fall");
+    ASSERT_TRUE( nan_lut != nullptr );
+    EXPECT_EQ( ClibDiffItem::LutValue, nan_lut->kind );
+    EXPECT_EQ( "A", nan_lut->related_pin_name );
+    EXPECT_EQ( (vector<SizeType>{0, 0}), nan_lut->grid_pos );
+    EXPECT_DOUBLE_EQ( 0.09, nan_lut->value1 );
+    EXPECT_TRUE( std::isnan(nan_lut->value2) );
+  }
+
+  // 許容誤差の範囲内の差は無視される．
+  param.tolerance = 0.001;
+  {
+    auto item_list = library1.diff(library2, param);
+    EXPECT_TRUE( find_diff(item_list, "INV", "capacitance") == nullptr );
+    EXPECT_TRUE( find_diff(item_list, "INV", "area") != nullptr );
+    EXPECT_TRUE( find_diff(item_list, "INV", "cell_rise") != nullptr );
+    EXPECT_TRUE( find_diff(item_list, "NAND2", "cell_fall") != nullptr );
+  }
+  param.tolerance = 0.1;
+  {
+    auto item_list = library1.diff(library2, param);
+    EXPECT_TRUE( find_diff(item_list, "INV", "cell_rise") == nullptr );
+    EXPECT_TRUE( find_diff(item_list, "INV", "area") != nullptr );
+    EXPECT_TRUE( find_diff(item_list, "NAND2", "cell_fall") != nullptr );
+  }
+  // どんなに大きな許容誤差でも NaN は異なる値とみなされる．
+  param.tolerance = 1.0;
+  {
+    auto item_list = library1.diff(library2, param);
+    ASSERT_EQ( 1, item_list.size() );
+    EXPECT_EQ( "NAND2", item_list[0].cell_name );
+    EXPECT_EQ( "cell_fall", item_list[0].attr_name );
+  }
+}
+
+TEST(ClibCellLibraryTest, diff_edge)
+{
+  // edge_diff.lib は edge_typ.lib の以下の値を変えたもの
+  // - DFF の CK -> Q (rising_edge) の cell_rise の (1, 0): 0.30 -> 0.35
+  // - XOR2 の A -> Y (non_unate) の cell_fall の (0, 0): 0.13 -> 0.16
+  // どちらのタイミングも両方のセンスのリストに含まれるが，
+  // 差分は1回だけ報告される．
+  string filename1 = string(DATA_DIR) + string("/edge_typ.lib");
+  string filename2 = string(DATA_DIR) + string("/edge_diff.lib");
+  auto library1 = ClibCellLibrary::read_liberty(filename1);
+  auto library2 = ClibCellLibrary::read_liberty(filename2);
+
+  auto item_list = library1.diff(library2);
+  ASSERT_EQ( 2, item_list.size() );
+
+  auto& item1 = item_list[0];
+  EXPECT_EQ( ClibDiffItem::LutValue, item1.kind );
+  EXPECT_EQ( "DFF", item1.cell_name );
+  EXPECT_EQ( "Q", item1.pin_name );
+  EXPECT_EQ( "CK", item1.related_pin_name );
+  EXPECT_EQ( ClibTimingType::rising_edge, item1.timing_type );
+  EXPECT_EQ( ClibTimingSense::non_unate, item1.timing_sense );
+  EXPECT_EQ( "cell_rise", item1.attr_name );
+  EXPECT_EQ( (vector<SizeType>{1, 0}), item1.grid_pos );
+  EXPECT_DOUBLE_EQ( 0.30, item1.value1 );
+  EXPECT_DOUBLE_EQ( 0.35, item1.value2 );
+
+  auto& item2 = item_list[1];
+  EXPECT_EQ( ClibDiffItem::LutValue, item2.kind );
+  EXPECT_EQ( "XOR2", item2.cell_name );
+  EXPECT_EQ( "A", item2.related_pin_name );
+  EXPECT_EQ( "cell_fall", item2.attr_name );
+  EXPECT_DOUBLE_EQ( 0.13, item2.value1 );
+  EXPECT_DOUBLE_EQ( 0.16, item2.value2 );
+
+  // セル数より多いスレッド数を指定しても結果は変わらない．
+  ClibDiffParam param;
+  param.max_diff = 1;
+  param.thread_num = 4;
+  auto item_list1 = library1.diff(library2, param);
+  ASSERT_EQ( 1, item_list1.size() );
+  EXPECT_EQ( "DFF", item_list1[0].cell_name );
+}
+
+TEST(ClibCellLibraryTest, lut_value_list)
+{
+  string filename = string(DATA_DIR) + string("/HIT018.typ.snp");
+  auto library = ClibCellLibrary::read_liberty(filename);
+
+  SizeType lut_count = 0;
+  for ( auto cell: library.cell_list() ) {
+    for ( SizeType ipos = 0; ipos < cell.input2_num(); ++ ipos ) {
+      for ( SizeType opos = 0; opos < cell.output2_num(); ++ opos ) {
+	for ( auto timing: cell.timing_list(ipos, opos, ClibTimingSense::negative_unate) ) {
+	  auto lut = timing.cell_rise();
+	  if ( !lut.is_valid() ) {
+	    continue;
+	  }
+	  ++ lut_count;
+	  auto d = lut.dimension();
+
+	  // index_array() と value_array() は index()/grid_value() と一致する．
+	  SizeType grid_num = 1;
+	  for ( SizeType i = 0; i < d; ++ i ) {
+	    auto& index_array = lut.index_array(i);
+	    ASSERT_EQ( lut.index_num(i), index_array.size() );
+	    for ( SizeType pos = 0; pos < index_array.size(); ++ pos ) {
+	      EXPECT_EQ( lut.index(i, pos), index_array[pos] );
+	    }
+	    grid_num *= index_array.size();
+	  }
+	  auto& value_array = lut.value_array();
+	  ASSERT_EQ( grid_num, value_array.size() );
+	  vector<SizeType> pos_array(d, 0);
+	  for ( SizeType k = 0; k < grid_num; ++ k ) {
+	    EXPECT_EQ( lut.grid_value(pos_array), value_array[k] );
+	    // 最後の変数が最も速く変化する．
+	    for ( SizeType i = d; i > 0; -- i ) {
+	      if ( ++ pos_array[i - 1] < lut.index_num(i - 1) ) {
+		break;
+	      }
+	      pos_array[i - 1] = 0;
+	    }
+	  }
+
+	  // value_list() は value() を繰り返したものと一致する．
+	  // 範囲外の値(外挿)も含める．
+	  const SizeType n = 10;
+	  vector<vector<double>> input_list(d, vector<double>(n));
+	  for ( SizeType i = 0; i < d; ++ i ) {
+	    auto v0 = lut.index(i, 0);
+	    auto v1 = lut.index(i, lut.index_num(i) - 1);
+	    for ( SizeType k = 0; k < n; ++ k ) {
+	      input_list[i][k] = v0 + (v1 - v0) * (k * 1.2 - 1.0) / n;
+	    }
+	  }
+	  auto output_list = lut.value_list(input_list);
+	  ASSERT_EQ( n, output_list.size() );
+	  for ( SizeType k = 0; k < n; ++ k ) {
+	    vector<double> val_array(d);
+	    for ( SizeType i = 0; i < d; ++ i ) {
+	      val_array[i] = input_list[i][k];
+	    }
+	    EXPECT_EQ( lut.value(val_array), output_list[k] );
+	  }
+	}
+      }
+    }
+  }
+  EXPECT_TRUE( lut_count > 0 );
+}
+
+TEST(ClibCellLibraryTest, lut_value_list_bad_size)
+{
+  string filename = string(DATA_DIR) + string("/HIT018.typ.snp");
+  auto library = ClibCellLibrary::read_liberty(filename);
+
+  auto cell = library.cell("HIT18AND2P005");
+  ASSERT_TRUE( cell.is_valid() );
+  auto timing_list = cell.timing_list(0, 0, ClibTimingSense::positive_unate);
+  ASSERT_TRUE( timing_list.size() > 0 );
+  auto lut = timing_list[0].cell_rise();
+  ASSERT_TRUE( lut.is_valid() );
+  ASSERT_EQ( 2, lut.dimension() );
+
+  // 変数の数が合わない．
+  vector<vector<double>> input_list1(1, vector<double>(3, 0.0));
+  EXPECT_THROW( lut.value_list(input_list1), std::invalid_argument );
+  // 要素数が揃っていない．
+  vector<vector<double>> input_list2{vector<double>(3, 0.0),
+				     vector<double>(2, 0.0)};
+  EXPECT_THROW( lut.value_list(input_list2), std::invalid_argument );
+  EXPECT_THROW( lut.index_array(2), std::invalid_argument );
+}
+
 END_NAMESPACE_YM_CLIB
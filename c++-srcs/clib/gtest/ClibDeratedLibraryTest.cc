@@ -0,0 +1,121 @@
+/// @file ClibDeratedLibraryTest.cc
+/// @brief ClibDeratedLibraryTest の実装ファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2024 Yusuke Matsunaga
+/// All rights reserved.
+
+#include "gtest/gtest.h"
+#include "ym/ClibDeratedLibrary.h"
+#include "ym/ClibOperatingConditions.h"
+#include "ym/ClibCell.h"
+#include "ym/ClibPin.h"
+#include "ym/ClibTiming.h"
+#include "ym/ClibLut.h"
+#include "ym/ClibCapacitance.h"
+
+
+BEGIN_NAMESPACE_YM_CLIB
+
+TEST(ClibDeratedLibraryTest, operating_conditions)
+{
+  string filename = string(DATA_DIR) + string("/HIT018.typ.snp");
+  auto library = ClibCellLibrary::read_liberty(filename);
+
+  EXPECT_EQ(  1.0, library.nom_process() );
+  EXPECT_EQ( 25.0, library.nom_temperature() );
+  EXPECT_EQ(  1.8, library.nom_voltage() );
+  EXPECT_EQ( 0.000976544, library.k_factor("k_temp_cell_rise") );
+  EXPECT_EQ( -0.540192, library.k_factor("k_volt_cell_rise") );
+  EXPECT_EQ( 0.0, library.k_factor("k_process_cell_rise") );
+  EXPECT_EQ( 0.0, library.k_factor("k_volt_no_such_attr") );
+
+  ASSERT_EQ( 3, library.operating_conditions_num() );
+  auto oc = library.default_operating_conditions();
+  ASSERT_TRUE( oc.is_valid() );
+  EXPECT_EQ( "TYPICAL", oc.name() );
+  EXPECT_EQ( library.operating_conditions(1), oc );
+
+  auto worst = library.operating_conditions("WORST");
+  ASSERT_TRUE( worst.is_valid() );
+  EXPECT_EQ(  1.0, worst.process() );
+  EXPECT_EQ( 55.0, worst.temperature() );
+  EXPECT_EQ( 1.71, worst.voltage() );
+  EXPECT_EQ( "worst_case_tree", worst.tree_type() );
+
+  EXPECT_TRUE( library.operating_conditions("FOO").is_invalid() );
+  EXPECT_THROW( library.operating_conditions(3), std::out_of_range );
+
+  // dump/restore で保存される．
+  string dump_buff;
+  {
+    ostringstream s;
+    library.dump(s);
+    dump_buff = s.str();
+  }
+  ClibCellLibrary library2;
+  {
+    istringstream s{dump_buff};
+    library2 = ClibCellLibrary::restore(s);
+  }
+  EXPECT_EQ( library.nom_voltage(), library2.nom_voltage() );
+  EXPECT_EQ( library.k_factor("k_volt_cell_rise"),
+	     library2.k_factor("k_volt_cell_rise") );
+  ASSERT_EQ( 3, library2.operating_conditions_num() );
+  EXPECT_EQ( "TYPICAL", library2.default_operating_conditions().name() );
+}
+
+TEST(ClibDeratedLibraryTest, derate)
+{
+  string filename = string(DATA_DIR) + string("/HIT018.typ.snp");
+  auto library = ClibCellLibrary::read_liberty(filename);
+
+  // 公称値の動作条件では値は変わらない．
+  ClibDeratedLibrary typ{library, library.default_operating_conditions()};
+  EXPECT_DOUBLE_EQ( 1.0, typ.factor("cell_rise") );
+
+  ClibDeratedLibrary worst{library, library.operating_conditions("WORST")};
+  EXPECT_EQ( 1.71, worst.voltage() );
+  double exp_rise = (1.0 + 0.000976544 * (55.0 - 25.0))
+    * (1.0 - 0.540192 * (1.71 - 1.8));
+  EXPECT_DOUBLE_EQ( exp_rise, worst.factor("cell_rise") );
+  // 係数が指定されていないものは 1.0 となる．
+  EXPECT_DOUBLE_EQ( 1.0, worst.factor("pin_cap") );
+
+  SizeType lut_count = 0;
+  for ( auto cell: library.cell_list() ) {
+    for ( auto pin: cell.pin_list() ) {
+      EXPECT_EQ( pin.capacitance(), worst.capacitance(pin) );
+    }
+    for ( SizeType ipos = 0; ipos < cell.input2_num(); ++ ipos ) {
+      for ( SizeType opos = 0; opos < cell.output2_num(); ++ opos ) {
+	for ( auto timing: cell.timing_list(ipos, opos, ClibTimingSense::negative_unate) ) {
+	  auto lut = timing.cell_rise();
+	  if ( !lut.is_valid() ) {
+	    continue;
+	  }
+	  ++ lut_count;
+	  auto d = lut.dimension();
+	  vector<double> val_array(d);
+	  for ( SizeType i = 0; i < d; ++ i ) {
+	    auto n = lut.index_num(i);
+	    val_array[i] = n > 1 ? (lut.index(i, 0) + lut.index(i, 1)) / 2.0 : lut.index(i, 0);
+	  }
+	  auto exp_val = lut.value(val_array);
+	  EXPECT_DOUBLE_EQ( exp_val, typ.value(lut, val_array) );
+	  EXPECT_NEAR( exp_val * exp_rise, worst.value(lut, val_array), 1e-12 );
+	  vector<SizeType> pos_array(d, 0);
+	  EXPECT_NEAR( lut.grid_value(pos_array) * exp_rise,
+		       worst.grid_value(lut, pos_array), 1e-12 );
+	}
+      }
+    }
+  }
+  EXPECT_TRUE( lut_count > 0 );
+
+  // 不正な動作条件は指定できない．
+  EXPECT_THROW( (ClibDeratedLibrary{library, ClibOperatingConditions{}}),
+		std::invalid_argument );
+}
+
+END_NAMESPACE_YM_CLIB
@@ -0,0 +1,214 @@
+/// @file ClibMultiCornerTest.cc
+/// @brief ClibMultiCornerTest の実装ファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2024 Yusuke Matsunaga
+/// All rights reserved.
+
+#include "gtest/gtest.h"
+#include "ym/ClibMultiCorner.h"
+#include "ym/ClibCell.h"
+#include "ym/ClibPin.h"
+#include "ym/ClibTiming.h"
+#include "ym/ClibInternalPower.h"
+#include "ym/ClibLut.h"
+#include "ym/ClibCapacitance.h"
+
+
+BEGIN_NAMESPACE_YM_CLIB
+
+TEST(ClibMultiCornerTest, empty)
+{
+  ClibMultiCorner mc;
+  EXPECT_EQ( 0, mc.corner_num() );
+  EXPECT_THROW( mc.corner_name(0), std::out_of_range );
+}
+
+TEST(ClibMultiCornerTest, read_liberty)
+{
+  string filename = string(DATA_DIR) + string("/HIT018.typ.snp");
+  auto mc = ClibMultiCorner::read_liberty({filename, filename, filename});
+  ASSERT_EQ( 3, mc.corner_num() );
+
+  auto library = mc.library();
+  SizeType lut_count = 0;
+  for ( auto cell: library.cell_list() ) {
+    for ( auto pin: cell.pin_list() ) {
+      for ( SizeType c = 0; c < 3; ++ c ) {
+	EXPECT_EQ( pin.capacitance(), mc.capacitance(c, pin) );
+	EXPECT_EQ( pin.rise_capacitance(), mc.rise_capacitance(c, pin) );
+	EXPECT_EQ( pin.fall_capacitance(), mc.fall_capacitance(c, pin) );
+      }
+    }
+    for ( SizeType ipos = 0; ipos < cell.input2_num(); ++ ipos ) {
+      for ( SizeType opos = 0; opos < cell.output2_num(); ++ opos ) {
+	for ( auto sense: {ClibTimingSense::positive_unate,
+			   ClibTimingSense::negative_unate} ) {
+	  for ( auto timing: cell.timing_list(ipos, opos, sense) ) {
+	    auto lut = timing.cell_rise();
+	    if ( !lut.is_valid() ) {
+	      continue;
+	    }
+	    ++ lut_count;
+	    auto d = lut.dimension();
+	    // 格子点の中間と範囲外の点で比較する．
+	    vector<double> val_array(d);
+	    for ( SizeType i = 0; i < d; ++ i ) {
+	      auto n = lut.index_num(i);
+	      val_array[i] = n > 1 ? (lut.index(i, 0) + lut.index(i, 1)) / 2.0 : lut.index(i, 0);
+	    }
+	    auto exp_val = lut.value(val_array);
+	    auto val_list = mc.values(lut, val_array);
+	    ASSERT_EQ( 3, val_list.size() );
+	    for ( SizeType c = 0; c < 3; ++ c ) {
+	      EXPECT_DOUBLE_EQ( exp_val, val_list[c] );
+	      EXPECT_DOUBLE_EQ( exp_val, mc.value(c, lut, val_array) );
+	    }
+	    for ( SizeType i = 0; i < d; ++ i ) {
+	      val_array[i] = lut.index(i, lut.index_num(i) - 1) * 2.0;
+	    }
+	    EXPECT_DOUBLE_EQ( lut.value(val_array), mc.value(2, lut, val_array) );
+	    vector<SizeType> pos_array(d, 0);
+	    EXPECT_EQ( lut.grid_value(pos_array), mc.grid_value(1, lut, pos_array) );
+	  }
+	}
+      }
+    }
+  }
+  EXPECT_TRUE( lut_count > 0 );
+}
+
+BEGIN_NONAMESPACE
+
+// lut と lut2 の格子点の値が全て等しいか調べる．
+void
+check_grid_values(
+  const ClibMultiCorner& mc,
+  SizeType corner,
+  const ClibLut& lut,
+  const ClibLut& lut2
+)
+{
+  ASSERT_TRUE( lut.is_valid() );
+  ASSERT_TRUE( lut2.is_valid() );
+  ASSERT_EQ( 2, lut.dimension() );
+  for ( SizeType i = 0; i < lut.index_num(0); ++ i ) {
+    for ( SizeType j = 0; j < lut.index_num(1); ++ j ) {
+      vector<SizeType> pos_array{i, j};
+      EXPECT_DOUBLE_EQ( lut2.grid_value(pos_array),
+			mc.grid_value(corner, lut, pos_array) );
+    }
+  }
+  // 格子点の中間の値
+  vector<double> val_array{(lut.index(0, 0) + lut.index(0, 1)) / 2.0,
+			   (lut.index(1, 0) + lut.index(1, 1)) / 2.0};
+  EXPECT_DOUBLE_EQ( lut2.value(val_array),
+		    mc.value(corner, lut, val_array) );
+  EXPECT_DOUBLE_EQ( lut2.value(val_array),
+		    mc.values(lut, val_array)[corner] );
+}
+
+END_NONAMESPACE
+
+TEST(ClibMultiCornerTest, two_corners)
+{
+  // 2つのファイルは構造が同じで値が異なる．
+  // セルの並び順も異なっている．
+  string filename1 = string(DATA_DIR) + string("/corner_typ.lib");
+  string filename2 = string(DATA_DIR) + string("/corner_slow.lib");
+  auto library1 = ClibCellLibrary::read_liberty(filename1);
+  auto library2 = ClibCellLibrary::read_liberty(filename2);
+  ClibMultiCorner mc{{library1, library2}};
+  ASSERT_EQ( 2, mc.corner_num() );
+  EXPECT_EQ( "corner_typ", mc.corner_name(0) );
+  EXPECT_EQ( "corner_slow", mc.corner_name(1) );
+  ASSERT_TRUE( library1.cell(0).name() != library2.cell(0).name() );
+
+  vector<ClibCellLibrary> lib_list{library1, library2};
+  auto library = mc.library();
+  SizeType lut_count = 0;
+  SizeType power_count = 0;
+  for ( auto cell: library.cell_list() ) {
+    for ( SizeType c = 0; c < 2; ++ c ) {
+      auto cell2 = lib_list[c].cell(cell.name());
+      ASSERT_TRUE( cell2.is_valid() );
+      for ( SizeType i = 0; i < cell.pin_num(); ++ i ) {
+	auto pin = cell.pin(i);
+	auto pin2 = cell2.pin(i);
+	EXPECT_EQ( pin2.capacitance(), mc.capacitance(c, pin) );
+      }
+      for ( SizeType ipos = 0; ipos < cell.input2_num(); ++ ipos ) {
+	for ( SizeType opos = 0; opos < cell.output2_num(); ++ opos ) {
+	  auto sense = ClibTimingSense::negative_unate;
+	  auto timing_list = cell.timing_list(ipos, opos, sense);
+	  auto timing_list2 = cell2.timing_list(ipos, opos, sense);
+	  ASSERT_EQ( timing_list.size(), timing_list2.size() );
+	  for ( SizeType i = 0; i < timing_list.size(); ++ i ) {
+	    check_grid_values(mc, c, timing_list[i].cell_rise(),
+			      timing_list2[i].cell_rise());
+	    check_grid_values(mc, c, timing_list[i].cell_fall(),
+			      timing_list2[i].cell_fall());
+	    ++ lut_count;
+	  }
+	}
+      }
+      ASSERT_EQ( cell.internal_power_num(), cell2.internal_power_num() );
+      for ( SizeType i = 0; i < cell.internal_power_num(); ++ i ) {
+	auto ip = cell.internal_power(i);
+	auto ip2 = cell2.internal_power(i);
+	check_grid_values(mc, c, ip.rise_power(), ip2.rise_power());
+	check_grid_values(mc, c, ip.fall_power(), ip2.fall_power());
+	++ power_count;
+      }
+    }
+    // コーナーごとに値が異なっていることを確かめる．
+    auto pin = cell.pin(0);
+    EXPECT_TRUE( mc.capacitance(0, pin) != mc.capacitance(1, pin) );
+  }
+  EXPECT_EQ( 2 * 3, lut_count );
+  EXPECT_EQ( 2 * 3, power_count );
+}
+
+TEST(ClibMultiCornerTest, name_mismatch)
+{
+  // セル数とセルの構造は同じだがセル名が異なる．
+  string filename1 = string(DATA_DIR) + string("/corner_typ.lib");
+  string filename2 = string(DATA_DIR) + string("/corner_bad.lib");
+  EXPECT_THROW( ClibMultiCorner::read_liberty({filename1, filename2}),
+		std::invalid_argument );
+}
+
+TEST(ClibMultiCornerTest, mismatch)
+{
+  string filename1 = string(DATA_DIR) + string("/HIT018.typ.snp");
+  auto library1 = ClibCellLibrary::read_liberty(filename1);
+  auto library2 = library1.subset({library1.cell(0).name()});
+  EXPECT_THROW( (ClibMultiCorner{{library1, library2}}),
+		std::invalid_argument );
+}
+
+TEST(ClibMultiCornerTest, foreign_lut)
+{
+  string filename = string(DATA_DIR) + string("/HIT018.typ.snp");
+  auto library = ClibCellLibrary::read_liberty(filename);
+  ClibMultiCorner mc{{library}};
+  // 別に読み込んだライブラリの LUT は指定できない．
+  auto library2 = ClibCellLibrary::read_liberty(filename);
+  for ( auto cell: library2.cell_list() ) {
+    if ( cell.input2_num() == 0 || cell.output2_num() == 0 ) {
+      continue;
+    }
+    auto timing_list = cell.timing_list(0, 0, ClibTimingSense::negative_unate);
+    if ( timing_list.size() == 0 ) {
+      continue;
+    }
+    auto lut = timing_list[0].cell_rise();
+    if ( lut.is_valid() ) {
+      vector<double> val_array(lut.dimension(), 0.0);
+      EXPECT_THROW( mc.values(lut, val_array), std::invalid_argument );
+      break;
+    }
+  }
+}
+
+END_NAMESPACE_YM_CLIB
@@ -0,0 +1,75 @@
+
+/// @file OutBufTest.cc
+/// @brief OutBuf のユニットテスト
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2024 Yusuke Matsunaga
+/// All rights reserved.
+
+#include "gtest/gtest.h"
+#include "OutBuf.h"
+#include <stdexcept>
+
+
+BEGIN_NAMESPACE_YM_CLIB
+
+BEGIN_NONAMESPACE
+
+// pos 番目の要素を出力する．
+void
+write_elem(
+  OutBuf& buf,
+  SizeType pos
+)
+{
+  buf << "elem" << pos << '\n';
+}
+
+// write_parallel() の出力を文字列で返す．
+string
+parallel_str(
+  SizeType n,
+  SizeType thread_num
+)
+{
+  OutBuf buf;
+  buf << "head\n";
+  ostringstream s;
+  buf.write_parallel(s, n, thread_num, write_elem);
+  return s.str();
+}
+
+END_NONAMESPACE
+
+TEST(OutBufTest, write_parallel)
+{
+  auto ref_str = parallel_str(10, 1);
+  EXPECT_EQ( 0, ref_str.find("head\nelem0\nelem1\n") );
+  EXPECT_EQ( ref_str, parallel_str(10, 4) );
+}
+
+TEST(OutBufTest, write_parallel_many_threads)
+{
+  // 要素数よりスレッド数が多くても同じ結果になる．
+  auto ref_str = parallel_str(3, 1);
+  EXPECT_EQ( ref_str, parallel_str(3, 64) );
+}
+
+TEST(OutBufTest, write_parallel_exception)
+{
+  // ワーカースレッドの例外は呼び出し元で受け取れる．
+  auto func = [](OutBuf& buf, SizeType pos) {
+    if ( pos == 5 ) {
+      throw std::runtime_error{"error at 5"};
+    }
+    write_elem(buf, pos);
+  };
+  for ( SizeType thread_num: {1, 4} ) {
+    OutBuf buf;
+    ostringstream s;
+    EXPECT_THROW( buf.write_parallel(s, 10, thread_num, func),
+		  std::runtime_error );
+  }
+}
+
+END_NAMESPACE_YM_CLIB
@@ -44,6 +44,9 @@ CellInfo::set(
   // ピンの属性情報を取り出す．
   set_pin();
 
+  // リーク電力の情報を取り出す．
+  set_leakage_power();
+
   mInputId = 0;
   mOutputId = 0;
 
@@ -144,12 +147,24 @@ CellInfo::add_cell()
   for ( auto& pininfo: mPinInfoList ) {
     pininfo.add_pin(cell, mIpinMap);
   }
+  // internal_power の related_pin を名前で検索するので
+  // ここでピン名の表を作っておく．
+  cell->make_pin_table();
 
   // タイミングを作る．
   cell->init_timing_map();
   for ( auto& pininfo: mPinInfoList ) {
     pininfo.add_timing(cell, mIpinMap);
   }
+
+  // 電力情報を作る．
+  for ( auto& pininfo: mPinInfoList ) {
+    pininfo.add_internal_power(cell, mIpinMap);
+  }
+  cell->set_cell_leakage_power(mCellLeakagePower);
+  for ( auto& lp_info: mLeakagePowerInfoList ) {
+    lp_info.add_leakage_power(cell, mIpinMap);
+  }
 }
 
 // @brief FF セルを作る．
@@ -235,7 +250,7 @@ void
 CellInfo::set_area()
 {
   // 面積
-  const char* keyword{"area"};
+  AttrKwd keyword{AttrKwd::area};
   if ( !get_area(keyword, mArea) ) {
     auto label = "'area' attribute is missing";
     parse_error(label);
@@ -247,7 +262,7 @@ void
 CellInfo::set_FF()
 {
   mHasFF = false;
-  const char* keyword{"ff"};
+  AttrKwd keyword{AttrKwd::ff};
   auto ff_val = get_value(keyword);
   if ( ff_val ) {
     mHasFF = true;
@@ -260,7 +275,7 @@ void
 CellInfo::set_Latch()
 {
   mHasLatch = false;
-  const char* keyword{"latch"};
+  AttrKwd keyword{AttrKwd::latch};
   auto latch_val = get_value(keyword);
   if ( latch_val ) {
     mHasLatch = true;
@@ -273,7 +288,7 @@ void
 CellInfo::set_FSM()
 {
   mHasFSM = false;
-  const char* keyword{"statetable"};
+  AttrKwd keyword{AttrKwd::statetable};
   auto fsm_val = get_value(keyword);
   if ( fsm_val ) {
     mHasFSM = true;
@@ -285,14 +300,14 @@ CellInfo::set_FSM()
 void
 CellInfo::set_pin()
 {
-  const char* keyword{"pin"};
-  if ( elem_dict().count(keyword) == 0 ) {
+  AttrKwd keyword{AttrKwd::pin};
+  auto vec = elem_list(keyword);
+  if ( vec.empty() ) {
     // pin 情報がないセルはないはず．
     auto label = "No 'pin' attributes";
     parse_error(label);
   }
 
-  auto& vec = elem_dict().at(keyword);
   SizeType npin = vec.size();
   mPinInfoList.clear();
   mPinInfoList.reserve(npin);
@@ -304,4 +319,22 @@ CellInfo::set_pin()
   }
 }
 
+// @brief リーク電力の情報を取り出す．
+void
+CellInfo::set_leakage_power()
+{
+  if ( !get_float(AttrKwd::cell_leakage_power, mCellLeakagePower) ) {
+    mCellLeakagePower = 0.0;
+  }
+
+  auto vec = elem_list(AttrKwd::leakage_power);
+  mLeakagePowerInfoList.clear();
+  mLeakagePowerInfoList.reserve(vec.size());
+  for ( auto lp_val: vec ) {
+    mLeakagePowerInfoList.push_back(LeakagePowerInfo{library_info()});
+    auto& lp_info = mLeakagePowerInfoList.back();
+    lp_info.set(lp_val);
+  }
+}
+
 END_NAMESPACE_YM_DOTLIB
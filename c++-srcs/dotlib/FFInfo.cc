@@ -20,18 +20,18 @@ FFInfo::set(
   // 属性の辞書を作る．
   set_common(ast_val);
 
-  if ( !get_expr("clocked_on", mClockedOn) ) {
+  if ( !get_expr(AttrKwd::clocked_on, mClockedOn) ) {
     // FF に clocked_on は必須
     auto label = "'clocked_on' is missing.";
     parse_error(label);
   }
 
-  if ( !get_expr("clocked_on_also", mClockedOnAlso) ) {
+  if ( !get_expr(AttrKwd::clocked_on_also, mClockedOnAlso) ) {
     // これはエラーではない．
     mClockedOnAlso = nullptr;
   }
 
-  if ( !get_expr("next_state", mNextState) ) {
+  if ( !get_expr(AttrKwd::next_state, mNextState) ) {
     auto label = "'next_state' is missing.";
     parse_error(label);
   }
@@ -31,16 +31,16 @@ FLInfo::set_common(
   mVar1 = header.complex_elem_value(0).string_value();
   mVar2 = header.complex_elem_value(1).string_value();
 
-  if ( !get_expr("clear", mClear) ) {
+  if ( !get_expr(AttrKwd::clear, mClear) ) {
     mClear = nullptr;
   }
 
-  if ( !get_expr("preset", mPreset) ) {
+  if ( !get_expr(AttrKwd::preset, mPreset) ) {
     mPreset = nullptr;
   }
 
-  auto ret1 = get_cpv("clear_preset_var1", mCpv1);
-  auto ret2 = get_cpv("clear_preset_var2", mCpv2);
+  auto ret1 = get_cpv(AttrKwd::clear_preset_var1, mCpv1);
+  auto ret2 = get_cpv(AttrKwd::clear_preset_var2, mCpv2);
   if ( ret1 ) {
     if ( !ret2 ) {
       // clear_preset_var1 が定義されているのに clear_preset_var2 が定義されていない．
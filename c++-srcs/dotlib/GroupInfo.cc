@@ -14,6 +14,7 @@
 #include "ym/ClibResistance.h"
 #include "ym/ClibTime.h"
 #include "ym/MsgMgr.h"
+#include <algorithm>
 
 
 BEGIN_NAMESPACE_YM_DOTLIB
@@ -22,34 +23,52 @@ BEGIN_NAMESPACE_YM_DOTLIB
 // クラス GroupInfo
 //////////////////////////////////////////////////////////////////////
 
+// @brief キーワードの値のリストを返す．
+vector<const AstValue*>
+GroupInfo::elem_list(
+  AttrKwd keyword
+) const
+{
+  vector<const AstValue*> val_list;
+  for ( auto p = find_first(keyword);
+	p != mKwdList.end() && p->first == static_cast<std::uint32_t>(keyword);
+	++ p ) {
+    val_list.push_back(mElemList[p->second]);
+  }
+  return val_list;
+}
+
 // @brief キーワードの値を返す．
 const AstValue*
 GroupInfo::get_value(
-  const char* keyword
+  AttrKwd keyword
 ) const
 {
-  if ( mElemDict.count(keyword) == 0 ) {
+  auto kid = static_cast<std::uint32_t>(keyword);
+  auto p = find_first(keyword);
+  if ( p == mKwdList.end() || p->first != kid ) {
     // なし
     return nullptr;
   }
 
-  auto& vec = mElemDict.at(keyword);
-  if ( vec.size() > 1 ) {
+  auto pos = p->second;
+  ++ p;
+  if ( p != mKwdList.end() && p->first == kid ) {
     // 2回以上指定されている．
     ostringstream buf;
-    buf << keyword << " apears more than once."
-	<< " previous occurance is " << vec[0]->loc();
+    buf << attr_kwd_str(keyword) << " apears more than once."
+	<< " previous occurance is " << mElemList[pos]->loc();
     auto label = buf.str();
     parse_error(label);
   }
 
-  return vec[0];
+  return mElemList[pos];
 }
 
 // @brief string の値を取り出す．
 bool
 GroupInfo::get_string(
-  const char* keyword,
+  AttrKwd keyword,
   ShString& val
 ) const
 {
@@ -61,10 +80,25 @@ GroupInfo::get_string(
   return false;
 }
 
+// @brief float の値を取り出す．
+bool
+GroupInfo::get_float(
+  AttrKwd keyword,
+  double& val
+) const
+{
+  auto _val = get_value(keyword);
+  if ( _val != nullptr ) {
+    val = _val->float_value();
+    return true;
+  }
+  return false;
+}
+
 // @brief area の値を取り出す．
 bool
 GroupInfo::get_area(
-  const char* keyword,
+  AttrKwd keyword,
   ClibArea& val
 ) const
 {
@@ -79,7 +113,7 @@ GroupInfo::get_area(
 // @brief capacitance の値を取り出す．
 bool
 GroupInfo::get_capacitance(
-  const char* keyword,
+  AttrKwd keyword,
   ClibCapacitance& val
 ) const
 {
@@ -94,7 +128,7 @@ GroupInfo::get_capacitance(
 // @brief resistance の値を取り出す．
 bool
 GroupInfo::get_resistance(
-  const char* keyword,
+  AttrKwd keyword,
   ClibResistance& val
 ) const
 {
@@ -109,7 +143,7 @@ GroupInfo::get_resistance(
 // @brief time の値を取り出す．
 bool
 GroupInfo::get_time(
-  const char* keyword,
+  AttrKwd keyword,
   ClibTime& val
 ) const
 {
@@ -124,7 +158,7 @@ GroupInfo::get_time(
 // @brief ClibCPV の値を取り出す．
 bool
 GroupInfo::get_cpv(
-  const char* keyword,
+  AttrKwd keyword,
   ClibCPV& val
 ) const
 {
@@ -160,7 +194,7 @@ GroupInfo::get_cpv(
 // @brief ClibVarType の値を取り出す．
 bool
 GroupInfo::get_variable_type(
-  const char* keyword,
+  AttrKwd keyword,
   ClibVarType& val
 ) const
 {
@@ -175,7 +209,7 @@ GroupInfo::get_variable_type(
 // @brief expr の値を取り出す．
 bool
 GroupInfo::get_expr(
-  const char* keyword,
+  AttrKwd keyword,
   const AstExpr*& val
 ) const
 {
@@ -190,7 +224,7 @@ GroupInfo::get_expr(
 // @brief direction の値を取り出す．
 bool
 GroupInfo::get_direction(
-  const char* keyword,
+  AttrKwd keyword,
   ClibDirection& val
 ) const
 {
@@ -205,7 +239,7 @@ GroupInfo::get_direction(
 // @brief timing_type の値を取り出す．
 bool
 GroupInfo::get_timing_type(
-  const char* keyword,
+  AttrKwd keyword,
   ClibTimingType& val
 ) const
 {
@@ -220,7 +254,7 @@ GroupInfo::get_timing_type(
 // @brief timing_sense の値を取り出す．
 bool
 GroupInfo::get_timing_sense(
-  const char* keyword,
+  AttrKwd keyword,
   ClibTimingSense& val
 ) const
 {
@@ -235,7 +269,7 @@ GroupInfo::get_timing_sense(
 // @brief float_vector の値を取り出す．
 bool
 GroupInfo::get_float_vector(
-  const char* keyword,
+  AttrKwd keyword,
   vector<double>& val
 ) const
 {
@@ -250,7 +284,7 @@ GroupInfo::get_float_vector(
 // @brief complex 形式の float_vector の値を取り出す．
 bool
 GroupInfo::get_complex_float_vector(
-  const char* keyword,
+  AttrKwd keyword,
   vector<double>& val
 ) const
 {
@@ -275,17 +309,38 @@ GroupInfo::set(
   mLoc = val->loc();
 
   SizeType n = val->group_elem_size();
+  mElemList.clear();
+  mElemList.reserve(n);
+  mKwdList.clear();
+  mKwdList.reserve(n);
   for ( SizeType i = 0; i < n; ++ i ) {
-    auto& elem = val->group_elem_attr(i);
-    auto kwd = elem.kwd();
-    auto val = &elem.value();
-    if ( mElemDict.count(kwd) == 0 ) {
-      mElemDict.emplace(kwd, vector<const AstValue*>{val});
-    }
-    else {
-      mElemDict.at(kwd).push_back(val);
+    auto& attr = val->group_elem_attr(i);
+    mElemList.push_back(&attr.value());
+    auto kid = static_cast<SizeType>(attr.kwd_id());
+    if ( kid >= ATTR_KWD_NUM ) {
+      // 未登録の属性名は参照されないので無視する．
+      continue;
     }
+    mKwdList.push_back({static_cast<std::uint32_t>(kid),
+			static_cast<std::uint32_t>(i)});
   }
+  // 要素番号は昇順に追加しているので，整列後も
+  // 同じキーワードの要素は出現順に並ぶ．
+  std::sort(mKwdList.begin(), mKwdList.end());
+}
+
+// @brief キーワードの最初の要素を指す反復子を返す．
+vector<pair<std::uint32_t, std::uint32_t>>::const_iterator
+GroupInfo::find_first(
+  AttrKwd keyword
+) const
+{
+  auto kid = static_cast<std::uint32_t>(keyword);
+  return std::lower_bound(mKwdList.begin(), mKwdList.end(), kid,
+			  [](const pair<std::uint32_t, std::uint32_t>& a,
+			     std::uint32_t b) {
+			    return a.first < b;
+			  });
 }
 
 // @brief エラー処理を行う．
@@ -0,0 +1,118 @@
+/// @file InternalPowerInfo.cc
+/// @brief InternalPowerInfo の実装ファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2024 Yusuke Matsunaga
+/// All rights reserved.
+
+#include "dotlib/InternalPowerInfo.h"
+#include "dotlib/AstValue.h"
+#include "dotlib/AstExpr.h"
+#include "ci/CiCell.h"
+#include "ym/split.h"
+
+
+BEGIN_NAMESPACE_YM_DOTLIB
+
+//////////////////////////////////////////////////////////////////////
+// クラス InternalPowerInfo
+//////////////////////////////////////////////////////////////////////
+
+// @brief 内容を設定する．
+void
+InternalPowerInfo::set(
+  const AstValue* ip_val
+)
+{
+  GroupInfo::set(ip_val);
+
+  if ( !get_expr(AttrKwd::when, mWhen) ) {
+    mWhen = nullptr;
+  }
+
+  // related_pin は空白区切りで複数のピン名を持つことがある．
+  mRelatedPin.clear();
+  for ( auto v: elem_list(AttrKwd::related_pin) ) {
+    string tmp_str{v->string_value()};
+    for ( auto& name: split(tmp_str) ) {
+      mRelatedPin.push_back(ShString{name});
+    }
+  }
+
+  auto p_val = get_value(AttrKwd::power);
+  auto rp_val = get_value(AttrKwd::rise_power);
+  auto fp_val = get_value(AttrKwd::fall_power);
+  if ( p_val != nullptr && (rp_val != nullptr || fp_val != nullptr) ) {
+    auto label = "'power' and 'rise_power'/'fall_power' are mutually exclusive.";
+    parse_error(label);
+  }
+
+  mHasPower = false;
+  if ( p_val != nullptr ) {
+    mPower.set(p_val);
+    mHasPower = true;
+  }
+  mHasRisePower = false;
+  if ( rp_val != nullptr ) {
+    mRisePower.set(rp_val);
+    mHasRisePower = true;
+  }
+  mHasFallPower = false;
+  if ( fp_val != nullptr ) {
+    mFallPower.set(fp_val);
+    mHasFallPower = true;
+  }
+}
+
+// @brief 内部電力を作る．
+void
+InternalPowerInfo::add_internal_power(
+  CiCell* cell,
+  const vector<const CiPin*>& pin_list,
+  const unordered_map<ShString, SizeType>& ipin_map
+) const
+{
+  auto when = Expr::one();
+  if ( mWhen != nullptr ) {
+    when = mWhen->to_expr(ipin_map);
+  }
+
+  vector<const CiPin*> related_pin_list;
+  related_pin_list.reserve(mRelatedPin.size());
+  for ( auto name: mRelatedPin ) {
+    auto pin = cell->find_pin(name);
+    if ( pin == nullptr ) {
+      ostringstream buf;
+      buf << name << ": No such pin";
+      auto label = buf.str();
+      parse_error(label);
+    }
+    related_pin_list.push_back(pin);
+  }
+  if ( related_pin_list.empty() ) {
+    related_pin_list.push_back(nullptr);
+  }
+
+  for ( auto pin: pin_list ) {
+    for ( auto related_pin: related_pin_list ) {
+      // power グループの場合は同じ内容の LUT を2つ作る．
+      unique_ptr<CiLut> rise_lut;
+      unique_ptr<CiLut> fall_lut;
+      if ( mHasPower ) {
+	rise_lut = mPower.gen_lut();
+	fall_lut = mPower.gen_lut();
+      }
+      if ( mHasRisePower ) {
+	rise_lut = mRisePower.gen_lut();
+      }
+      if ( mHasFallPower ) {
+	fall_lut = mFallPower.gen_lut();
+      }
+      cell->add_internal_power(pin, related_pin, when,
+			       std::move(rise_lut),
+			       std::move(fall_lut));
+    }
+  }
+}
+
+END_NAMESPACE_YM_DOTLIB
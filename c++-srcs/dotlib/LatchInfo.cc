@@ -19,17 +19,17 @@ LatchInfo::set(
 {
   set_common(ast_val);
 
-  if ( !get_expr("enable_on", mEnableOn) ) {
+  if ( !get_expr(AttrKwd::enable, mEnableOn) ) {
     // ラッチの場合はエラーではない．
     mEnableOn = nullptr;
   }
 
-  if ( !get_expr("enable_on_also", mEnableOnAlso) ) {
+  if ( !get_expr(AttrKwd::enable_also, mEnableOnAlso) ) {
     // これはエラーではない．
     mEnableOnAlso = nullptr;
   }
 
-  if ( !get_expr("data_in", mDataIn) ) {
+  if ( !get_expr(AttrKwd::data_in, mDataIn) ) {
     // これはエラーではない．
     mDataIn = nullptr;
   }
@@ -0,0 +1,52 @@
+/// @file LeakagePowerInfo.cc
+/// @brief LeakagePowerInfo の実装ファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2024 Yusuke Matsunaga
+/// All rights reserved.
+
+#include "dotlib/LeakagePowerInfo.h"
+#include "dotlib/AstValue.h"
+#include "dotlib/AstExpr.h"
+#include "ci/CiCell.h"
+
+
+BEGIN_NAMESPACE_YM_DOTLIB
+
+//////////////////////////////////////////////////////////////////////
+// クラス LeakagePowerInfo
+//////////////////////////////////////////////////////////////////////
+
+// @brief 内容を設定する．
+void
+LeakagePowerInfo::set(
+  const AstValue* lp_val
+)
+{
+  GroupInfo::set(lp_val);
+
+  if ( !get_expr(AttrKwd::when, mWhen) ) {
+    mWhen = nullptr;
+  }
+
+  if ( !get_float(AttrKwd::value, mValue) ) {
+    auto label = "'value' is missing.";
+    parse_error(label);
+  }
+}
+
+// @brief リーク電力を追加する．
+void
+LeakagePowerInfo::add_leakage_power(
+  CiCell* cell,
+  const unordered_map<ShString, SizeType>& ipin_map
+) const
+{
+  auto when = Expr::one();
+  if ( mWhen != nullptr ) {
+    when = mWhen->to_expr(ipin_map);
+  }
+  cell->add_leakage_power(when, mValue);
+}
+
+END_NAMESPACE_YM_DOTLIB
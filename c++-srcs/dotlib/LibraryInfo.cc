@@ -12,6 +12,9 @@
 #include "dotlib/AstValue.h"
 #include "dotlib/LuTemplInfo.h"
 #include "dotlib/CellInfo.h"
+#include "dotlib/WireLoadInfo.h"
+#include "dotlib/WireLoadSelectionInfo.h"
+#include "dotlib/OperatingConditionsInfo.h"
 #include "ym/split.h"
 #include "ym/MsgMgr.h"
 
@@ -28,6 +31,8 @@ LibraryInfo::set(
   const AstValue& lib_val
 )
 {
+  mProfiler.start();
+
   GroupInfo::set(&lib_val);
 
   { // ライブラリ名の設定
@@ -50,39 +55,112 @@ LibraryInfo::set(
   set_piece_params();
 
   // 'bus_naming_style' の設定
-  set_str_attr("bus_naming_style");
+  set_str_attr(AttrKwd::bus_naming_style);
 
   // 'comment' の設定
-  set_str_attr("comment");
+  set_str_attr(AttrKwd::comment);
 
   // 'date' の設定
-  set_str_attr("date");
+  set_str_attr(AttrKwd::date);
 
   // 'revision' の設定
-  set_str_attr("revision");
+  set_str_attr(AttrKwd::revision);
 
   // 'time_unit' の設定
-  set_str_attr("time_unit");
+  set_str_attr(AttrKwd::time_unit);
 
   // 'voltage_unit' の設定
-  set_str_attr("voltage_unit");
+  set_str_attr(AttrKwd::voltage_unit);
 
   // 'current_unit' の設定
-  set_str_attr("current_unit");
+  set_str_attr(AttrKwd::current_unit);
 
   // 'pulling_resistance_unit' の設定
-  set_str_attr("pulling_resistance_unit");
+  set_str_attr(AttrKwd::pulling_resistance_unit);
 
   // 'capacitive_load_unit' の設定
   set_capacitive_load_unit();
 
   // 'leakage_power_unit' の設定
-  set_str_attr("leakage_power_unit");
+  set_str_attr(AttrKwd::leakage_power_unit);
+
+  // 'default_wire_load' などの設定
+  set_str_attr(AttrKwd::default_wire_load);
+  set_str_attr(AttrKwd::default_wire_load_selection);
+  set_str_attr(AttrKwd::default_wire_load_mode);
+  set_float_attr(AttrKwd::default_wire_load_area);
+  set_float_attr(AttrKwd::default_wire_load_capacitance);
+  set_float_attr(AttrKwd::default_wire_load_resistance);
+
+  // 'nom_process' などの設定
+  set_float_attr(AttrKwd::nom_process);
+  set_float_attr(AttrKwd::nom_temperature);
+  set_float_attr(AttrKwd::nom_voltage);
+
+  // k_process_XXX/k_temp_XXX/k_volt_XXX の設定
+  // AttrKwd は属性名の辞書順に並んでいるので連続した範囲になっている．
+  {
+    auto first = static_cast<SizeType>(AttrKwd::k_process_cell_fall);
+    auto last = static_cast<SizeType>(AttrKwd::k_volt_wire_res);
+    for ( auto i = first; i <= last; ++ i ) {
+      set_float_attr(static_cast<AttrKwd>(i));
+    }
+  }
+
+  // operating_conditions の設定
+  for ( auto ast_oc: elem_list(AttrKwd::operating_conditions) ) {
+    try {
+      OperatingConditionsInfo info{*this};
+      info.set(ast_oc);
+      info.add_operating_conditions();
+    }
+    catch ( std::invalid_argument ) {
+      ++ nerrs;
+    }
+  }
+
+  // 'default_operating_conditions' の設定
+  set_str_attr(AttrKwd::default_operating_conditions);
+
+  // wire_load/wire_load_table の設定
+  // どちらも同じ名前空間で管理する．
+  for ( auto ast_wl: elem_list(AttrKwd::wire_load) ) {
+    try {
+      WireLoadInfo info{*this};
+      info.set_wire_load(ast_wl);
+      info.add_wire_load();
+    }
+    catch ( std::invalid_argument ) {
+      ++ nerrs;
+    }
+  }
+  for ( auto ast_wl: elem_list(AttrKwd::wire_load_table) ) {
+    try {
+      WireLoadInfo info{*this};
+      info.set_wire_load_table(ast_wl);
+      info.add_wire_load();
+    }
+    catch ( std::invalid_argument ) {
+      ++ nerrs;
+    }
+  }
+
+  // wire_load_selection の設定
+  for ( auto ast_sel: elem_list(AttrKwd::wire_load_selection) ) {
+    try {
+      WireLoadSelectionInfo info{*this};
+      info.set(ast_sel);
+      info.add_wire_load_selection();
+    }
+    catch ( std::invalid_argument ) {
+      ++ nerrs;
+    }
+  }
 
-  // lu_table_template の設定
-  if ( elem_dict().count("lu_table_template") > 0 ) {
-    auto& vec = elem_dict().at("lu_table_template");
-    for ( auto ast_templ: vec ) {
+  // lu_table_template/power_lut_template の設定
+  // どちらも同じ名前空間で管理する．
+  for ( auto kwd: {AttrKwd::lu_table_template, AttrKwd::power_lut_template} ) {
+    for ( auto ast_templ: elem_list(kwd) ) {
       try {
 	LuTemplInfo info{*this};
 	info.set(ast_templ);
@@ -95,34 +173,44 @@ LibraryInfo::set(
     }
   }
 
+  if ( mProfiler.is_enabled() ) {
+    // オブジェクト数はライブラリ直下のグループ(セル以外)の数とする．
+    SizeType num = 0;
+    for ( auto kwd: {AttrKwd::operating_conditions,
+		     AttrKwd::wire_load,
+		     AttrKwd::wire_load_table,
+		     AttrKwd::wire_load_selection,
+		     AttrKwd::lu_table_template,
+		     AttrKwd::power_lut_template} ) {
+      num += elem_list(kwd).size();
+    }
+    mProfiler.stop("info", 0, num);
+  }
+
   // セルの内容の設定
-  if ( elem_dict().count("cell") > 0 ) {
-    auto& v = elem_dict().at("cell");
-    for ( auto ast_cell: v ) {
-      try {
-	CellInfo cell_info{*this};
-	cell_info.set(ast_cell);
-	cell_info.add_cell();
-      }
-      catch ( std::invalid_argument ) {
-	++ nerrs;
-      }
+  mProfiler.start();
+  for ( auto ast_cell: elem_list(AttrKwd::cell) ) {
+    try {
+      CellInfo cell_info{*this};
+      cell_info.set(ast_cell);
+      cell_info.add_cell();
+    }
+    catch ( std::invalid_argument ) {
+      ++ nerrs;
     }
   }
 
   if ( nerrs > 0 ) {
     throw std::invalid_argument{"syntax error"};
   }
-
-  mLibrary->compile();
-  mLibrary->wrap_up();
+  mProfiler.stop("cell", 0, mLibrary->cell_num());
 }
 
 // @brief technology の属性をセットする．
 void
 LibraryInfo::set_technology()
 {
-  const char* keyword{"technology"};
+  AttrKwd keyword{AttrKwd::technology};
   auto val = get_value(keyword);
   if ( val != nullptr ) {
     auto technology = val->technology_value();
@@ -138,7 +226,7 @@ LibraryInfo::set_technology()
 void
 LibraryInfo::set_delay_model()
 {
-  const char* keyword{"delay_model"};
+  AttrKwd keyword{AttrKwd::delay_model};
   auto val = get_value(keyword);
   if ( val != nullptr ) {
     auto delay_model = val->delay_model_value();
@@ -150,8 +238,8 @@ LibraryInfo::set_delay_model()
 void
 LibraryInfo::set_piece_params()
 {
-  const char* keyword1{"piece_type"};
-  const char* keyword2{"piece_define"};
+  AttrKwd keyword1{AttrKwd::piece_type};
+  AttrKwd keyword2{AttrKwd::piece_define};
   if ( mLibrary->delay_model() == ClibDelayModel::piecewise_cmos ) {
     ClibVarType piece_type{ClibVarType::output_net_length}; // デフォルト値
     auto val = get_value(keyword1);
@@ -186,12 +274,24 @@ LibraryInfo::set_piece_params()
 // 文字列型の属性をセットする．
 void
 LibraryInfo::set_str_attr(
-  const char* keyword
+  AttrKwd keyword
 )
 {
   ShString tmp_str;
   if ( get_string(keyword, tmp_str) ) {
-    mLibrary->set_attr(keyword, tmp_str);
+    mLibrary->set_attr(attr_kwd_str(keyword), tmp_str);
+  }
+}
+
+// 浮動小数点型の属性をセットする．
+void
+LibraryInfo::set_float_attr(
+  AttrKwd keyword
+)
+{
+  double val;
+  if ( get_float(keyword, val) ) {
+    mLibrary->set_attr(attr_kwd_str(keyword), val);
   }
 }
 
@@ -199,7 +299,7 @@ LibraryInfo::set_str_attr(
 void
 LibraryInfo::set_capacitive_load_unit()
 {
-  const char* keyword{"capacitive_load_unit"};
+  AttrKwd keyword{AttrKwd::capacitive_load_unit};
   auto val = get_value(keyword);
   if ( val ) {
     ASSERT_COND( val->complex_elem_size() == 2 );
@@ -216,37 +316,79 @@ BEGIN_NAMESPACE_YM_CLIB
 // @brief liberty 形式のファイルを読み込んでライブラリに設定する．
 CiCellLibrary*
 CiCellLibrary::read_liberty(
-  const string& filename
+  const string& filename,
+  const ClibPatGenParam& param,
+  ClibLoadProfile* profile
 )
 {
   using namespace nsDotlib;
 
+  CiLoadProfiler profiler{profile};
+  if ( profile != nullptr ) {
+    profile->filename = filename;
+    profile->phase_list.clear();
+  }
+
   // ファイルを開く
   ifstream fin{filename};
   if ( !fin ) {
     ostringstream buf;
     buf << filename << ": Could not open.";
-    MsgMgr::put_msg(__FILE__, __LINE__,
-		    FileRegion(),
-		    MsgType::Failure,
-		    "DOTLIB_PARSER",
-		    buf.str());
+    {
+      std::lock_guard<std::mutex> lock{reader_mutex()};
+      MsgMgr::put_msg(__FILE__, __LINE__,
+		      FileRegion(),
+		      MsgType::Failure,
+		      "DOTLIB_PARSER",
+		      buf.str());
+    }
     // ファイルが開けなかった．
     throw std::invalid_argument{buf.str()};
   }
 
-  // 読み込んでASTを作る．
-  Parser parser{fin, {filename}, false};
-  auto ast_library = parser.parse();
-
-  ASSERT_COND( ast_library->kwd() == "library" );
+  // ファイルの読み込みを排他制御の外で行うために
+  // ファイルの内容を先にメモリに読み込んでおく．
+  profiler.start();
+  istringstream sin;
+  SizeType file_size = 0;
+  {
+    ostringstream buf;
+    buf << fin.rdbuf();
+    auto contents = buf.str();
+    file_size = contents.size();
+    sin.str(contents);
+  }
+  profiler.stop("read", file_size, 1);
 
   unique_ptr<CiCellLibrary> lib_ptr{new CiCellLibrary{}};
+  lib_ptr->set_pg_param(param);
+
+  {
+    // 構文解析と AST からの変換は ShString と MsgMgr を用いるので
+    // 他の読み込み処理と排他制御する．
+    std::lock_guard<std::mutex> lock{reader_mutex()};
+
+    // 読み込んでASTを作る．
+    profiler.start();
+    Parser parser{sin, {filename}, false};
+    auto ast_library = parser.parse();
+    profiler.stop("parse", file_size, parser.token_num());
+
+    ASSERT_COND( ast_library->kwd() == "library" );
+
+    LibraryInfo lib_info{lib_ptr.get(), profile};
+
+    // AstValue の内容をライブラリに設定する．
+    lib_info.set(ast_library->value());
+  }
 
-  LibraryInfo lib_info{lib_ptr.get()};
+  // ここから先はこのライブラリの中で閉じた処理なので
+  // 他の読み込み処理と並行に行える．
+  lib_ptr->compile(profiler);
 
-  // AstValue の内容をライブラリに設定する．
-  lib_info.set(ast_library->value());
+  profiler.start();
+  lib_ptr->wrap_up();
+  profiler.stop("wrap_up", 0, lib_ptr->cell_num());
 
   auto lib = lib_ptr.get();
   lib_ptr.release();
@@ -0,0 +1,51 @@
+/// @file OperatingConditionsInfo.cc
+/// @brief OperatingConditionsInfo の実装ファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2024 Yusuke Matsunaga
+/// All rights reserved.
+
+#include "dotlib/OperatingConditionsInfo.h"
+#include "dotlib/AstValue.h"
+#include "ci/CiCellLibrary.h"
+
+
+BEGIN_NAMESPACE_YM_DOTLIB
+
+//////////////////////////////////////////////////////////////////////
+// クラス OperatingConditionsInfo
+//////////////////////////////////////////////////////////////////////
+
+// @brief 内容を設定する．
+void
+OperatingConditionsInfo::set(
+  const AstValue* oc_val
+)
+{
+  GroupInfo::set(oc_val);
+
+  auto& header = oc_val->group_header_value();
+  ASSERT_COND( header.complex_elem_size() == 1 );
+  mName = header.complex_elem_value(0).string_value();
+  auto name_str = static_cast<const char*>(mName);
+  if ( library()->operating_conditions(std::string_view{name_str}) != nullptr ) {
+    ostringstream buf;
+    buf << mName << ": Duplicated operating_conditions name";
+    parse_error(buf.str());
+  }
+
+  get_float(AttrKwd::process, mProcess);
+  get_float(AttrKwd::temperature, mTemperature);
+  get_float(AttrKwd::voltage, mVoltage);
+  get_string(AttrKwd::tree_type, mTreeType);
+}
+
+// @brief 動作条件を作る．
+void
+OperatingConditionsInfo::add_operating_conditions() const
+{
+  library()->add_operating_conditions(mName, mProcess, mTemperature,
+				      mVoltage, mTreeType);
+}
+
+END_NAMESPACE_YM_DOTLIB
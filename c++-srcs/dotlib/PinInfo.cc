@@ -51,6 +51,9 @@ PinInfo::set(
     ASSERT_NOT_REACHED;
     break;
   }
+
+  // internal_power は向きに関係なく取り出す．
+  set_internal_power();
 }
 
 BEGIN_NONAMESPACE
@@ -80,6 +83,8 @@ PinInfo::add_pin(
   const unordered_map<ShString, SizeType>& ipin_map
 )
 {
+  mPinList.clear();
+  mPinList.reserve(mNameList.size());
   switch ( mDirection ) {
   case ClibDirection::input:
     for ( auto name: mNameList ) {
@@ -88,6 +93,7 @@ PinInfo::add_pin(
 				 mRiseCapacitance,
 				 mFallCapacitance);
       ASSERT_COND( pin->input_id() == ipin_map.at(name) );
+      mPinList.push_back(pin);
     }
     break;
 
@@ -106,6 +112,7 @@ PinInfo::add_pin(
 				    mFunctionExpr,
 				    mTristateExpr);
 	mOpinList.push_back(pin->output_id());
+	mPinList.push_back(pin);
       }
     }
     break;
@@ -128,6 +135,7 @@ PinInfo::add_pin(
 				   mTristateExpr);
 	ASSERT_COND( pin->input_id() == ipin_map.at(name) );
 	mOpinList.push_back(pin->output_id());
+	mPinList.push_back(pin);
       }
     }
     break;
@@ -163,11 +171,23 @@ PinInfo::add_timing(
   }
 }
 
+// @brief 内部電力を生成する．
+void
+PinInfo::add_internal_power(
+  CiCell* cell,
+  const unordered_map<ShString, SizeType>& ipin_map
+) const
+{
+  for ( auto& ip_info: mInternalPowerInfoList ) {
+    ip_info.add_internal_power(cell, mPinList, ipin_map);
+  }
+}
+
 // @brief direction 属性を取り出す．
 void
 PinInfo::set_direction()
 {
-  const char* keyword{"direction"};
+  AttrKwd keyword{AttrKwd::direction};
   if ( !get_direction(keyword, mDirection) ) {
     // direction 属性がない．
     auto label = "'direction' is missing.";
@@ -179,15 +199,15 @@ PinInfo::set_direction()
 void
 PinInfo::set_input_params()
 {
-  auto ret1 = get_capacitance("capacitance", mCapacitance);
+  auto ret1 = get_capacitance(AttrKwd::capacitance, mCapacitance);
   if ( !ret1 ) {
     // capacitance が定義されていない．
     auto label = "'capacitance' is missing.";
     parse_error(label);
   }
 
-  auto ret2 = get_capacitance("rise_capacitance", mRiseCapacitance);
-  auto ret3 = get_capacitance("fall_capacitance", mFallCapacitance);
+  auto ret2 = get_capacitance(AttrKwd::rise_capacitance, mRiseCapacitance);
+  auto ret3 = get_capacitance(AttrKwd::fall_capacitance, mFallCapacitance);
 
   if ( ret2 && !ret3 ) {
     // fall_capacitance だけが定義されていない．
@@ -208,60 +228,73 @@ PinInfo::set_input_params()
 void
 PinInfo::set_output_params()
 {
-  auto ret1 = get_capacitance("max_fanout", mMaxFanout);
+  auto ret1 = get_capacitance(AttrKwd::max_fanout, mMaxFanout);
   if ( !ret1 ) {
 #warning "TODO: 今は無限大を代入している．要確認"
     mMaxFanout = ClibCapacitance::infinity();
   }
 
-  auto ret2 = get_capacitance("min_fanout", mMinFanout);
+  auto ret2 = get_capacitance(AttrKwd::min_fanout, mMinFanout);
   if ( !ret2 ) {
 #warning "TODO: 今は0を代入している．要確認"
     mMinFanout = ClibCapacitance{0.0};
   }
 
-  auto ret3 = get_capacitance("max_capacitance", mMaxCapacitance);
+  auto ret3 = get_capacitance(AttrKwd::max_capacitance, mMaxCapacitance);
   if ( !ret3 ) {
 #warning "TODO: 今は無限大を代入している．要確認"
     mMaxCapacitance = ClibCapacitance::infinity();
   }
 
-  auto ret4 = get_capacitance("min_capacitance", mMinCapacitance);
+  auto ret4 = get_capacitance(AttrKwd::min_capacitance, mMinCapacitance);
   if ( !ret4 ) {
 #warning "TODO: 今は0を代入している．要確認"
     mMinCapacitance = ClibCapacitance{0.0};
   }
 
-  auto ret5 = get_time("max_transition", mMaxTransition);
+  auto ret5 = get_time(AttrKwd::max_transition, mMaxTransition);
   if ( !ret5 ) {
 #warning "TODO: 今は無限大を代入している．要確認"
     mMaxTransition = ClibTime::infinity();
   }
 
-  auto ret6 = get_time("min_transition", mMinTransition);
+  auto ret6 = get_time(AttrKwd::min_transition, mMinTransition);
   if ( !ret6 ) {
 #warning "TODO: 今は0を代入している．要確認"
     mMinTransition = ClibTime{0.0};
   }
 
-  if ( !get_expr("function", mFunction) ) {
+  if ( !get_expr(AttrKwd::function, mFunction) ) {
     mFunction = nullptr;
   }
 
-  if ( !get_expr("three_state", mTristate) ) {
+  if ( !get_expr(AttrKwd::three_state, mTristate) ) {
     mTristate = nullptr;
   }
 
   mTimingInfoList.clear();
-  if ( elem_dict().count("timing") > 0 ) {
-    auto& vec = elem_dict().at("timing");
-    SizeType n = vec.size();
-    mTimingInfoList.reserve(n);
-    for ( auto& ast_timing: vec ) {
-      mTimingInfoList.push_back(TimingInfo{library_info()});
-      auto& timing_info = mTimingInfoList.back();
-      timing_info.set(ast_timing);
-    }
+  auto vec = elem_list(AttrKwd::timing);
+  SizeType n = vec.size();
+  mTimingInfoList.reserve(n);
+  for ( auto ast_timing: vec ) {
+    mTimingInfoList.push_back(TimingInfo{library_info()});
+    auto& timing_info = mTimingInfoList.back();
+    timing_info.set(ast_timing);
+  }
+}
+
+// @brief internal_power グループの情報を取り出す．
+void
+PinInfo::set_internal_power()
+{
+  mInternalPowerInfoList.clear();
+  auto vec = elem_list(AttrKwd::internal_power);
+  SizeType n = vec.size();
+  mInternalPowerInfoList.reserve(n);
+  for ( auto ast_ip: vec ) {
+    mInternalPowerInfoList.push_back(InternalPowerInfo{library_info()});
+    auto& ip_info = mInternalPowerInfoList.back();
+    ip_info.set(ast_ip);
   }
 }
 
@@ -41,15 +41,15 @@ TableInfo::set(
     parse_error(label);
   }
 
-  get_complex_float_vector("index_1", mIndex1);
+  get_complex_float_vector(AttrKwd::index_1, mIndex1);
 
-  get_complex_float_vector("index_2", mIndex2);
+  get_complex_float_vector(AttrKwd::index_2, mIndex2);
 
-  get_complex_float_vector("index_3", mIndex3);
+  get_complex_float_vector(AttrKwd::index_3, mIndex3);
 
-  get_complex_float_vector("values", mValues);
+  get_complex_float_vector(AttrKwd::values, mValues);
 
-  mDomain = get_value("domain");
+  mDomain = get_value(AttrKwd::domain);
 }
 
 // @brief 標準タイプの時 true を返す．
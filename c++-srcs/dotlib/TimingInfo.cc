@@ -285,25 +285,25 @@ TimingInfo::add_timing(
 void
 TimingInfo::set_common_params()
 {
-  if ( !get_timing_type("timing_type", mTimingType) ) {
+  if ( !get_timing_type(AttrKwd::timing_type, mTimingType) ) {
     // 省略時は combinational を指定する．要確認
     mTimingType = ClibTimingType::combinational;
   }
 
-  if ( !get_expr("when", mWhen) ) {
+  if ( !get_expr(AttrKwd::when, mWhen) ) {
     mWhen = nullptr;
   }
 
-  if ( !get_timing_sense("timing_sense", mTimingSense) ) {
+  if ( !get_timing_sense(AttrKwd::timing_sense, mTimingSense) ) {
     mTimingSense = ClibTimingSense::none;
   }
 
-  const char* keyword{"related_pin"};
-  if ( elem_dict().count(keyword) == 0 ) {
+  AttrKwd keyword{AttrKwd::related_pin};
+  auto vec = elem_list(keyword);
+  if ( vec.empty() ) {
     auto label = "'related_pin' is missing.";
     parse_error(label);
   }
-  auto& vec = elem_dict().at(keyword);
   mRelatedPin.clear();
   mRelatedPin.reserve(vec.size());
   for ( auto v: vec ) {
@@ -316,19 +316,19 @@ TimingInfo::set_common_params()
 void
 TimingInfo::set_gp_common_params()
 {
-  if ( !get_time("intrinsic_rise", mIntrinsicRise) ) {
+  if ( !get_time(AttrKwd::intrinsic_rise, mIntrinsicRise) ) {
     auto label = "'intrinsic_rise' is missing.";
     parse_error(label);
   }
-  if ( !get_time("intrinsic_fall", mIntrinsicFall) ) {
+  if ( !get_time(AttrKwd::intrinsic_fall, mIntrinsicFall) ) {
     auto label = "'intrinsic_fall' is missing.";
     parse_error(label);
   }
-  if ( !get_time("slope_rise", mSlopeRise) ) {
+  if ( !get_time(AttrKwd::slope_rise, mSlopeRise) ) {
     auto label = "'slope_rise' is missing.";
     parse_error(label);
   }
-  if ( !get_time("slope_fall", mSlopeFall) ) {
+  if ( !get_time(AttrKwd::slope_fall, mSlopeFall) ) {
     auto label = "'slope_fall' is missing.";
     parse_error(label);
   }
@@ -339,11 +339,11 @@ void
 TimingInfo::set_generic_params()
 {
   set_gp_common_params();
-  if ( !get_resistance("rise_resistance", mRiseResistance) ) {
+  if ( !get_resistance(AttrKwd::rise_resistance, mRiseResistance) ) {
     auto label = "'rise_resistance' is missing.";
     parse_error(label);
   }
-  if ( !get_resistance("fall_resistance", mFallResistance) ) {
+  if ( !get_resistance(AttrKwd::fall_resistance, mFallResistance) ) {
     auto label = "'fall_resistance' is missing.";
     parse_error(label);
   }
@@ -380,27 +380,27 @@ TimingInfo::set_piecewise_params()
   set_gp_common_params();
 
   SizeType piece_num = library()->piece_define().size();
-  set_param_list(extract_piecewise_params("rise_pin_resistance"),
+  set_param_list(extract_piecewise_params(AttrKwd::rise_pin_resistance),
 		 piece_num, mRisePinResistance);
-  set_param_list(extract_piecewise_params("fall_pin_resistance"),
+  set_param_list(extract_piecewise_params(AttrKwd::fall_pin_resistance),
 		 piece_num, mFallPinResistance);
-  set_param_list(extract_piecewise_params("rise_delay_intercept"),
+  set_param_list(extract_piecewise_params(AttrKwd::rise_delay_intercept),
 		 piece_num, mRiseDelayIntercept);
-  set_param_list(extract_piecewise_params("fall_delay_intercept"),
+  set_param_list(extract_piecewise_params(AttrKwd::fall_delay_intercept),
 		 piece_num, mFallDelayIntercept);
 }
 
 // @brief piecewise_cmos タイプのパラメータ の値を取り出す．
 vector<pair<SizeType, double>>
 TimingInfo::extract_piecewise_params(
-  const char* keyword
+  AttrKwd keyword
 )
 {
   vector<pair<SizeType, double>> tmp_list;
-  if ( elem_dict().count(keyword) > 0 ) {
-    auto& elem_list = elem_dict().at(keyword);
-    tmp_list.reserve(elem_list.size());
-    for ( auto elem: elem_list ) {
+  auto vec = elem_list(keyword);
+  if ( !vec.empty() ) {
+    tmp_list.reserve(vec.size());
+    for ( auto elem: vec ) {
       auto pid = static_cast<SizeType>(elem->complex_elem_value(0).int_value());
       auto val = elem->complex_elem_value(1).float_value();
       tmp_list.push_back(make_pair(pid, val));
@@ -419,8 +419,8 @@ int
 TimingInfo::set_table_lookup_params()
 {
   bool standard = false;
-  auto rt_val = get_value("rise_transition");
-  auto ft_val = get_value("fall_transition");
+  auto rt_val = get_value(AttrKwd::rise_transition);
+  auto ft_val = get_value(AttrKwd::fall_transition);
   if ( rt_val == nullptr && ft_val == nullptr ) {
     // rise|fall_transition のどちらかは必須
     auto label = ": Neigther 'rise_transition' nor 'fall_transition' is not defined.";
@@ -440,11 +440,11 @@ TimingInfo::set_table_lookup_params()
     }
   }
 
-  auto cr_val = get_value("cell_rise");
-  auto cf_val = get_value("cell_fall");
+  auto cr_val = get_value(AttrKwd::cell_rise);
+  auto cf_val = get_value(AttrKwd::cell_fall);
 
-  auto rp_val = get_value("rise_propagation");
-  auto fp_val = get_value("fall_propagation");
+  auto rp_val = get_value(AttrKwd::rise_propagation);
+  auto fp_val = get_value(AttrKwd::fall_propagation);
 
   int type = 0;
   if ( cr_val ) {
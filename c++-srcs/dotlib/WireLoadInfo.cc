@@ -0,0 +1,108 @@
+/// @file WireLoadInfo.cc
+/// @brief WireLoadInfo の実装ファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2024 Yusuke Matsunaga
+/// All rights reserved.
+
+#include "dotlib/WireLoadInfo.h"
+#include "dotlib/AstValue.h"
+#include "ci/CiCellLibrary.h"
+
+
+BEGIN_NAMESPACE_YM_DOTLIB
+
+//////////////////////////////////////////////////////////////////////
+// クラス WireLoadInfo
+//////////////////////////////////////////////////////////////////////
+
+// @brief wire_load グループの内容を設定する．
+void
+WireLoadInfo::set_wire_load(
+  const AstValue* wl_val
+)
+{
+  GroupInfo::set(wl_val);
+  set_name(wl_val);
+
+  mIsTable = false;
+  get_float(AttrKwd::resistance, mResistance);
+  get_float(AttrKwd::capacitance, mCapacitance);
+  get_float(AttrKwd::area, mArea);
+  get_float(AttrKwd::slope, mSlope);
+  mFanoutLengthList = get_fanout_list(AttrKwd::fanout_length);
+}
+
+// @brief wire_load_table グループの内容を設定する．
+void
+WireLoadInfo::set_wire_load_table(
+  const AstValue* wl_val
+)
+{
+  GroupInfo::set(wl_val);
+  set_name(wl_val);
+
+  mIsTable = true;
+  mFanoutLengthList = get_fanout_list(AttrKwd::fanout_length);
+  mFanoutCapacitanceList = get_fanout_list(AttrKwd::fanout_capacitance);
+  mFanoutResistanceList = get_fanout_list(AttrKwd::fanout_resistance);
+  mFanoutAreaList = get_fanout_list(AttrKwd::fanout_area);
+}
+
+// @brief ワイヤーロードを作る．
+void
+WireLoadInfo::add_wire_load() const
+{
+  if ( mIsTable ) {
+    library()->add_wire_load_table(mName,
+				   mFanoutLengthList,
+				   mFanoutCapacitanceList,
+				   mFanoutResistanceList,
+				   mFanoutAreaList);
+  }
+  else {
+    library()->add_wire_load(mName, mResistance, mCapacitance,
+			     mArea, mSlope, mFanoutLengthList);
+  }
+}
+
+// @brief 名前を設定する．
+void
+WireLoadInfo::set_name(
+  const AstValue* wl_val
+)
+{
+  auto& header = wl_val->group_header_value();
+  ASSERT_COND( header.complex_elem_size() == 1 );
+  mName = header.complex_elem_value(0).string_value();
+  auto name_str = static_cast<const char*>(mName);
+  if ( library()->wire_load(std::string_view{name_str}) != nullptr ) {
+    ostringstream buf;
+    buf << mName << ": Duplicated wire_load name";
+    parse_error(buf.str());
+  }
+}
+
+// @brief (ファンアウト数, 値) のリストを取り出す．
+vector<pair<SizeType, double>>
+WireLoadInfo::get_fanout_list(
+  AttrKwd keyword
+) const
+{
+  // fanout_length は wire_load の場合は5つまで値を持つが
+  // 3番目以降(average_capacitance など)は用いない．
+  vector<pair<SizeType, double>> ans_list;
+  for ( auto val: elem_list(keyword) ) {
+    ASSERT_COND( val->complex_elem_size() >= 2 );
+    auto fanout = val->complex_elem_value(0).int_value();
+    if ( fanout < 0 ) {
+      auto label = "fanout should be a non-negative integer.";
+      parse_error(label);
+    }
+    auto value = val->complex_elem_value(1).float_value();
+    ans_list.push_back({static_cast<SizeType>(fanout), value});
+  }
+  return ans_list;
+}
+
+END_NAMESPACE_YM_DOTLIB
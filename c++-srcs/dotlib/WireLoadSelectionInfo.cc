@@ -0,0 +1,58 @@
+/// @file WireLoadSelectionInfo.cc
+/// @brief WireLoadSelectionInfo の実装ファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2024 Yusuke Matsunaga
+/// All rights reserved.
+
+#include "dotlib/WireLoadSelectionInfo.h"
+#include "dotlib/AstValue.h"
+#include "ci/CiCellLibrary.h"
+
+
+BEGIN_NAMESPACE_YM_DOTLIB
+
+//////////////////////////////////////////////////////////////////////
+// クラス WireLoadSelectionInfo
+//////////////////////////////////////////////////////////////////////
+
+// @brief 内容を設定する．
+void
+WireLoadSelectionInfo::set(
+  const AstValue* sel_val
+)
+{
+  GroupInfo::set(sel_val);
+
+  // 名前は省略可能
+  mName = ShString{};
+  auto& header = sel_val->group_header_value();
+  if ( header.complex_elem_size() > 0 ) {
+    mName = header.complex_elem_value(0).string_value();
+  }
+
+  mEntryList.clear();
+  for ( auto val: elem_list(AttrKwd::wire_load_from_area) ) {
+    ASSERT_COND( val->complex_elem_size() == 3 );
+    auto min_area = val->complex_elem_value(0).float_value();
+    auto max_area = val->complex_elem_value(1).float_value();
+    auto wl_name = val->complex_elem_value(2).string_value();
+    auto name_str = static_cast<const char*>(wl_name);
+    auto wl = library()->wire_load(std::string_view{name_str});
+    if ( wl == nullptr ) {
+      ostringstream buf;
+      buf << wl_name << ": No such wire_load";
+      parse_error(buf.str());
+    }
+    mEntryList.push_back({min_area, max_area, wl});
+  }
+}
+
+// @brief ワイヤーロードセレクションを作る．
+void
+WireLoadSelectionInfo::add_wire_load_selection() const
+{
+  library()->add_wire_load_selection(mName, mEntryList);
+}
+
+END_NAMESPACE_YM_DOTLIB
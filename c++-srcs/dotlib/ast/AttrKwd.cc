@@ -0,0 +1,59 @@
+/// @file AttrKwd.cc
+/// @brief AttrKwd の実装ファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2024 Yusuke Matsunaga
+/// All rights reserved.
+
+#include "dotlib/AttrKwd.h"
+
+
+BEGIN_NAMESPACE_YM_DOTLIB
+
+BEGIN_NONAMESPACE
+
+// 属性名の表
+const char* kwd_str_table[] = {
+#define ATTR_KWD(id, str) str,
+#include "dotlib/AttrKwd_list.h"
+#undef ATTR_KWD
+};
+
+END_NONAMESPACE
+
+// @brief 属性名から AttrKwd を得る．
+AttrKwd
+attr_kwd(
+  const string& kwd
+)
+{
+  // 最初に呼ばれた時に一度だけ作られ，その後は参照のみとなる．
+  static const unordered_map<string, AttrKwd> kwd_dict = []() {
+    unordered_map<string, AttrKwd> dict;
+    for ( SizeType i = 0; i < ATTR_KWD_NUM; ++ i ) {
+      dict.emplace(kwd_str_table[i], static_cast<AttrKwd>(i));
+    }
+    return dict;
+  }();
+
+  auto p = kwd_dict.find(kwd);
+  if ( p == kwd_dict.end() ) {
+    return AttrKwd::none;
+  }
+  return p->second;
+}
+
+// @brief AttrKwd の属性名を返す．
+const char*
+attr_kwd_str(
+  AttrKwd kwd
+)
+{
+  auto i = static_cast<SizeType>(kwd);
+  if ( i >= ATTR_KWD_NUM ) {
+    return "";
+  }
+  return kwd_str_table[i];
+}
+
+END_NAMESPACE_YM_DOTLIB
@@ -0,0 +1,47 @@
+/// @file AttrKwdTest.cc
+/// @brief AttrKwdTest の実装ファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2024 Yusuke Matsunaga
+/// All rights reserved.
+
+#include "gtest/gtest.h"
+#include "dotlib/AttrKwd.h"
+#include "dotlib/AstAttr.h"
+
+
+BEGIN_NAMESPACE_YM_DOTLIB
+
+TEST(AttrKwdTest, attr_kwd)
+{
+  EXPECT_EQ( AttrKwd::library, attr_kwd("library") );
+  EXPECT_EQ( AttrKwd::timing, attr_kwd("timing") );
+  EXPECT_EQ( AttrKwd::related_pin, attr_kwd("related_pin") );
+  EXPECT_EQ( AttrKwd::short_, attr_kwd("short") );
+  EXPECT_EQ( AttrKwd::none, attr_kwd("no_such_attribute") );
+  EXPECT_EQ( AttrKwd::none, attr_kwd("") );
+}
+
+TEST(AttrKwdTest, attr_kwd_str)
+{
+  for ( SizeType i = 0; i < ATTR_KWD_NUM; ++ i ) {
+    auto kwd = static_cast<AttrKwd>(i);
+    auto str = attr_kwd_str(kwd);
+    EXPECT_EQ( kwd, attr_kwd(str) );
+  }
+  EXPECT_STREQ( "short", attr_kwd_str(AttrKwd::short_) );
+  EXPECT_STREQ( "", attr_kwd_str(AttrKwd::none) );
+}
+
+TEST(AttrKwdTest, AstAttr)
+{
+  FileRegion loc; // ダミー
+  AstAttr attr1{"cell_rise", loc, nullptr};
+  EXPECT_EQ( AttrKwd::cell_rise, attr1.kwd_id() );
+
+  AstAttr attr2{"unknown_attr", loc, nullptr};
+  EXPECT_EQ( AttrKwd::none, attr2.kwd_id() );
+  EXPECT_EQ( "unknown_attr", attr2.kwd() );
+}
+
+END_NAMESPACE_YM_DOTLIB
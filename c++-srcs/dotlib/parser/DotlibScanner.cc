@@ -40,6 +40,7 @@ DotlibScanner::peek_token()
   if ( mCurToken.type() == TokenType::ERROR ) {
     auto type = _scan();
     mCurToken = {type, cur_region(), ShString(mCurString)};
+    ++ mTokenNum;
   }
   return mCurToken;
 }
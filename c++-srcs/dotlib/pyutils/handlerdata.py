@@ -12,6 +12,10 @@ import itertools
 import sys
 
 
+# 属性名のうち C++ の識別子として使えないもの
+cpp_reserved_words = set(['short'])
+
+
 def expand(pat):
     """パタンを解析して展開する"""
 
@@ -285,6 +289,19 @@ END_NAMESPACE_YM_DOTLIB
         for key, handler in self._handler_dict.items():
             fout.write('  {{ "{0}", {1} }},\n'.format(key, handler))
 
+    def print_kwd_list(self, *, fout=sys.stdout):
+        # 属性名のリストを ATTR_KWD(識別子, 属性名) の形で出力する．
+        # 先頭の 'library' はどのグループの要素にもならないので別に加える．
+        kwd_set = set(['library'])
+        for key in self._handler_dict.keys():
+            _, kwd = key.split(':', 1)
+            kwd_set.add(kwd)
+        for kwd in sorted(kwd_set):
+            name = kwd
+            if name in cpp_reserved_words:
+                name += '_'
+            fout.write('ATTR_KWD({0}, "{1}")\n'.format(name, kwd))
+
     def dump(self):
         for key, handler in self._handler_dict.items():
             print(key, handler)
@@ -4,7 +4,7 @@
 パーサーの記述を生成するスクリプト
 
 使い方:
-  parse_gen -f parse_group.h -d Parser_dict.cc
+  parse_gen -f parse_group.h -d Parser_dict.cc -k AttrKwd_list.h
 
 データの定義:
   HandlerData のインスタンスに必要なデータを定義してゆく．
@@ -51,6 +51,8 @@ parser.add_argument('-f', '--write-functions', help="write functions' definition
                     nargs=1, metavar='FILENAME')
 parser.add_argument('-d', '--write-dict', help="write dict's entries to 'FILENAME'",
                     nargs=1, metavar='FILENAME')
+parser.add_argument('-k', '--write-kwd-list', help="write keyword list to 'FILENAME'",
+                    nargs=1, metavar='FILENAME')
 
 args = parser.parse_args()
 if not args:
@@ -82,3 +84,8 @@ if args.write_dict:
     filename, = args.write_dict
     with open(filename, 'wt', encoding='utf_8_sig') as fout:
         hd.print_dict(fout=fout)
+
+if args.write_kwd_list:
+    filename, = args.write_kwd_list
+    with open(filename, 'wt', encoding='utf_8_sig') as fout:
+        hd.print_kwd_list(fout=fout)
@@ -126,13 +126,15 @@ ExprDfs::scan_sub(
 // @brief mislib 形式のファイルを読み込んでセルライブラリを作る．
 unique_ptr<CiCellLibrary>
 MislibConv::convert(
-  const string& filename
+  const string& filename,
+  const ClibPatGenParam& param
 )
 {
   MislibParser parser;
   auto gate_list = parser.parse(filename);
 
   mLibrary = unique_ptr<CiCellLibrary>{new CiCellLibrary{}};
+  mLibrary->set_pg_param(param);
 
   // ファイル名をライブラリ名として登録する．
   auto name = filename.substr(filename.find_last_of('/') + 1);
@@ -354,11 +356,15 @@ BEGIN_NAMESPACE_YM_CLIB
 // @brief mislib 形式のファイルを読み込む．
 CiCellLibrary*
 CiCellLibrary::read_mislib(
-  const string& filename
+  const string& filename,
+  const ClibPatGenParam& param
 )
 {
+  // ShString と MsgMgr を用いるので他の読み込み処理と排他制御する．
+  std::lock_guard<std::mutex> lock{reader_mutex()};
+
   nsMislib::MislibConv conv;
-  auto lib_ptr = conv.convert(filename);
+  auto lib_ptr = conv.convert(filename, param);
   auto lib = lib_ptr.get();
   lib_ptr.release();
   return lib;
@@ -38,7 +38,8 @@ public:
   /// @brief mislib 形式のファイルを読み込んでセルライブラリを作る．
   unique_ptr<CiCellLibrary>
   convert(
-    const string& filename ///< [in] ファイル名
+    const string& filename,      ///< [in] ファイル名
+    const ClibPatGenParam& param ///< [in] パタングラフ生成の制限値
   );
 
 
@@ -5,7 +5,7 @@
 /// @brief PyClibLut のヘッダファイル
 /// @author Yusuke Matsunaga (松永 裕介)
 ///
-/// Copyright (C) 2023 Yusuke Matsunaga
+/// Copyright (C) 2024 Yusuke Matsunaga
 /// All rights reserved.
 
 #define PY_SSIZE_T_CLEAN
@@ -14,13 +14,17 @@
 #include "ym/ClibLut.h"
 
 
-BEGIN_NAMESPACE_YM_CLIB
+BEGIN_NAMESPACE_YM
 
 //////////////////////////////////////////////////////////////////////
 /// @class PyClibLut PyClibLut.h "PyClibLut.h"
 /// @brief Python 用の ClibLut 拡張
 ///
 /// 複数の関数をひとまとめにしているだけなので実は名前空間として用いている．
+///
+/// ClibLut オブジェクトはバッファプロトコルをサポートしており，
+/// memoryview() や numpy.asarray() で格子点の値の配列を
+/// コピーなしで参照することができる．
 //////////////////////////////////////////////////////////////////////
 class PyClibLut
 {
@@ -41,10 +45,11 @@ public:
   /// @return 生成した PyObject を返す．
   ///
   /// 返り値は新しい参照が返される．
+  /// val が不正値の場合には None を返す．
   static
   PyObject*
   ToPyObject(
-    ClibLut val ///< [in] 値
+    const ClibLut& val ///< [in] 値
   );
 
   /// @brief PyObject が ClibLut タイプか調べる．
@@ -71,6 +76,6 @@ public:
 
 };
 
-END_NAMESPACE_YM_CLIB
+END_NAMESPACE_YM
 
-#endif // PYCLIBCELL_H
+#endif // PYCLIBLUT_H
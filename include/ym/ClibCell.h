@@ -13,6 +13,7 @@
 #include "ym/ClibArea.h"
 #include "ym/ClibList2.h"
 #include "ym/logic.h"
+#include <string_view>
 
 
 BEGIN_NAMESPACE_YM_CLIB
@@ -93,7 +94,16 @@ public:
   /// なければ不正値を返す．
   ClibPin
   pin(
-    const string& name ///< [in] ピン名
+    std::string_view name ///< [in] ピン名
+  ) const;
+
+  /// @brief 名前のリストからピン番号のリストを得る．
+  /// @return name_list の各要素に対応するピン番号のリストを返す．
+  ///
+  /// 該当するピンがない要素には CLIB_NULLID が入る．
+  vector<SizeType>
+  pin_id_list(
+    const vector<string>& name_list ///< [in] ピン名のリスト
   ) const;
 
   /// @brief ピンのリストを返す．
@@ -254,6 +264,98 @@ public:
   //////////////////////////////////////////////////////////////////////
 
 
+public:
+  //////////////////////////////////////////////////////////////////////
+  /// @name 電力情報の取得
+  /// @{
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief 内部電力の数を返す．
+  SizeType
+  internal_power_num() const;
+
+  /// @brief 内部電力を返す．
+  ClibInternalPower
+  internal_power(
+    SizeType pos ///< [in] 位置番号 ( 0 <= pos < internal_power_num() )
+  ) const;
+
+  /// @brief 内部電力のリストを返す．
+  ClibInternalPowerList
+  internal_power_list() const;
+
+  /// @brief セル全体のリーク電力(cell_leakage_power)を返す．
+  ///
+  /// 指定されていない場合は 0.0 を返す．
+  double
+  cell_leakage_power() const;
+
+  /// @brief 条件付きのリーク電力(leakage_power)の数を返す．
+  SizeType
+  leakage_power_num() const;
+
+  /// @brief 条件付きのリーク電力の条件式を返す．
+  ///
+  /// 条件がない場合には定数1の式を返す．
+  Expr
+  leakage_power_when(
+    SizeType pos ///< [in] 位置番号 ( 0 <= pos < leakage_power_num() )
+  ) const;
+
+  /// @brief 条件付きのリーク電力の値を返す．
+  double
+  leakage_power_value(
+    SizeType pos ///< [in] 位置番号 ( 0 <= pos < leakage_power_num() )
+  ) const;
+
+  /// @brief リーク電力の評価に用いる入力数を返す．
+  ///
+  /// 通常は input2_num() と等しいが，leakage_power の条件式が
+  /// 内部状態変数を参照している場合にはそれを含む．
+  SizeType
+  leakage_input_num() const;
+
+  /// @brief 条件付きのリーク電力の条件式を真理値表のビットマスクで返す．
+  ///
+  /// 入力状態 m が条件を満たす時，
+  /// m / 64 番目のワードの m % 64 番目のビットが1となる．
+  /// 入力数が多すぎて真理値表を作れない場合は
+  /// std::invalid_argument 例外を送出する．
+  vector<std::uint64_t>
+  leakage_power_when_mask(
+    SizeType pos ///< [in] 位置番号 ( 0 <= pos < leakage_power_num() )
+  ) const;
+
+  /// @brief 入力状態に対するリーク電力を返す．
+  ///
+  /// state の i 番目のビットが i 番目の入力の値を表す．
+  /// leakage_input_num() 以上のビットは無視される．
+  /// どの条件にも合致しない状態には cell_leakage_power() の値を用いる．
+  double
+  calc_leakage_power(
+    std::uint64_t state ///< [in] 入力状態
+  ) const;
+
+  /// @brief 入力状態のリストに対するリーク電力のリストを返す．
+  vector<double>
+  calc_leakage_power_list(
+    const vector<std::uint64_t>& state_list ///< [in] 入力状態のリスト
+  ) const;
+
+  /// @brief 入力の信号確率に対するリーク電力の期待値を返す．
+  ///
+  /// 各入力は独立と仮定する．
+  /// prob_list のサイズは leakage_input_num() と等しくなければならない．
+  double
+  calc_average_leakage_power(
+    const vector<double>& prob_list ///< [in] 各入力が1となる確率のリスト
+  ) const;
+
+  //////////////////////////////////////////////////////////////////////
+  /// @}
+  //////////////////////////////////////////////////////////////////////
+
+
 public:
   //////////////////////////////////////////////////////////////////////
   /// @name 機能情報の取得
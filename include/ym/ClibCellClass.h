@@ -87,6 +87,56 @@ public:
   ClibCellGroupList
   cell_group_list() const;
 
+  /// @brief 全グループのセル数の総和を返す．
+  SizeType
+  cell_num() const;
+
+  //////////////////////////////////////////////////////////////////////
+  /// @}
+  //////////////////////////////////////////////////////////////////////
+
+
+public:
+  //////////////////////////////////////////////////////////////////////
+  /// @name セルを並べたリストに関する関数
+  /// @{
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief 指定された基準で昇順に並べたセルのリストを返す．
+  ///
+  /// このクラスに属する全てのグループのセルが対象となる．
+  ClibCellList
+  sorted_cell_list(
+    ClibCellOrder order ///< [in] 並べる基準
+  ) const;
+
+  /// @brief 指定された基準で昇順に並べた時の pos 番目のセルを返す．
+  ///
+  /// sorted_cell_list() と異なりリストのコピーを作らない．
+  ClibCell
+  sorted_cell(
+    ClibCellOrder order, ///< [in] 並べる基準
+    SizeType pos         ///< [in] 位置 ( 0 <= pos < cell_num() )
+  ) const;
+
+  /// @brief 指定された基準で一つ後ろ(値の大きい方)のセルを返す．
+  ///
+  /// cell が最後の場合は不正値を返す．
+  ClibCell
+  next_cell(
+    const ClibCell& cell, ///< [in] 基準となるセル
+    ClibCellOrder order   ///< [in] 並べる基準
+  ) const;
+
+  /// @brief 指定された基準で一つ前(値の小さい方)のセルを返す．
+  ///
+  /// cell が先頭の場合は不正値を返す．
+  ClibCell
+  prev_cell(
+    const ClibCell& cell, ///< [in] 基準となるセル
+    ClibCellOrder order   ///< [in] 並べる基準
+  ) const;
+
   //////////////////////////////////////////////////////////////////////
   /// @}
   //////////////////////////////////////////////////////////////////////
@@ -12,6 +12,10 @@
 #include "ym/logic.h"
 #include "ym/ClibLibraryPtr.h"
 #include "ym/ClibList.h"
+#include "ym/ClibPatGenParam.h"
+#include "ym/ClibLoadProfile.h"
+#include "ym/ClibDiff.h"
+#include <string_view>
 
 
 BEGIN_NAMESPACE_YM_CLIB
@@ -71,22 +75,78 @@ public:
   /// @return 生成したライブラリを返す．
   ///
   /// 読み込みが失敗した場合は std::invalid_argument 例外を送出する．
+  /// param でパタングラフ生成の制限値を指定できる．
   static
   ClibCellLibrary
   read_mislib(
-    const string& filename ///< [in] ファイル名
+    const string& filename,                          ///< [in] ファイル名
+    const ClibPatGenParam& param = ClibPatGenParam{} ///< [in] パタングラフ生成の制限値
   );
 
   /// @brief liberty 形式のファイルを読み込む．
   /// @return 生成したライブラリを返す．
   ///
   /// 読み込みが失敗した場合は std::invalid_argumnet 例外を送出する．
+  /// param でパタングラフ生成の制限値を指定できる．
+  ///
+  /// 環境変数 YMCELL_LOAD_PROFILE が設定されている場合には
+  /// 各フェーズの計測結果をそのファイルに JSON 形式で追記する．
+  /// 詳しくは ClibLoadProfile を参照のこと．
+  static
+  ClibCellLibrary
+  read_liberty(
+    const string& filename,                          ///< [in] ファイル名
+    const ClibPatGenParam& param = ClibPatGenParam{} ///< [in] パタングラフ生成の制限値
+  );
+
+  /// @brief liberty 形式のファイルを読み込んで各フェーズを計測する．
+  /// @return 生成したライブラリを返す．
+  ///
+  /// 計測結果は profile に格納される．
+  /// 計測時にはフェーズの時間を分けるためにファイル全体を先に
+  /// メモリに読み込み，パタングラフもこの時点で生成する．
+  /// 読み込みが失敗した場合は std::invalid_argumnet 例外を送出する．
   static
   ClibCellLibrary
   read_liberty(
-    const string& filename ///< [in] ファイル名
+    const string& filename,       ///< [in] ファイル名
+    const ClibPatGenParam& param, ///< [in] パタングラフ生成の制限値
+    ClibLoadProfile& profile      ///< [out] 計測結果
   );
 
+  /// @brief 複数の liberty 形式のファイルをそれぞれ別のライブラリとして読み込む．
+  /// @return filename_list と同じ順番で生成したライブラリのリストを返す．
+  ///
+  /// 各ファイルは最大 thread_num 個のスレッドで並行して読み込まれる．
+  /// thread_num が 0 の場合はハードウェアのスレッド数を用いる．
+  /// ただし ShString の文字列プールと MsgMgr がスレッドセーフではないので
+  /// 構文解析とセルの生成は排他制御されて一つずつ行われる．
+  /// ファイルの読み込みとセルグループ/セルクラスの設定などの
+  /// 最終処理は並行して行われる．
+  /// どれか一つでも読み込みが失敗した場合は，失敗したファイルのうち
+  /// 先頭のものについて read_liberty() の送出した例外をそのまま送出する．
+  static
+  vector<ClibCellLibrary>
+  read_liberty_many(
+    const vector<string>& filename_list,              ///< [in] ファイル名のリスト
+    const ClibPatGenParam& param = ClibPatGenParam{}, ///< [in] パタングラフ生成の制限値
+    SizeType thread_num = 0                           ///< [in] スレッド数
+  );
+
+  /// @brief 指定されたセルのみを含む部分ライブラリを作る．
+  /// @return 生成したライブラリを返す．
+  ///
+  /// ライブラリの属性はそのまま引き継ぐ．
+  /// LUTテンプレートとバスタイプは残ったセルから参照されているもののみ
+  /// をコピーする．
+  /// セルグループ/セルクラスとパタングラフは残ったセルのみで作り直す．
+  /// 重複した名前は無視する．
+  /// 存在しない名前が含まれていた場合は std::invalid_argument 例外を送出する．
+  ClibCellLibrary
+  subset(
+    const vector<string>& cell_names ///< [in] 残すセル名のリスト
+  ) const;
+
   //////////////////////////////////////////////////////////////////////
   /// @}
   //////////////////////////////////////////////////////////////////////
@@ -206,6 +266,139 @@ public:
   //////////////////////////////////////////////////////////////////////
 
 
+public:
+  //////////////////////////////////////////////////////////////////////
+  /// @name ワイヤーロード関係の情報の取得
+  /// @{
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief ワイヤーロード数の取得
+  ///
+  /// wire_load と wire_load_table の両方を含む．
+  SizeType
+  wire_load_num() const;
+
+  /// @brief ワイヤーロードの取得
+  ClibWireLoad
+  wire_load(
+    SizeType id ///< [in] 番号 ( 0 <= id < wire_load_num() )
+  ) const;
+
+  /// @brief 名前からワイヤーロードを取得する．
+  ///
+  /// なければ不正値を返す．
+  ClibWireLoad
+  wire_load(
+    std::string_view name ///< [in] 名前
+  ) const;
+
+  /// @brief デフォルトのワイヤーロードを返す．
+  ///
+  /// 'default_wire_load' が指定されていなければ不正値を返す．
+  ClibWireLoad
+  default_wire_load() const;
+
+  /// @brief 面積からワイヤーロードを選ぶ．
+  ///
+  /// 'default_wire_load_selection' で指定されたワイヤーロードセレクション
+  /// (指定がなくワイヤーロードセレクションが一つの場合はそれ)を用いる．
+  /// 該当するものがない場合は default_wire_load() を返す．
+  ClibWireLoad
+  select_wire_load(
+    double area ///< [in] 面積
+  ) const;
+
+  /// @brief 指定したワイヤーロードセレクションを用いてワイヤーロードを選ぶ．
+  ///
+  /// 該当するものがない場合は不正値を返す．
+  /// selection_name のワイヤーロードセレクションがない場合は
+  /// std::invalid_argument 例外を送出する．
+  ClibWireLoad
+  select_wire_load(
+    double area,                    ///< [in] 面積
+    std::string_view selection_name ///< [in] ワイヤーロードセレクション名
+  ) const;
+
+  /// @brief ワイヤーロードセレクション数の取得
+  SizeType
+  wire_load_selection_num() const;
+
+  /// @brief 'default_wire_load_mode' の取得
+  string
+  default_wire_load_mode() const;
+
+  /// @brief 'default_wire_load_area' の取得
+  double
+  default_wire_load_area() const;
+
+  /// @brief 'default_wire_load_capacitance' の取得
+  double
+  default_wire_load_capacitance() const;
+
+  /// @brief 'default_wire_load_resistance' の取得
+  double
+  default_wire_load_resistance() const;
+
+  //////////////////////////////////////////////////////////////////////
+  /// @}
+  //////////////////////////////////////////////////////////////////////
+
+
+public:
+  //////////////////////////////////////////////////////////////////////
+  /// @name 動作条件関係の情報の取得
+  /// @{
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief 'nom_process' の取得
+  double
+  nom_process() const;
+
+  /// @brief 'nom_temperature' の取得
+  double
+  nom_temperature() const;
+
+  /// @brief 'nom_voltage' の取得
+  double
+  nom_voltage() const;
+
+  /// @brief k_process_XXX/k_temp_XXX/k_volt_XXX の値を返す．
+  ///
+  /// 指定されていない場合は 0.0 を返す．
+  double
+  k_factor(
+    const string& name ///< [in] 属性名 ( "k_process_cell_rise" など )
+  ) const;
+
+  /// @brief 動作条件数の取得
+  SizeType
+  operating_conditions_num() const;
+
+  /// @brief 動作条件の取得
+  ClibOperatingConditions
+  operating_conditions(
+    SizeType id ///< [in] 番号 ( 0 <= id < operating_conditions_num() )
+  ) const;
+
+  /// @brief 名前から動作条件を取得する．
+  ///
+  /// なければ不正値を返す．
+  ClibOperatingConditions
+  operating_conditions(
+    std::string_view name ///< [in] 名前
+  ) const;
+
+  /// @brief デフォルトの動作条件を返す．
+  ///
+  /// 'default_operating_conditions' が指定されていなければ不正値を返す．
+  ClibOperatingConditions
+  default_operating_conditions() const;
+
+  //////////////////////////////////////////////////////////////////////
+  /// @}
+  //////////////////////////////////////////////////////////////////////
+
+
 public:
   //////////////////////////////////////////////////////////////////////
   /// @name セル情報の取得
@@ -227,15 +420,24 @@ public:
   /// @return セルを返す．
   ///
   /// なければ不正値を返す．
+  /// 見つからなかった名前が文字列プールに登録されることはない．
   ClibCell
   cell(
-    const string& name ///< [in] セル名
+    std::string_view name ///< [in] セル名
   ) const;
 
   /// @brief 全セルのリストの取得
   ClibCellList
   cell_list() const;
 
+  /// @brief 名前のリストからセルのリストを得る．
+  ///
+  /// 見つからなかった名前に対応する要素は不正値となる．
+  ClibCellList
+  cell_list(
+    const vector<string>& name_list ///< [in] セル名のリスト
+  ) const;
+
   /// @brief セルグループ数の取得
   SizeType
   cell_group_num() const;
@@ -364,12 +566,55 @@ public:
   ) const;
 
 
+public:
+  //////////////////////////////////////////////////////////////////////
+  // 論理関数による検索
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief 論理関数に一致するセルグループを返す．
+  ///
+  /// 1出力で tristate 条件を持たない論理セルのグループのうち，
+  /// セルを持つものが対象となる．
+  /// 代表クラスへの変換マップはグループの iomap() で得られる．
+  /// 見つからない場合は不正値を返す．
+  ClibCellGroup
+  find_logic_group(
+    const TvFunc& func ///< [in] 論理関数
+  ) const;
+
+  /// @brief 論理式に一致するセルグループを返す．
+  ///
+  /// expr を ni 入力の関数とみなして find_logic_group(const TvFunc&)
+  /// を呼ぶ．
+  ClibCellGroup
+  find_logic_group(
+    const Expr& expr, ///< [in] 論理式
+    SizeType ni       ///< [in] 入力数
+  ) const;
+
+  /// @brief 論理関数と NPN 同値なセルクラスを返す．
+  ///
+  /// 見つからない場合は不正値を返す．
+  ClibCellClass
+  find_logic_class(
+    const TvFunc& func, ///< [in] 論理関数
+    ClibIOMap& iomap    ///< [out] func から代表関数への変換マップ
+  ) const;
+
+
 public:
   //////////////////////////////////////////////////////////////////////
   /// @name パタングラフ関係の情報の取得
   /// @{
   //////////////////////////////////////////////////////////////////////
 
+  /// @brief パタングラフ生成の統計情報を返す．
+  ///
+  /// restore() で読み込んだライブラリの場合は pat_num と node_num 以外は
+  /// 全て 0 となる．
+  ClibPatGenStats
+  pg_stats() const;
+
   /// @brief 総パタン数を返す．
   SizeType
   pg_pat_num() const;
@@ -439,6 +684,49 @@ public:
     SizeType id ///< [in] 枝番号 ( 0 <= id < edge_num() )
   ) const;
 
+  /// @brief ノードの深さを返す．
+  ///
+  /// 入力ノードの深さは 0 となる．
+  SizeType
+  pg_node_depth(
+    SizeType id ///< [in] ノード番号 ( 0 <= id < pg_node_num() )
+  ) const;
+
+  /// @brief パタンの最大の深さを返す．
+  SizeType
+  pg_max_depth() const;
+
+  /// @brief 根の種類，深さ，入力数からパタン番号のリストを返す．
+  ///
+  /// 該当するパタンがない場合には空のリストを返す．
+  /// 索引はパタングラフと同時に作られるので定数時間で検索できる．
+  const vector<SizeType>&
+  pg_pat_list(
+    ClibPatType root_type, ///< [in] 根のノードの種類
+    SizeType depth,        ///< [in] 深さ
+    SizeType input_num     ///< [in] 入力数
+  ) const;
+
+  /// @brief 論理関数と NPN 同値なパタン番号のリストを返す．
+  ///
+  /// パタンの入力番号を変数番号とみなした関数の NPN 正規形で検索する．
+  /// 該当するパタンがない場合には空のリストを返す．
+  const vector<SizeType>&
+  pg_pat_list(
+    const TvFunc& func ///< [in] 論理関数
+  ) const;
+
+  /// @brief 論理関数と NPN 同値なパタン番号のリストを返す．
+  ///
+  /// iomap には func から NPN 正規形への変換マップが設定される．
+  /// 個々のパタンの関数と func の対応は ClibPatGraph::rep_map() と
+  /// iomap の逆写像を合成して求められる．
+  const vector<SizeType>&
+  pg_pat_list(
+    const TvFunc& func, ///< [in] 論理関数
+    ClibIOMap& iomap    ///< [out] func から NPN 正規形への変換マップ
+  ) const;
+
   //////////////////////////////////////////////////////////////////////
   /// @}
   //////////////////////////////////////////////////////////////////////
@@ -464,8 +752,34 @@ public:
   );
 
   /// @brief 内容を出力する(デバッグ用)．
+  ///
+  /// thread_num に 2 以上を指定するとセルごとの出力を複数のスレッドで
+  /// 作ってから元の順番で連結する．
+  /// 出力結果はスレッド数によらない．
   void
   display(
+    ostream& s,             ///< [in] 出力先のストリーム
+    SizeType thread_num = 1 ///< [in] スレッド数
+  ) const;
+
+  /// @brief 内容を liberty 形式で出力する．
+  ///
+  /// thread_num に 2 以上を指定するとセルごとの出力を複数のスレッドで
+  /// 作ってから元の順番で連結する．
+  /// 出力結果はスレッド数によらない．
+  void
+  write_liberty(
+    ostream& s,             ///< [in] 出力先のストリーム
+    SizeType thread_num = 1 ///< [in] スレッド数
+  ) const;
+
+  /// @brief タイミング情報の LUT を列指向のバイナリ形式で出力する．
+  ///
+  /// 形式の詳細は c++-srcs/clib/TimingTableWriter.h を参照のこと．
+  /// 各列は 8 バイト境界に揃えて連続に配置されるので，
+  /// 出力したファイルはメモリマップしてそのまま参照できる．
+  void
+  write_timing_table(
     ostream& s ///< [in] 出力先のストリーム
   ) const;
 
@@ -497,6 +811,18 @@ public:
     return !operator==(right);
   }
 
+  /// @brief 内容の差分を求める．
+  ///
+  /// セル，ピン，タイミングを名前で対応づけて属性と LUT の値を比較する．
+  /// 数値は param.tolerance 以下の差を無視する．
+  /// 1つめのライブラリのセル順に，2つめにしかないセルはその後に並ぶ．
+  /// 結果はスレッド数によらない．
+  vector<ClibDiffItem>
+  diff(
+    const ClibCellLibrary& right,                ///< [in] 比較対象のライブラリ
+    const ClibDiffParam& param = ClibDiffParam{} ///< [in] 比較の条件
+  ) const;
+
 
 private:
   //////////////////////////////////////////////////////////////////////
@@ -0,0 +1,194 @@
+#ifndef YM_CLIBDERATEDLIBRARY_H
+#define YM_CLIBDERATEDLIBRARY_H
+
+/// @file ym/ClibDeratedLibrary.h
+/// @brief ClibDeratedLibrary のヘッダファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2024 Yusuke Matsunaga
+/// All rights reserved.
+
+#include "ym/ClibCellLibrary.h"
+
+
+BEGIN_NAMESPACE_YM_CLIB
+
+class CiLut;
+
+//////////////////////////////////////////////////////////////////////
+/// @ingroup ClibGroup
+/// @class ClibDeratedLibrary ClibDeratedLibrary.h "ym/ClibDeratedLibrary.h"
+/// @brief 動作条件に合わせて値を補正したセルライブラリを表すクラス
+///
+/// セル，ピン，タイミングなどの構造は元のライブラリを共有し，
+/// 補正後の LUT の値のみを別に持つ．
+/// 補正係数は liberty の k_process_XXX/k_temp_XXX/k_volt_XXX を用いて
+/// (1 + k_process * ΔP) * (1 + k_temp * ΔT) * (1 + k_volt * ΔV)
+/// で求める．ΔP などは nom_process などからの差分である．
+///
+/// タイミングと内部電力の LUT の値は生成時に一度だけ補正して
+/// 保持しているので，value() では補正の計算は行わない．
+/// LUT やピンの指定には library() から得られたオブジェクトを用いる．
+//////////////////////////////////////////////////////////////////////
+class ClibDeratedLibrary
+{
+public:
+
+  /// @brief 空のコンストラクタ
+  ClibDeratedLibrary() = default;
+
+  /// @brief 動作条件の値を指定したコンストラクタ
+  ClibDeratedLibrary(
+    const ClibCellLibrary& library, ///< [in] 元のライブラリ
+    double process,                 ///< [in] プロセス係数
+    double voltage,                 ///< [in] 電圧
+    double temperature              ///< [in] 温度
+  );
+
+  /// @brief 動作条件を指定したコンストラクタ
+  ///
+  /// op_cond が不正値の場合は std::invalid_argument 例外を送出する．
+  ClibDeratedLibrary(
+    const ClibCellLibrary& library,        ///< [in] 元のライブラリ
+    const ClibOperatingConditions& op_cond ///< [in] 動作条件
+  );
+
+  /// @brief デストラクタ
+  ~ClibDeratedLibrary() = default;
+
+
+public:
+  //////////////////////////////////////////////////////////////////////
+  // 外部インターフェイス
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief 元のライブラリを返す．
+  ClibCellLibrary
+  library() const
+  {
+    return mLibrary;
+  }
+
+  /// @brief プロセス係数を返す．
+  double
+  process() const
+  {
+    return mProcess;
+  }
+
+  /// @brief 電圧を返す．
+  double
+  voltage() const
+  {
+    return mVoltage;
+  }
+
+  /// @brief 温度を返す．
+  double
+  temperature() const
+  {
+    return mTemperature;
+  }
+
+  /// @brief 補正係数を返す．
+  ///
+  /// name は k_process_XXX などの XXX の部分("cell_rise" など)を指定する．
+  double
+  factor(
+    const string& name ///< [in] 補正対象の名前
+  ) const;
+
+  /// @brief 補正後の LUT の格子点の値を返す．
+  double
+  grid_value(
+    const ClibLut& lut,               ///< [in] 対象の LUT
+    const vector<SizeType>& pos_array ///< [in] 格子点座標
+  ) const;
+
+  /// @brief 補正後の LUT の値を返す．
+  double
+  value(
+    const ClibLut& lut,             ///< [in] 対象の LUT
+    const vector<double>& val_array ///< [in] 入力の値の配列
+  ) const;
+
+  /// @brief 補正後のピンの負荷容量を返す．
+  ClibCapacitance
+  capacitance(
+    const ClibPin& pin ///< [in] 対象のピン
+  ) const;
+
+  /// @brief 補正後のピンの立ち上がり時の負荷容量を返す．
+  ClibCapacitance
+  rise_capacitance(
+    const ClibPin& pin ///< [in] 対象のピン
+  ) const;
+
+  /// @brief 補正後のピンの立ち下がり時の負荷容量を返す．
+  ClibCapacitance
+  fall_capacitance(
+    const ClibPin& pin ///< [in] 対象のピン
+  ) const;
+
+  /// @brief 補正後のセル全体のリーク電力を返す．
+  double
+  cell_leakage_power(
+    const ClibCell& cell ///< [in] 対象のセル
+  ) const;
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // 内部で用いられる関数
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief 補正後の LUT の値を追加する．
+  ///
+  /// 登録済みの LUT の場合は何もしない．
+  void
+  add_lut(
+    const ClibLut& lut, ///< [in] 対象の LUT
+    double factor       ///< [in] 補正係数
+  );
+
+  /// @brief LUT の値の先頭位置を返す．
+  SizeType
+  lut_offset(
+    const ClibLut& lut
+  ) const;
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // データメンバ
+  //////////////////////////////////////////////////////////////////////
+
+  // 元のライブラリ
+  ClibCellLibrary mLibrary;
+
+  // プロセス係数
+  double mProcess{0.0};
+
+  // 電圧
+  double mVoltage{0.0};
+
+  // 温度
+  double mTemperature{0.0};
+
+  // LUT から値の先頭位置を得る辞書
+  std::unordered_map<const CiLut*, SizeType> mLutDict;
+
+  // 補正後の LUT の値
+  vector<double> mLutValues;
+
+  // ピンの負荷容量の補正係数
+  double mPinCapFactor{1.0};
+
+  // リーク電力の補正係数
+  double mLeakageFactor{1.0};
+
+};
+
+END_NAMESPACE_YM_CLIB
+
+#endif // YM_CLIBDERATEDLIBRARY_H
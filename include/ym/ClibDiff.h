@@ -0,0 +1,124 @@
+#ifndef CLIBDIFF_H
+#define CLIBDIFF_H
+
+/// @file ClibDiff.h
+/// @brief ClibDiffParam, ClibDiffItem のヘッダファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2024 Yusuke Matsunaga
+/// All rights reserved.
+
+#include "ym/clib.h"
+
+
+BEGIN_NAMESPACE_YM_CLIB
+
+//////////////////////////////////////////////////////////////////////
+/// @struct ClibDiffParam ClibDiff.h "ClibDiff.h"
+/// @brief ライブラリの比較の条件を表す構造体
+//////////////////////////////////////////////////////////////////////
+struct ClibDiffParam
+{
+  /// @brief 数値の許容誤差
+  ///
+  /// 差の絶対値がこの値以下の場合には等しいとみなす．
+  /// どちらかが NaN の場合は常に異なる値とみなす．
+  double tolerance{0.0};
+
+  /// @brief 差分の最大数
+  ///
+  /// この数の差分が見つかった時点で比較を打ち切る．
+  /// 0 の場合は制限なし．
+  SizeType max_diff{0};
+
+  /// @brief スレッド数
+  ///
+  /// 1 以下の場合は単一のスレッドで処理を行う．
+  SizeType thread_num{1};
+
+};
+
+
+//////////////////////////////////////////////////////////////////////
+/// @struct ClibDiffItem ClibDiff.h "ClibDiff.h"
+/// @brief ライブラリの差分を表す構造体
+///
+/// セル，ピン，タイミングはそれぞれ名前で対応をとる．
+/// 同一のピンの組に同じ種類のタイミングが複数ある場合には
+/// 出現順で対応をとる．
+/// 対応しない要素は kind にその種類を設定し，
+/// 1つめのライブラリのみにある場合は value1 を，
+/// 2つめのライブラリのみにある場合は value2 を 1 とする．
+//////////////////////////////////////////////////////////////////////
+struct ClibDiffItem
+{
+  /// @brief 差分の種類
+  enum Kind : std::uint8_t {
+    Cell,     ///< 一方にしかないセル
+    Pin,      ///< 一方にしかないピン
+    Timing,   ///< 一方にしかないタイミング
+    Attr,     ///< 属性値の差
+    LutShape, ///< LUT の次元，変数，インデックスの差
+    LutValue  ///< LUT の値の差
+  };
+
+  /// @brief 差分の種類
+  Kind kind;
+
+  /// @brief セル名
+  string cell_name;
+
+  /// @brief ピン名
+  ///
+  /// タイミングの場合は出力ピン名
+  string pin_name;
+
+  /// @brief タイミングの入力ピン名
+  string related_pin_name;
+
+  /// @brief タイミングの種類
+  ClibTimingType timing_type{ClibTimingType::none};
+
+  /// @brief タイミングセンス
+  ///
+  /// non_unate のタイミングとエッジのタイミングは non_unate となる．
+  ClibTimingSense timing_sense{ClibTimingSense::none};
+
+  /// @brief 属性名
+  ///
+  /// LUT の場合は "cell_rise" などのテーブル名
+  string attr_name;
+
+  /// @brief 1つめのライブラリの値
+  ///
+  /// LUT の値の場合は差が最大となる格子点の値
+  double value1{0.0};
+
+  /// @brief 2つめのライブラリの値
+  double value2{0.0};
+
+  /// @brief 差が最大となる格子点の座標
+  ///
+  /// kind が LutValue の時のみ意味を持つ．
+  vector<SizeType> grid_pos;
+
+  /// @brief 差(value2 - value1)を返す．
+  double
+  delta() const
+  {
+    return value2 - value1;
+  }
+
+};
+
+/// @brief ClibDiffItem のストリーム出力演算子
+/// @return s を返す．
+ostream&
+operator<<(
+  ostream& s,              ///< [in] 出力先のストリーム
+  const ClibDiffItem& item ///< [in] 差分
+);
+
+END_NAMESPACE_YM_CLIB
+
+#endif // CLIBDIFF_H
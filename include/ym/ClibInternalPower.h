@@ -0,0 +1,116 @@
+#ifndef YM_CLIBINTERNALPOWER_H
+#define YM_CLIBINTERNALPOWER_H
+
+/// @file ym/ClibInternalPower.h
+/// @brief ClibInternalPower のヘッダファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2024 Yusuke Matsunaga
+/// All rights reserved.
+
+#include "ym/ClibCellElem.h"
+#include "ym/ClibTime.h"
+#include "ym/ClibCapacitance.h"
+#include "ym/logic.h"
+
+
+BEGIN_NAMESPACE_YM_CLIB
+
+class CiInternalPower;
+
+//////////////////////////////////////////////////////////////////////
+/// @ingroup ClibGroup
+/// @class ClibInternalPower ClibInternalPower.h "ym/ClibInternalPower.h"
+/// @brief 内部電力(internal_power)を表すクラス
+///
+/// エネルギーの値は1回の遷移あたりのもので，
+/// 単位はライブラリの指定に従う．
+//////////////////////////////////////////////////////////////////////
+class ClibInternalPower :
+  public ClibCellElem<CiInternalPower>
+{
+public:
+
+  /// @brief 空のコンストラクタ
+  ClibInternalPower() = default;
+
+  /// @brief 内容を指定したコンストラクタ
+  ClibInternalPower(
+    const CiCell* cell,         ///< [in] 親のセル
+    const CiInternalPower* impl ///< [in] 本体
+  ) : ClibCellElem{cell, impl}
+  {
+  }
+
+  /// @brief デストラクタ
+  ~ClibInternalPower() = default;
+
+
+public:
+  //////////////////////////////////////////////////////////////////////
+  // 外部インターフェイス
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief 対象のピンを返す．
+  ClibPin
+  pin() const;
+
+  /// @brief 関連するピンを返す．
+  ///
+  /// related_pin が指定されていない場合は不正値を返す．
+  ClibPin
+  related_pin() const;
+
+  /// @brief 条件式を返す．
+  ///
+  /// ない場合には定数1の式が返される．
+  Expr
+  when() const;
+
+  /// @brief 立ち上がり時のエネルギーテーブルを返す．
+  ClibLut
+  rise_power() const;
+
+  /// @brief 立ち下がり時のエネルギーテーブルを返す．
+  ClibLut
+  fall_power() const;
+
+  /// @brief 立ち上がり時のエネルギーを計算する．
+  double
+  calc_rise_energy(
+    ClibTime input_transition,         ///< [in] 入力信号の遷移時間
+    ClibCapacitance output_capacitance ///< [in] 出力の負荷容量
+  ) const;
+
+  /// @brief 立ち下がり時のエネルギーを計算する．
+  double
+  calc_fall_energy(
+    ClibTime input_transition,         ///< [in] 入力信号の遷移時間
+    ClibCapacitance output_capacitance ///< [in] 出力の負荷容量
+  ) const;
+
+  /// @brief 立ち上がり時のエネルギーをまとめて計算する．
+  /// @return インスタンスごとのエネルギーのリストを返す．
+  ///
+  /// input_transition_list と output_capacitance_list の同じ位置の
+  /// 値の組を1つのインスタンスとみなす．
+  /// 2つのリストの大きさが異なる場合には std::invalid_argument 例外を送出する．
+  vector<double>
+  calc_rise_energy_list(
+    const vector<double>& input_transition_list,  ///< [in] 遷移時間のリスト
+    const vector<double>& output_capacitance_list ///< [in] 負荷容量のリスト
+  ) const;
+
+  /// @brief 立ち下がり時のエネルギーをまとめて計算する．
+  /// @return インスタンスごとのエネルギーのリストを返す．
+  vector<double>
+  calc_fall_energy_list(
+    const vector<double>& input_transition_list,  ///< [in] 遷移時間のリスト
+    const vector<double>& output_capacitance_list ///< [in] 負荷容量のリスト
+  ) const;
+
+};
+
+END_NAMESPACE_YM_CLIB
+
+#endif // YM_CLIBINTERNALPOWER_H
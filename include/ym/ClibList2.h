@@ -198,6 +198,8 @@ class CiBundle;
 using ClibBundleList = ClibList2<CiBundle, ClibBundle>;
 class CiTiming;
 using ClibTimingList = ClibList2<CiTiming, ClibTiming>;
+class CiInternalPower;
+using ClibInternalPowerList = ClibList2<CiInternalPower, ClibInternalPower>;
 
 END_NAMESPACE_YM_CLIB
 
@@ -207,6 +209,7 @@ using nsClib::ClibPinList;
 using nsClib::ClibBusList;
 using nsClib::ClibBundleList;
 using nsClib::ClibTimingList;
+using nsClib::ClibInternalPowerList;
 
 END_NAMESPACE_YM
 
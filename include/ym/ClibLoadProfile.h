@@ -0,0 +1,103 @@
+#ifndef YM_CLIBLOADPROFILE_H
+#define YM_CLIBLOADPROFILE_H
+
+/// @file ym/ClibLoadProfile.h
+/// @brief ClibLoadProfile のヘッダファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2024 Yusuke Matsunaga
+/// All rights reserved.
+
+#include "ym/clib.h"
+
+
+BEGIN_NAMESPACE_YM_CLIB
+
+//////////////////////////////////////////////////////////////////////
+/// @struct ClibLoadPhase ClibLoadProfile.h "ym/ClibLoadProfile.h"
+/// @brief ライブラリ読み込みの一つのフェーズの計測結果を表す構造体
+//////////////////////////////////////////////////////////////////////
+struct ClibLoadPhase
+{
+  /// @brief フェーズ名
+  string name;
+
+  /// @brief 経過時間(秒)
+  double wall_time{0.0};
+
+  /// @brief 処理したバイト数
+  ///
+  /// 意味を持たないフェーズでは 0 となる．
+  SizeType bytes{0};
+
+  /// @brief 処理したオブジェクト数
+  ///
+  /// フェーズごとにトークン数，セル数，ノード数などを表す．
+  SizeType object_num{0};
+
+  /// @brief フェーズ終了時点でのプロセスの最大常駐メモリ量(バイト)
+  SizeType peak_rss{0};
+
+};
+
+
+//////////////////////////////////////////////////////////////////////
+/// @struct ClibLoadProfile ClibLoadProfile.h "ym/ClibLoadProfile.h"
+/// @brief ライブラリ読み込みの各フェーズの計測結果を表す構造体
+///
+/// ClibCellLibrary::read_liberty() の計測用のオーバーロードで用いる．
+/// フェーズは以下の順に記録される．
+/// - read:      ファイルの内容をメモリに読み込む．
+/// - parse:     字句解析と構文解析を行って AST を作る．
+///              字句解析は構文解析から逐次呼ばれるので分離しない．
+/// - info:      ライブラリの属性とテンプレート類を設定する．
+/// - cell:      セルを生成する．
+/// - signature: セルのシグネチャを作る．
+/// - grouping:  シグネチャからセルグループ/セルクラスを求める．
+/// - gen_pat:   パタングラフを作る．
+/// - wrap_up:   辞書などの最終処理を行う．
+///
+/// 環境変数 YMCELL_LOAD_PROFILE にファイル名を設定しておくと
+/// 通常の read_liberty() でも計測を行い，結果をそのファイルに
+/// JSON 形式で1行ずつ追記する．"-" の場合は標準エラー出力に出力する．
+//////////////////////////////////////////////////////////////////////
+struct ClibLoadProfile
+{
+  /// @brief 読み込んだファイル名
+  string filename;
+
+  /// @brief フェーズごとの計測結果のリスト
+  vector<ClibLoadPhase> phase_list;
+
+  /// @brief 全フェーズの経過時間の和を返す．
+  double
+  total_time() const;
+
+  /// @brief 最大常駐メモリ量(バイト)を返す．
+  SizeType
+  peak_rss() const;
+
+  /// @brief 内容を JSON 形式で出力する．
+  ///
+  /// 改行を含まない1行で出力する．
+  void
+  write_json(
+    ostream& s ///< [in] 出力先のストリーム
+  ) const;
+
+  /// @brief 内容を JSON 形式の文字列で返す．
+  string
+  json() const;
+
+};
+
+END_NAMESPACE_YM_CLIB
+
+BEGIN_NAMESPACE_YM
+
+using nsClib::ClibLoadPhase;
+using nsClib::ClibLoadProfile;
+
+END_NAMESPACE_YM
+
+#endif // YM_CLIBLOADPROFILE_H
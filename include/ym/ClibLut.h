@@ -85,6 +85,39 @@ public:
     const vector<double>& val_array ///< [in] 入力の値の配列
   ) const;
 
+  /// @brief 値をまとめて計算する．
+  ///
+  /// input_list[var][k] が k 番目の入力の変数 var の値となる．
+  /// input_list のサイズは dimension() と同じで，
+  /// 各要素のサイズは全て等しくなければならない．
+  vector<double>
+  value_list(
+    const vector<vector<double>>& input_list ///< [in] 変数ごとの入力値のリスト
+  ) const;
+
+  /// @brief 値をまとめて計算する(生の配列版)．
+  ///
+  /// input_list[var] は n 個の要素を持つ配列を指していなければならない．
+  /// 結果は output_list[0] 〜 output_list[n - 1] に格納される．
+  void
+  value_list(
+    SizeType n,                       ///< [in] 入力数
+    const double* const input_list[], ///< [in] 変数ごとの入力値の配列
+    double* output_list               ///< [out] 結果を格納する配列
+  ) const;
+
+  /// @brief インデックス値の配列を返す．
+  const vector<double>&
+  index_array(
+    SizeType var ///< [in] 変数番号 ( 0 <= var < dimension() )
+  ) const;
+
+  /// @brief 格子点の値の配列を返す．
+  ///
+  /// 最後の変数が最も速く変化する順(C の多次元配列と同じ順)で並んでいる．
+  const vector<double>&
+  value_array() const;
+
   //////////////////////////////////////////////////////////////////////
   /// @}
   //////////////////////////////////////////////////////////////////////
@@ -0,0 +1,227 @@
+#ifndef YM_CLIBMULTICORNER_H
+#define YM_CLIBMULTICORNER_H
+
+/// @file ym/ClibMultiCorner.h
+/// @brief ClibMultiCorner のヘッダファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2024 Yusuke Matsunaga
+/// All rights reserved.
+
+#include "ym/ClibCellLibrary.h"
+
+
+BEGIN_NAMESPACE_YM_CLIB
+
+class CiLut;
+class CiPin;
+
+//////////////////////////////////////////////////////////////////////
+/// @ingroup ClibGroup
+/// @class ClibMultiCorner ClibMultiCorner.h "ym/ClibMultiCorner.h"
+/// @brief 複数のコーナーのセルライブラリをまとめて表すクラス
+///
+/// セル，ピン，タイミング，セルグループ，パタングラフなどの構造は
+/// 最初のコーナーのライブラリを代表として1つだけ保持し，
+/// コーナーごとに異なる LUT の値(タイミングと内部電力)と
+/// ピンの負荷容量のみを別に持つ．
+/// セルは名前で対応をとるので，ライブラリ中のセルの順番は異なってもよい．
+/// ピンは名前と順番の両方が一致しなければならない．
+/// 構造が代表のライブラリと異なるライブラリを与えた場合には
+/// std::invalid_argument 例外を送出する．
+///
+/// LUT の値は格子点ごとに全コーナーの値を連続して並べているので，
+/// values() では全コーナーの補間を一度に行う．
+/// LUT やピンの指定には library() から得られたオブジェクトを用いる．
+//////////////////////////////////////////////////////////////////////
+class ClibMultiCorner
+{
+public:
+
+  /// @brief 空のコンストラクタ
+  ClibMultiCorner() = default;
+
+  /// @brief ライブラリのリストを指定したコンストラクタ
+  ///
+  /// 各ライブラリの構造は同一でなければならない．
+  explicit
+  ClibMultiCorner(
+    const vector<ClibCellLibrary>& library_list ///< [in] コーナーごとのライブラリのリスト
+  );
+
+  /// @brief liberty 形式のファイルを読み込んでライブラリを生成する．
+  /// @return 生成したオブジェクトを返す．
+  ///
+  /// 読み込みが失敗した場合や構造が異なる場合は
+  /// std::invalid_argument 例外を送出する．
+  static
+  ClibMultiCorner
+  read_liberty(
+    const vector<string>& filename_list ///< [in] コーナーごとのファイル名のリスト
+  );
+
+  /// @brief デストラクタ
+  ~ClibMultiCorner() = default;
+
+
+public:
+  //////////////////////////////////////////////////////////////////////
+  // 外部インターフェイス
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief コーナー数を返す．
+  SizeType
+  corner_num() const
+  {
+    return mCornerNameList.size();
+  }
+
+  /// @brief コーナー名を返す．
+  ///
+  /// 元のライブラリ名を用いる．
+  const string&
+  corner_name(
+    SizeType corner ///< [in] コーナー番号 ( 0 <= corner < corner_num() )
+  ) const
+  {
+    _check_corner(corner);
+    return mCornerNameList[corner];
+  }
+
+  /// @brief 構造を表すライブラリを返す．
+  ///
+  /// 値は最初のコーナーのものとなる．
+  ClibCellLibrary
+  library() const
+  {
+    return mLibrary;
+  }
+
+  /// @brief LUT の格子点の値を返す．
+  ///
+  /// lut にはタイミングの LUT と内部電力の LUT を指定できる．
+  double
+  grid_value(
+    SizeType corner,                  ///< [in] コーナー番号
+    const ClibLut& lut,               ///< [in] 対象の LUT
+    const vector<SizeType>& pos_array ///< [in] 格子点座標
+  ) const;
+
+  /// @brief LUT の値を返す．
+  double
+  value(
+    SizeType corner,                ///< [in] コーナー番号
+    const ClibLut& lut,             ///< [in] 対象の LUT
+    const vector<double>& val_array ///< [in] 入力の値の配列
+  ) const;
+
+  /// @brief 全コーナーの LUT の値を返す．
+  /// @return コーナー番号順の値のリストを返す．
+  vector<double>
+  values(
+    const ClibLut& lut,             ///< [in] 対象の LUT
+    const vector<double>& val_array ///< [in] 入力の値の配列
+  ) const;
+
+  /// @brief ピンの負荷容量を返す．
+  ClibCapacitance
+  capacitance(
+    SizeType corner,   ///< [in] コーナー番号
+    const ClibPin& pin ///< [in] 対象のピン
+  ) const;
+
+  /// @brief ピンの立ち上がり時の負荷容量を返す．
+  ClibCapacitance
+  rise_capacitance(
+    SizeType corner,   ///< [in] コーナー番号
+    const ClibPin& pin ///< [in] 対象のピン
+  ) const;
+
+  /// @brief ピンの立ち下がり時の負荷容量を返す．
+  ClibCapacitance
+  fall_capacitance(
+    SizeType corner,   ///< [in] コーナー番号
+    const ClibPin& pin ///< [in] 対象のピン
+  ) const;
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // 内部で用いられる関数
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief コーナーを追加する．
+  ///
+  /// ピンの負荷容量は mPinCapValues に追加し，
+  /// LUT の値は lut_values に格納する．
+  /// 最初のライブラリの場合は代表の LUT とピンを登録する．
+  /// それ以外の場合は構造が異なると std::invalid_argument 例外を送出する．
+  void
+  add_corner(
+    const ClibCellLibrary& library, ///< [in] 対象のライブラリ
+    vector<double>& lut_values      ///< [out] LUT の値のリスト
+  );
+
+  /// @brief コーナーごとの LUT の値を並べ替えて設定する．
+  void
+  set_lut_values(
+    const vector<vector<double>>& lut_values_list ///< [in] コーナーごとの LUT の値のリスト
+  );
+
+  /// @brief LUT の値の先頭位置を返す．
+  SizeType
+  lut_offset(
+    const ClibLut& lut
+  ) const;
+
+  /// @brief ピンの負荷容量の先頭位置を返す．
+  SizeType
+  pin_offset(
+    SizeType corner,
+    const ClibPin& pin
+  ) const;
+
+  /// @brief コーナー番号をチェックする．
+  void
+  _check_corner(
+    SizeType corner
+  ) const
+  {
+    if ( corner >= corner_num() ) {
+      throw std::out_of_range{"corner is out of range"};
+    }
+  }
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // データメンバ
+  //////////////////////////////////////////////////////////////////////
+
+  // 構造を表すライブラリ
+  ClibCellLibrary mLibrary;
+
+  // コーナー名のリスト
+  vector<string> mCornerNameList;
+
+  // 代表の LUT から1コーナー分の値の中での先頭位置を得る辞書
+  std::unordered_map<const CiLut*, SizeType> mLutDict;
+
+  // LUT の値
+  // 先頭位置を o とすると，格子点 k のコーナー c の値を
+  // [(o + k) * corner_num() + c] に置く．
+  vector<double> mLutValues;
+
+  // 代表のピンから番号を得る辞書
+  std::unordered_map<const CiPin*, SizeType> mPinDict;
+
+  // ピンの負荷容量
+  // コーナー c のピン p の (負荷容量, 立ち上がり, 立ち下がり) を
+  // [(c * ピン数 + p) * 3 + i] に置く．
+  vector<double> mPinCapValues;
+
+};
+
+END_NAMESPACE_YM_CLIB
+
+#endif // YM_CLIBMULTICORNER_H
@@ -0,0 +1,139 @@
+#ifndef YM_CLIBOPERATINGCONDITIONS_H
+#define YM_CLIBOPERATINGCONDITIONS_H
+
+/// @file ym/ClibOperatingConditions.h
+/// @brief ClibOperatingConditions のヘッダファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2024 Yusuke Matsunaga
+/// All rights reserved.
+
+#include "ym/clib.h"
+#include "ym/ClibLibraryPtr.h"
+
+
+BEGIN_NAMESPACE_YM_CLIB
+
+class CiCellLibrary;
+
+//////////////////////////////////////////////////////////////////////
+/// @ingroup ClibGroup
+/// @class ClibOperatingConditions ClibOperatingConditions.h "ym/ClibOperatingConditions.h"
+/// @brief 動作条件(operating_conditions)を表すクラス
+///
+/// 値はライブラリの単位で表されている．
+/// ClibDeratedLibrary の生成に用いることができる．
+//////////////////////////////////////////////////////////////////////
+class ClibOperatingConditions
+{
+public:
+
+  /// @brief 空のコンストラクタ
+  ///
+  /// 不正値となる．
+  ClibOperatingConditions() = default;
+
+  /// @brief 内容を指定したコンストラクタ
+  ClibOperatingConditions(
+    ClibLibraryPtr lib, ///< [in] 親のライブラリ
+    SizeType id         ///< [in] ID番号
+  ) : mLibrary{lib},
+      mId{id}
+  {
+  }
+
+  /// @brief デストラクタ
+  ~ClibOperatingConditions() = default;
+
+
+public:
+  //////////////////////////////////////////////////////////////////////
+  // 外部インターフェイス
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief 名前を返す．
+  string
+  name() const;
+
+  /// @brief プロセス係数を返す．
+  double
+  process() const;
+
+  /// @brief 温度を返す．
+  double
+  temperature() const;
+
+  /// @brief 電圧を返す．
+  double
+  voltage() const;
+
+  /// @brief 配線の RC ツリーの種類を返す．
+  ///
+  /// 指定されていない場合は空文字列を返す．
+  string
+  tree_type() const;
+
+
+public:
+  //////////////////////////////////////////////////////////////////////
+  // mImpl に関する関数
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief 適正な値を持っている時 true を返す．
+  bool
+  is_valid() const
+  {
+    return mLibrary != nullptr;
+  }
+
+  /// @brief 不正値の時 true を返す．
+  bool
+  is_invalid() const
+  {
+    return !is_valid();
+  }
+
+  /// @brief 等価比較
+  bool
+  operator==(
+    const ClibOperatingConditions& right
+  ) const
+  {
+    return mLibrary == right.mLibrary && mId == right.mId;
+  }
+
+  /// @brief 非等価比較
+  bool
+  operator!=(
+    const ClibOperatingConditions& right
+  ) const
+  {
+    return !operator==(right);
+  }
+
+  /// @brief 適正な値を持っているかチェックする．
+  void
+  _check_valid() const
+  {
+    if ( !is_valid() ) {
+      throw std::invalid_argument{"not having a valid data"};
+    }
+  }
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // データメンバ
+  //////////////////////////////////////////////////////////////////////
+
+  // 親のライブラリ
+  ClibLibraryPtr mLibrary;
+
+  // ID番号
+  SizeType mId{CLIB_NULLID};
+
+};
+
+END_NAMESPACE_YM_CLIB
+
+#endif // YM_CLIBOPERATINGCONDITIONS_H
@@ -0,0 +1,81 @@
+#ifndef CLIBPATGENPARAM_H
+#define CLIBPATGENPARAM_H
+
+/// @file ClibPatGenParam.h
+/// @brief ClibPatGenParam のヘッダファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2024 Yusuke Matsunaga
+/// All rights reserved.
+
+#include "ym/clib.h"
+
+
+BEGIN_NAMESPACE_YM_CLIB
+
+//////////////////////////////////////////////////////////////////////
+/// @struct ClibPatGenParam ClibPatGenParam.h "ClibPatGenParam.h"
+/// @brief パタングラフ生成の制限値を表す構造体
+///
+/// いずれも 0 の場合は制限なしを表す．
+//////////////////////////////////////////////////////////////////////
+struct ClibPatGenParam
+{
+  /// @brief パタンの最大入力数
+  ///
+  /// これを超える入力数の論理式からはパタンを作らない．
+  SizeType max_input{0};
+
+  /// @brief 代表クラスごとの最大パタン数
+  ///
+  /// これを超えた分の2分木分解は登録しない．
+  SizeType max_pat_per_class{0};
+
+  /// @brief パタングラフの総ノード数の上限
+  ///
+  /// ある論理式のパタンを生成する途中でこれを超えた場合には
+  /// その論理式から生成されたノードとパタンを取り除く．
+  SizeType max_node_num{0};
+
+};
+
+
+//////////////////////////////////////////////////////////////////////
+/// @struct ClibPatGenStats ClibPatGenParam.h "ClibPatGenParam.h"
+/// @brief パタングラフ生成時の統計情報を表す構造体
+//////////////////////////////////////////////////////////////////////
+struct ClibPatGenStats
+{
+  /// @brief パタン生成の対象となった論理式の数
+  SizeType expr_num{0};
+
+  /// @brief 入力数の制限で取り除かれた論理式の数
+  SizeType input_pruned_expr_num{0};
+
+  /// @brief ノード数の制限で取り除かれた論理式の数
+  SizeType node_pruned_expr_num{0};
+
+  /// @brief クラスごとのパタン数の制限で取り除かれたパタン数
+  SizeType class_pruned_pat_num{0};
+
+  /// @brief 使われなくなったため削除されたノード数
+  SizeType swept_node_num{0};
+
+  /// @brief 最終的なパタン数
+  SizeType pat_num{0};
+
+  /// @brief 最終的なノード数
+  SizeType node_num{0};
+
+};
+
+END_NAMESPACE_YM_CLIB
+
+BEGIN_NAMESPACE_YM
+
+using nsClib::ClibPatGenParam;
+using nsClib::ClibPatGenStats;
+
+END_NAMESPACE_YM
+
+#endif // CLIBPATGENPARAM_H
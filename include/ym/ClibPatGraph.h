@@ -9,6 +9,7 @@
 /// All rights reserved.
 
 #include "ym/clib.h"
+#include "ym/logic.h"
 #include "ym/ClibLibraryPtr.h"
 
 
@@ -76,6 +77,20 @@ public:
     SizeType pos ///< [in] 位置 ( 0 <= pos < edge_num() )
   ) const;
 
+  /// @brief 根の深さを返す．
+  SizeType
+  depth() const;
+
+  /// @brief 論理関数を返す．
+  ///
+  /// 入力番号を変数番号とみなした関数で根の反転属性も含む．
+  TvFunc
+  func() const;
+
+  /// @brief func() から NPN 正規形への変換マップを返す．
+  ClibIOMap
+  rep_map() const;
+
 
 public:
   //////////////////////////////////////////////////////////////////////
@@ -0,0 +1,181 @@
+#ifndef YM_CLIBWIRELOAD_H
+#define YM_CLIBWIRELOAD_H
+
+/// @file ym/ClibWireLoad.h
+/// @brief ClibWireLoad のヘッダファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2024 Yusuke Matsunaga
+/// All rights reserved.
+
+#include "ym/clib.h"
+#include "ym/ClibLibraryPtr.h"
+
+
+BEGIN_NAMESPACE_YM_CLIB
+
+class CiCellLibrary;
+
+//////////////////////////////////////////////////////////////////////
+/// @ingroup ClibGroup
+/// @class ClibWireLoad ClibWireLoad.h "ym/ClibWireLoad.h"
+/// @brief ワイヤーロードモデルを表すクラス
+///
+/// wire_load グループと wire_load_table グループの両方を表す．
+/// 値はライブラリの単位で表されている．
+/// ファンアウト数ごとの値は読み込み時に表に展開されているので
+/// wire_capacitance() などは定数時間で計算される．
+//////////////////////////////////////////////////////////////////////
+class ClibWireLoad
+{
+public:
+
+  /// @brief 空のコンストラクタ
+  ///
+  /// 不正値となる．
+  ClibWireLoad() = default;
+
+  /// @brief 内容を指定したコンストラクタ
+  ClibWireLoad(
+    ClibLibraryPtr lib, ///< [in] 親のライブラリ
+    SizeType id         ///< [in] ID番号
+  ) : mLibrary{lib},
+      mId{id}
+  {
+  }
+
+  /// @brief デストラクタ
+  ~ClibWireLoad() = default;
+
+
+public:
+  //////////////////////////////////////////////////////////////////////
+  // 外部インターフェイス
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief 名前を返す．
+  string
+  name() const;
+
+  /// @brief wire_load_table の時 true を返す．
+  bool
+  is_table() const;
+
+  /// @brief 単位長あたりの抵抗を返す．
+  ///
+  /// wire_load_table の場合は 0.0 を返す．
+  double
+  resistance() const;
+
+  /// @brief 単位長あたりの容量を返す．
+  ///
+  /// wire_load_table の場合は 0.0 を返す．
+  double
+  capacitance() const;
+
+  /// @brief 単位長あたりの面積を返す．
+  ///
+  /// wire_load_table の場合は 0.0 を返す．
+  double
+  area() const;
+
+  /// @brief 外挿用の傾きを返す．
+  ///
+  /// wire_load_table の場合は 0.0 を返す．
+  double
+  slope() const;
+
+  /// @brief ファンアウト数から配線長を求める．
+  double
+  wire_length(
+    SizeType fanout ///< [in] ファンアウト数
+  ) const;
+
+  /// @brief ファンアウト数から配線容量を求める．
+  double
+  wire_capacitance(
+    SizeType fanout ///< [in] ファンアウト数
+  ) const;
+
+  /// @brief ファンアウト数から配線抵抗を求める．
+  double
+  wire_resistance(
+    SizeType fanout ///< [in] ファンアウト数
+  ) const;
+
+  /// @brief ファンアウト数から配線面積を求める．
+  double
+  wire_area(
+    SizeType fanout ///< [in] ファンアウト数
+  ) const;
+
+  /// @brief ファンアウト数のリストから配線容量のリストを求める．
+  vector<double>
+  wire_capacitance_list(
+    const vector<SizeType>& fanout_list ///< [in] ファンアウト数のリスト
+  ) const;
+
+
+public:
+  //////////////////////////////////////////////////////////////////////
+  // mImpl に関する関数
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief 適正な値を持っている時 true を返す．
+  bool
+  is_valid() const
+  {
+    return mLibrary != nullptr;
+  }
+
+  /// @brief 不正値の時 true を返す．
+  bool
+  is_invalid() const
+  {
+    return !is_valid();
+  }
+
+  /// @brief 等価比較
+  bool
+  operator==(
+    const ClibWireLoad& right
+  ) const
+  {
+    return mLibrary == right.mLibrary && mId == right.mId;
+  }
+
+  /// @brief 非等価比較
+  bool
+  operator!=(
+    const ClibWireLoad& right
+  ) const
+  {
+    return !operator==(right);
+  }
+
+  /// @brief 適正な値を持っているかチェックする．
+  void
+  _check_valid() const
+  {
+    if ( !is_valid() ) {
+      throw std::invalid_argument{"not having a valid data"};
+    }
+  }
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // データメンバ
+  //////////////////////////////////////////////////////////////////////
+
+  // 親のライブラリ
+  ClibLibraryPtr mLibrary;
+
+  // ID番号
+  SizeType mId{CLIB_NULLID};
+
+};
+
+END_NAMESPACE_YM_CLIB
+
+#endif // YM_CLIBWIRELOAD_H
@@ -50,14 +50,18 @@ class ClibCapacitance;
 class ClibResistance;
 
 class ClibCellLibrary;
+class ClibMultiCorner;
 class ClibCell;
 class ClibPin;
 class ClibBusType;
 class ClibBus;
 class ClibBundle;
 class ClibTiming;
+class ClibInternalPower;
 class ClibLutTemplate;
 class ClibLut;
+class ClibWireLoad;
+class ClibOperatingConditions;
 
 class ClibCellGroup;
 class ClibCellClass;
@@ -84,8 +88,11 @@ using nsClib::ClibBusType;
 using nsClib::ClibBus;
 using nsClib::ClibBundle;
 using nsClib::ClibTiming;
+using nsClib::ClibInternalPower;
 using nsClib::ClibLutTemplate;
 using nsClib::ClibLut;
+using nsClib::ClibWireLoad;
+using nsClib::ClibOperatingConditions;
 
 using nsClib::ClibCellGroup;
 using nsClib::ClibCellClass;
@@ -276,6 +283,21 @@ enum class ClibPatType : std::uint8_t
   Xor   = 3
 };
 
+
+//////////////////////////////////////////////////////////////////////
+/// @brief セルを並べる時の基準
+///
+/// DriveResistance は rise_resistance/fall_resistance を用いる．
+/// これらが定義されていない非線形遅延モデルのライブラリでは
+/// 遅延テーブルの負荷容量に対する傾きを駆動抵抗とみなす．
+//////////////////////////////////////////////////////////////////////
+enum class ClibCellOrder : std::uint8_t
+{
+  Area             = 0, ///< 面積
+  InputCapacitance = 1, ///< 入力ピンの容量の最大値
+  DriveResistance  = 2  ///< 出力の駆動抵抗の最大値
+};
+
 /// @brief 無効なID番号を表す値
 const SizeType CLIB_NULLID = -1;
 
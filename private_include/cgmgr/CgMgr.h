@@ -10,7 +10,6 @@
 
 #include "ym/clib.h"
 #include "ym/Expr.h"
-#include "cgmgr/PatMgr.h"
 
 
 BEGIN_NAMESPACE_YM_CLIB
@@ -95,32 +94,12 @@ public:
     const CgSignature& sig ///< [in] シグネチャ
   );
 
-  /// @breif パタングラフを生成する．
-  void
-  gen_pat();
-
-  /// @brief 全ノード数を返す．
-  SizeType
-  pat_node_num() const;
-
-  /// @brief ノードを返す．
-  const PatNode&
-  pat_node(
-    SizeType pos ///< [in] ノード番号 ( 0 <= pos < node_num() )
-  ) const;
-
-  /// @brief パタン数を返す．
-  SizeType
-  pat_num() const;
-
-  /// @brief パタンのノードリストを返す．
-  void
-  get_pat_info(
-    SizeType id,                   ///< [in] パタン番号 ( 0 <= id < pat_num() )
-    const CiCellClass*& rep_class, ///< [out] パタンの表す代表関数番号
-    SizeType& input_num,           ///< [out] パタンの入力数
-    vector<SizeType>& node_list    ///< [out] パタンを DFS 順でたどった時のノード番号のリスト
-  ) const;
+  /// @brief パタングラフ用の論理式のリストを返す．
+  ///
+  /// セルを持つ代表クラスとそのクラスに属する論理式のリストの対を
+  /// npn_class_list() の順に並べたもの．
+  vector<pair<const CiCellClass*, vector<Expr>>>
+  pat_expr_list() const;
 
 
 private:
@@ -187,9 +166,6 @@ private:
   // キーは ClibSeqAttr::index()
   std::unordered_map<SizeType, vector<const CiCellClass*>> mLatchClassDict;
 
-  // 一時的にパタンを保持するクラス
-  PatMgr mPatMgr;
-
 };
 
 END_NAMESPACE_YM_CLIB
@@ -13,11 +13,11 @@
 
 BEGIN_NAMESPACE_YM_CLIB
 
-class PatNode;
-
 //////////////////////////////////////////////////////////////////////
 /// @class PatHandle PatHandle.h "PatHandle.h"
 /// @brief PatNode と極性を表すクラス
+///
+/// ノードは PatMgr 内のノード番号で表す．
 //////////////////////////////////////////////////////////////////////
 class PatHandle
 {
@@ -26,11 +26,11 @@ public:
   /// @brief コンストラクタ
   explicit
   PatHandle(
-    PatNode* node = nullptr, ///< [in] ノード
-    bool inv = false         ///< [in] 反転属性
+    SizeType node_id = 0, ///< [in] ノード番号
+    bool inv = false      ///< [in] 反転属性
   )
   {
-    set(node, inv);
+    set(node_id, inv);
   }
 
   /// @brief デストラクタ
@@ -39,29 +39,35 @@ public:
 
 public:
 
-  /// @brief ノードを取り出す．
-  const PatNode&
-  node() const
+  /// @brief ノード番号を取り出す．
+  SizeType
+  node_id() const
   {
-    return *reinterpret_cast<PatNode*>(mData & ~1UL);
+    return mData >> 1;
   }
 
   /// @brief 反転属性を取り出す．
   bool
   inv() const
   {
-    return static_cast<bool>(mData & 1UL);
+    return static_cast<bool>(mData & 1U);
+  }
+
+  /// @brief ノード番号と反転属性を合わせた値を返す．
+  SizeType
+  key() const
+  {
+    return mData;
   }
 
   /// @brief 値を設定する．
   void
   set(
-    PatNode* node, ///< [in] ノード
-    bool inv         ///< [in] 反転属性
+    SizeType node_id, ///< [in] ノード番号
+    bool inv          ///< [in] 反転属性
   )
   {
-    // bool に対する & 1UL は不必要だが念のため．
-    mData = reinterpret_cast<PtrIntType>(node) | (static_cast<PtrIntType>(inv) & 1UL);
+    mData = (static_cast<std::uint32_t>(node_id) << 1) | (inv ? 1U : 0U);
   }
 
 
@@ -70,8 +76,8 @@ private:
   // データメンバ
   //////////////////////////////////////////////////////////////////////
 
-  // ポインタと反転属性を合わせたもの
-  PtrIntType mData;
+  // ノード番号と反転属性を合わせたもの
+  std::uint32_t mData;
 
 };
 
@@ -10,13 +10,15 @@
 
 #include "ym/clib.h"
 #include "ym/logic.h"
+#include "ym/ClibPatGenParam.h"
+#include "cgmgr/PatNode.h"
+#include "cgmgr/PatHandle.h"
+#include <deque>
 
 
 BEGIN_NAMESPACE_YM_CLIB
 
 class CiCellClass;
-class PatNode;
-class PatHandle;
 
 //////////////////////////////////////////////////////////////////////
 /// @class PatMgr PatMgr.h "PatMgr.h"
@@ -28,11 +30,17 @@ class PatMgr
 {
 public:
 
+  /// @brief 不正なノード番号
+  static constexpr std::uint32_t BAD_ID = 0xFFFFFFFFU;
+
   /// @brief コンストラクタ
-  PatMgr();
+  explicit
+  PatMgr(
+    double max_load = 0.5 ///< [in] ハッシュ表の最大負荷率 ( 0.0 < max_load < 1.0 )
+  );
 
   /// @brief デストラクタ
-  ~PatMgr();
+  ~PatMgr() = default;
 
 
 public:
@@ -44,6 +52,33 @@ public:
   void
   init();
 
+  /// @brief パタン生成の制限値を設定する．
+  ///
+  /// reg_pat() を呼ぶ前に設定しておく必要がある．
+  void
+  set_param(
+    const ClibPatGenParam& param ///< [in] 制限値
+  )
+  {
+    mParam = param;
+  }
+
+  /// @brief パタンから到達できないノードを削除する．
+  ///
+  /// 全ての論理式を登録した後で呼ぶ．
+  /// 残ったノードの順番は変わらない．
+  void
+  sweep();
+
+  /// @brief ハッシュ表の最大負荷率を設定する．
+  ///
+  /// 登録されているノード数が表のサイズ x max_load を超えると
+  /// 表を拡大する．
+  void
+  set_max_load(
+    double max_load ///< [in] 最大負荷率 ( 0.0 < max_load < 1.0 )
+  );
+
   /// @brief 論理式から生成されるパタンを登録する．
   void
   reg_pat(
@@ -51,6 +86,18 @@ public:
     const CiCellClass* rep_class ///< [in] このパタンが属する代表クラス
   );
 
+  /// @brief pg_sub() の結果を記憶するかどうかを設定する．(デバッグ用)
+  ///
+  /// 記憶しない場合も結果は変わらない．
+  /// init() では変更されない．
+  void
+  set_memoize(
+    bool flag ///< [in] 記憶する時 true
+  )
+  {
+    mMemoize = flag;
+  }
+
   /// @brief 内容を出力する．(デバッグ用)
   void
   display(
@@ -89,6 +136,18 @@ public:
     SizeType id                ///< [in] パタン番号 ( 0 <= id < pat_num() )
   ) const;
 
+  /// @brief 統計情報を返す．
+  ClibPatGenStats
+  stats() const;
+
+  /// @brief パタンの形状番号を返す．
+  ///
+  /// 入力番号の付け替えで一致するパタンは同じ番号を持つ．
+  SizeType
+  shape_id(
+    PatHandle handle ///< [in] パタンの根のハンドル
+  );
+
   /// @brief パタンのノードリストを返す．
   void
   get_pat_info(
@@ -103,37 +162,24 @@ private:
   // 下請け関数
   //////////////////////////////////////////////////////////////////////
 
-  /// @brief 2つの論理式が等しいかどうか調べる．
-  static
-  bool
-  check_equivalent(
-    const Expr& expr1,
-    const Expr& expr2
-  );
-
-  /// @brief 2つのパタンが同型かどうか調べる．
-  static
-  bool
-  check_equivalent(
-    PatHandle handle1,
-    PatHandle handle2
-  );
-
-  /// @brief check_equivalent の下請け関数
-  static
-  bool
-  ceq_sub(
-    const PatNode& node1,
-    const PatNode& node2,
-    unordered_map<SizeType, SizeType>& map1,
-    unordered_map<SizeType, SizeType>& map2
+  /// @brief パタングラフを生成する再帰関数
+  /// @return expr に対するパタンのリストを返す．
+  ///
+  /// 結果は論理式の構造をキーにして記憶しておき，
+  /// 同じ部分論理式に対しては再計算しない．
+  const vector<PatHandle>&
+  pg_sub(
+    const Expr& expr ///< [in] 元になる論理式
   );
 
-  /// @brief パタングラフを生成する再帰関数
+  /// @brief node_num 以降に作られたノードを削除する．
+  ///
+  /// ノード数の制限を超えた時に用いる．
+  /// 現在の reg_pat() で追加されたハッシュ表の要素と
+  /// 辞書の要素のみを取り除く．
   void
-  pg_sub(
-    const Expr& expr,            ///< [in] 元になる論理式
-    vector<PatHandle>& pg_list ///< [in] パタングラフ番号のリスト
+  rollback(
+    SizeType node_num ///< [in] 残すノード数
   );
 
   /// @brief テンプレートにしたがって2分木を作る．
@@ -146,9 +192,10 @@ private:
   );
 
   /// @brief 入力ノードを作る．
+  /// @return ノード番号を返す．
   ///
   /// 既にあるときはそれを返す．
-  PatNode*
+  SizeType
   make_input(
     SizeType var ///< [in] 入力変数
   );
@@ -162,7 +209,8 @@ private:
   );
 
   /// @brief ノードを作る．
-  PatNode*
+  /// @return ノード番号を返す．
+  SizeType
   new_node();
 
 
@@ -171,19 +219,56 @@ private:
   // ハッシュ表用の関数
   //////////////////////////////////////////////////////////////////////
 
-  /// @brief ハッシュ表を確保する．
+  /// @brief ハッシュ表を初期化する．
   void
-  alloc_table(
-    SizeType req_size ///< [in] サイズ
+  init_table();
+
+  /// @brief (type, l_id, r_id) のノードを探す．
+  /// @return ノード番号を返す．見つからなければ BAD_ID を返す．
+  SizeType
+  find_node(
+    SizeType type, ///< [in] 種類
+    SizeType l_id, ///< [in] 左の子供のノード番号
+    SizeType r_id  ///< [in] 右の子供のノード番号
+  ) const;
+
+  /// @brief ノードをハッシュ表に登録する．
+  ///
+  /// 必要ならば表を拡大して古い表からの移動を開始する．
+  void
+  reg_node(
+    SizeType id ///< [in] ノード番号
   );
 
-  /// @brief LcPatNode のハッシュ関数
+  /// @brief table にノードを挿入する．
+  void
+  insert_node(
+    vector<std::uint32_t>& table, ///< [in] 対象のハッシュ表
+    SizeType id                   ///< [in] ノード番号
+  );
+
+  /// @brief ハッシュ表からノードを削除する．
+  ///
+  /// 線形探索の鎖が切れないように後ろの要素を詰める．
+  /// 再ハッシュ中でないこと．
+  void
+  remove_node(
+    SizeType id ///< [in] ノード番号
+  );
+
+  /// @brief 古いハッシュ表の要素を新しい表に移す．
+  void
+  move_entries(
+    SizeType num ///< [in] 調べる古い表のスロット数
+  );
+
+  /// @brief PatNode のハッシュ関数
   static
   SizeType
   hash_func(
-    SizeType type,         ///< [in] 種類
-    const PatNode& l_node, ///< [in] 左の子供
-    const PatNode& r_node  ///< [in] 右の子供
+    SizeType type, ///< [in] 種類
+    SizeType l_id, ///< [in] 左の子供のノード番号
+    SizeType r_id  ///< [in] 右の子供のノード番号
   );
 
 
@@ -232,17 +317,31 @@ private:
   // データメンバ
   //////////////////////////////////////////////////////////////////////
 
-  // 入力ノードを収める配列
-  vector<PatNode*> mInputList;
+  // 入力ノードのノード番号を収める配列
+  vector<SizeType> mInputList;
 
   // 全ノードを収める配列
-  vector<unique_ptr<PatNode>> mNodeList;
+  // 配列のインデックスはノード番号
+  vector<PatNode> mNodeList;
 
   // AND/XOR ノードのハッシュ表
-  PatNode** mHashTable;
+  // オープンアドレス法(線形探索)を用いる．
+  // 要素はノード番号で，空きスロットは BAD_ID
+  vector<std::uint32_t> mHashTable;
+
+  // 再ハッシュ中の古いハッシュ表
+  // 表を拡大した時に一度に全て移すのではなく，
+  // ノードを登録するたびに少しずつ移す．
+  vector<std::uint32_t> mOldTable;
 
-  // mHashTable のサイズ
-  SizeType mHashSize;
+  // mOldTable 中で次に移すスロットの位置
+  SizeType mMovePos;
+
+  // ハッシュ表に登録されている要素数
+  SizeType mHashNum;
+
+  // ハッシュ表の最大負荷率
+  double mMaxLoad;
 
   // ハッシュ表を拡大する目安
   SizeType mNextLimit;
@@ -255,9 +354,66 @@ private:
   // 配列のインデックスはパタン番号
   vector<PatHandle> mPatList;
 
-  // 処理済みの論理式を収めたリストの配列の辞書
+  // パタン生成の制限値
+  ClibPatGenParam mParam;
+
+  // 統計情報
+  ClibPatGenStats mStats;
+
+  // 代表クラスごとのパタン数
+  unordered_map<const CiCellClass*, SizeType> mClassPatNum;
+
+  // ノード数の制限を超えたことを表すフラグ
+  bool mOverflow{false};
+
+  // mOverflow が立った時に pg_sub() が返す空のリスト
+  vector<PatHandle> mEmptyList;
+
+  // 処理済みの論理式の標準形を収めた集合の辞書
   // キーは代表クラス
-  unordered_map<const CiCellClass*, vector<Expr>> mExprListDict;
+  unordered_map<const CiCellClass*, unordered_set<string>> mExprKeyDict;
+
+  // pg_sub() の結果を記憶する時 true にするフラグ
+  bool mMemoize{true};
+
+  // pg_sub() の結果を保持する辞書
+  // キーは論理式の構造を表す文字列
+  unordered_map<string, vector<PatHandle>> mPgDict;
+
+  // 現在の reg_pat() で mPgDict に追加したキーのリスト
+  // rollback() で用いる．
+  vector<string> mNewPgKeyList;
+
+  // mMemoize が false の時に pg_sub() の結果を保持するリスト
+  // 参照を返すので要素のアドレスが変わらない std::deque を用いる．
+  std::deque<vector<PatHandle>> mPgList;
+
+  // パタンの形状シグネチャ用のハッシュ関数
+  struct SigHash
+  {
+    SizeType
+    operator()(
+      const vector<SizeType>& sig
+    ) const
+    {
+      SizeType h = 0;
+      for ( auto v: sig ) {
+        h = h * 1021 + v;
+      }
+      return h;
+    }
+  };
+
+  // 形状シグネチャをキーにして形状番号を保持する辞書
+  unordered_map<vector<SizeType>, SizeType, SigHash> mShapeDict;
+
+  // パタンの根のハンドル(ノード番号 x 2 + 反転属性)をキーにして
+  // 形状番号を保持する辞書
+  unordered_map<SizeType, SizeType> mShapeIdDict;
+
+  // 現在の reg_pat() で mShapeIdDict に追加したキーのリスト
+  // rollback() で用いる．
+  vector<SizeType> mNewShapeKeyList;
 
 };
 
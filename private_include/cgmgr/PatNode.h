@@ -18,6 +18,9 @@ class PatMgr;
 //////////////////////////////////////////////////////////////////////
 /// @class PatNode PatNode.h "PatNode.h"
 /// @brief パタン生成用のノードを表すクラス
+///
+/// PatMgr の中で連続した配列に格納されるので，
+/// ファンインはポインタではなく32ビットのノード番号で表す．
 //////////////////////////////////////////////////////////////////////
 class PatNode
 {
@@ -28,11 +31,10 @@ public:
   /// @brief コンストラクタ
   explicit
   PatNode(
-    SizeType id ///< [in] ID番号
-  ) : mId{id},
+    SizeType id = 0 ///< [in] ID番号
+  ) : mId{static_cast<std::uint32_t>(id)},
       mType{0U},
-      mFanin{nullptr, nullptr},
-      mLink{nullptr}
+      mFanin{0U, 0U}
   {
   }
 
@@ -77,28 +79,28 @@ public:
     return mType >> 2;
   }
 
-  /// @brief AND/XOR の時にファンインのノードを返す．
-  const PatNode&
-  fanin(
+  /// @brief AND/XOR の時にファンインのノード番号を返す．
+  SizeType
+  fanin_id(
     SizeType pos ///< [in] 位置 ( 0 or 1 )
   ) const
   {
     ASSERT_COND( pos == 0 || pos == 1 );
-    return *mFanin[pos];
+    return mFanin[pos];
   }
 
-  /// @brief AND/XOR の時にファンイン0のノードを返す．
-  const PatNode&
-  fanin0() const
+  /// @brief AND/XOR の時にファンイン0のノード番号を返す．
+  SizeType
+  fanin0_id() const
   {
-    return *mFanin[0];
+    return mFanin[0];
   }
 
-  /// @brief AND/XOR の時にファンイン1のノードを返す．
-  const PatNode&
-  fanin1() const
+  /// @brief AND/XOR の時にファンイン1のノード番号を返す．
+  SizeType
+  fanin1_id() const
   {
-    return *mFanin[1];
+    return mFanin[1];
   }
 
   /// @brief AND/XOR の時にファンインの極性を返す．
@@ -150,19 +152,16 @@ private:
   //////////////////////////////////////////////////////////////////////
 
   // ノード番号
-  SizeType mId;
+  std::uint32_t mId;
 
   // ノードの種類 ( 2bit )
   //  + 入力番号 ( 30bit)
   // or
   //  + ファンインの極性 ( 1bit x 2)
-  SizeType mType;
-
-  // ファンインのノード
-  const PatNode* mFanin[2];
+  std::uint32_t mType;
 
-  // ハッシュ表中のリンク
-  PatNode* mLink;
+  // ファンインのノード番号
+  std::uint32_t mFanin[2];
 
 };
 
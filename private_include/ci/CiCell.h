@@ -16,7 +16,10 @@
 #include "ci/CiBus.h"
 #include "ci/CiBundle.h"
 #include "ci/CiTiming.h"
+#include "ci/CiInternalPower.h"
+#include "ci/CiLeakageTable.h"
 #include "ci/conv_list.h"
+#include <string_view>
 
 
 BEGIN_NAMESPACE_YM_CLIB
@@ -147,6 +150,24 @@ public:
     return mArea;
   }
 
+  /// @brief 親のグループ内で指定された基準で並べた時の位置を返す．
+  SizeType
+  group_order_pos(
+    ClibCellOrder order ///< [in] 並べる基準
+  ) const
+  {
+    return mOrderPos[static_cast<SizeType>(order)];
+  }
+
+  /// @brief 親のクラス内で指定された基準で並べた時の位置を返す．
+  SizeType
+  class_order_pos(
+    ClibCellOrder order ///< [in] 並べる基準
+  ) const
+  {
+    return mOrderPos[static_cast<SizeType>(order) + 3];
+  }
+
 
 public:
   //////////////////////////////////////////////////////////////////////
@@ -184,12 +205,31 @@ public:
     return mPinList[pos].get();
   }
 
+  /// @brief 名前からピンの取得
+  ///
+  /// なければ nullptr を返す．
+  const CiPin*
+  find_pin(
+    std::string_view name ///< [in] ピン名
+  ) const;
+
   /// @brief 名前からピンの取得
   ///
   /// なければ nullptr を返す．
   const CiPin*
   find_pin(
     const ShString& name ///< [in] ピン名
+  ) const
+  {
+    return find_pin(std::string_view{static_cast<const char*>(name)});
+  }
+
+  /// @brief 名前のリストからピン番号のリストを得る．
+  ///
+  /// 見つからなかった名前に対応する要素は CLIB_NULLID となる．
+  vector<SizeType>
+  pin_id_list(
+    const vector<string>& name_list ///< [in] ピン名のリスト
   ) const;
 
   /// @brief ピンのリストの取得
@@ -421,6 +461,119 @@ public:
   }
 
 
+public:
+  //////////////////////////////////////////////////////////////////////
+  // 電力情報の取得
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief 内部電力の数を返す．
+  SizeType
+  internal_power_num() const
+  {
+    return mInternalPowerList.size();
+  }
+
+  /// @brief 内部電力を返す．
+  const CiInternalPower*
+  internal_power(
+    SizeType pos ///< [in] 位置番号 ( 0 <= pos < internal_power_num() )
+  ) const
+  {
+    ASSERT_COND( 0 <= pos && pos < internal_power_num() );
+    return mInternalPowerList[pos].get();
+  }
+
+  /// @brief 内部電力のリストを返す．
+  vector<const CiInternalPower*>
+  internal_power_list() const
+  {
+    return conv_list(mInternalPowerList);
+  }
+
+  /// @brief セル全体のリーク電力を返す．
+  double
+  cell_leakage_power() const
+  {
+    return mCellLeakagePower;
+  }
+
+  /// @brief 条件付きのリーク電力の数を返す．
+  SizeType
+  leakage_power_num() const
+  {
+    return mLeakagePowerValueList.size();
+  }
+
+  /// @brief 条件付きのリーク電力の条件式を返す．
+  ///
+  /// 条件がない場合には定数1の式を返す．
+  Expr
+  leakage_power_when(
+    SizeType pos ///< [in] 位置番号 ( 0 <= pos < leakage_power_num() )
+  ) const
+  {
+    ASSERT_COND( 0 <= pos && pos < leakage_power_num() );
+    return mLeakagePowerWhenList[pos];
+  }
+
+  /// @brief 条件付きのリーク電力の値を返す．
+  double
+  leakage_power_value(
+    SizeType pos ///< [in] 位置番号 ( 0 <= pos < leakage_power_num() )
+  ) const
+  {
+    ASSERT_COND( 0 <= pos && pos < leakage_power_num() );
+    return mLeakagePowerValueList[pos];
+  }
+
+  /// @brief リーク電力の評価に用いる入力数を返す．
+  ///
+  /// 通常は input2_num() と等しいが，条件式が内部状態変数を
+  /// 参照している場合にはそれを含む．
+  SizeType
+  leakage_input_num() const
+  {
+    return std::max(input2_num(), mLeakageTable.input_num());
+  }
+
+  /// @brief 条件付きのリーク電力の条件式のビットマスクを返す．
+  vector<std::uint64_t>
+  leakage_power_when_mask(
+    SizeType pos ///< [in] 位置番号 ( 0 <= pos < leakage_power_num() )
+  ) const
+  {
+    ASSERT_COND( 0 <= pos && pos < leakage_power_num() );
+    return mLeakageTable.when_mask(pos);
+  }
+
+  /// @brief 入力状態に対するリーク電力を返す．
+  double
+  calc_leakage_power(
+    std::uint64_t state ///< [in] 入力状態
+  ) const
+  {
+    return mLeakageTable.value(state);
+  }
+
+  /// @brief 入力状態のリストに対するリーク電力のリストを返す．
+  vector<double>
+  calc_leakage_power_list(
+    const vector<std::uint64_t>& state_list ///< [in] 入力状態のリスト
+  ) const
+  {
+    return mLeakageTable.value_list(state_list);
+  }
+
+  /// @brief 入力の信号確率に対するリーク電力の期待値を返す．
+  double
+  calc_average_leakage_power(
+    const vector<double>& prob_list ///< [in] 各入力が1となる確率のリスト
+  ) const
+  {
+    return mLeakageTable.average_value(prob_list);
+  }
+
+
 public:
   //////////////////////////////////////////////////////////////////////
   /// @name 機能情報の取得
@@ -559,6 +712,24 @@ public:
     mGroup = group;
   }
 
+  /// @brief ピン名の表を作る．
+  ///
+  /// 全てのピンを追加した後に呼ぶ必要がある．
+  void
+  make_pin_table();
+
+  /// @brief 並べた時の位置を設定する．
+  void
+  set_order_pos(
+    ClibCellOrder order, ///< [in] 並べる基準
+    SizeType group_pos,  ///< [in] グループ内の位置
+    SizeType class_pos   ///< [in] クラス内の位置
+  )
+  {
+    mOrderPos[static_cast<SizeType>(order)] = group_pos;
+    mOrderPos[static_cast<SizeType>(order) + 3] = class_pos;
+  }
+
   /// @brief 入力ピンを追加する．
   CiPin*
   add_input(
@@ -728,6 +899,49 @@ public:
     const vector<const CiTiming*>& timing_list ///< [in] 設定するタイミング番号のリスト
   );
 
+  /// @brief 内部電力を追加する．
+  /// @return 生成された内部電力を返す．
+  CiInternalPower*
+  add_internal_power(
+    const CiPin* pin,               ///< [in] 対象のピン
+    const CiPin* related_pin,       ///< [in] 関連するピン
+    const Expr& when,               ///< [in] 条件式
+    unique_ptr<CiLut>&& rise_power, ///< [in] 立ち上がり時のエネルギーテーブル
+    unique_ptr<CiLut>&& fall_power  ///< [in] 立ち下がり時のエネルギーテーブル
+  );
+
+  /// @brief セル全体のリーク電力を設定する．
+  ///
+  /// 評価用の表は build_leakage_table() で作る．
+  void
+  set_cell_leakage_power(
+    double value ///< [in] 値
+  )
+  {
+    mCellLeakagePower = value;
+  }
+
+  /// @brief 条件付きのリーク電力を追加する．
+  ///
+  /// 評価用の表は build_leakage_table() で作る．
+  void
+  add_leakage_power(
+    const Expr& when, ///< [in] 条件式
+    double value      ///< [in] 値
+  )
+  {
+    mLeakagePowerWhenList.push_back(when);
+    mLeakagePowerValueList.push_back(value);
+  }
+
+  /// @brief リーク電力の評価用の表を作る．
+  ///
+  /// 表の大きさは入力数の指数となるので，全ての leakage_power を
+  /// 追加した後に一度だけ呼ぶ．
+  /// CiCellLibrary::wrap_up() から呼ばれる．
+  void
+  build_leakage_table();
+
 
 public:
   //////////////////////////////////////////////////////////////////////
@@ -830,6 +1044,31 @@ private:
   // サイズは(入力数＋入出力数) x (出力数+入出力数)  x 2
   vector<vector<const CiTiming*>> mTimingMap;
 
+  // 内部電力のリスト
+  vector<unique_ptr<CiInternalPower>> mInternalPowerList;
+
+  // セル全体のリーク電力
+  double mCellLeakagePower{0.0};
+
+  // 条件付きのリーク電力の条件式のリスト
+  vector<Expr> mLeakagePowerWhenList;
+
+  // 条件付きのリーク電力の値のリスト
+  // サイズは mLeakagePowerWhenList と等しい．
+  vector<double> mLeakagePowerValueList;
+
+  // リーク電力の評価用の表
+  // 上の3つから作られるのでダンプはしない．
+  CiLeakageTable mLeakageTable;
+
+  // ピン名とピン番号の対を名前順に並べた表
+  // 名前は ShString の文字列を指している．
+  vector<pair<std::string_view, SizeType>> mPinTable;
+
+  // 並べた時の位置
+  // 前半の3つがグループ内，後半の3つがクラス内の位置
+  SizeType mOrderPos[6]{0, 0, 0, 0, 0, 0};
+
 };
 
 END_NAMESPACE_YM_CLIB
@@ -17,6 +17,7 @@ BEGIN_NAMESPACE_YM_CLIB
 
 class CiCellLibrary;
 class CiCellClass;
+class CiCell;
 class Serializer;
 class Deserializer;
 
@@ -106,6 +107,49 @@ public:
   }
 
 
+public:
+  //////////////////////////////////////////////////////////////////////
+  // セルを並べたリストに関する関数
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief 指定された基準で昇順に並べたセルのリストを返す．
+  const vector<const CiCell*>&
+  sorted_cell_list(
+    ClibCellOrder order ///< [in] 並べる基準
+  ) const
+  {
+    return mSortedList[static_cast<SizeType>(order)];
+  }
+
+  /// @brief 指定された基準で一つ後ろのセルを返す．
+  ///
+  /// cell が最後の場合は nullptr を返す．
+  const CiCell*
+  next_cell(
+    const CiCell* cell, ///< [in] 基準となるセル
+    ClibCellOrder order ///< [in] 並べる基準
+  ) const;
+
+  /// @brief 指定された基準で一つ前のセルを返す．
+  ///
+  /// cell が先頭の場合は nullptr を返す．
+  const CiCell*
+  prev_cell(
+    const CiCell* cell, ///< [in] 基準となるセル
+    ClibCellOrder order ///< [in] 並べる基準
+  ) const;
+
+  /// @brief 指定された基準で並べたセルのリストを設定する．
+  void
+  set_sorted_list(
+    ClibCellOrder order,            ///< [in] 並べる基準
+    const vector<const CiCell*>& cell_list ///< [in] 並べたセルのリスト
+  )
+  {
+    mSortedList[static_cast<SizeType>(order)] = cell_list;
+  }
+
+
 public:
   //////////////////////////////////////////////////////////////////////
   // dump/restore 関数
@@ -181,6 +225,10 @@ private:
   // セルのリスト
   vector<const CiCell*> mCellList;
 
+  // ClibCellOrder ごとに並べたセルのリスト
+  // restore() の後で作り直されるのでダンプはしない．
+  vector<const CiCell*> mSortedList[3];
+
 };
 
 END_NAMESPACE_YM_CLIB
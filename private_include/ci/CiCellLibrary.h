@@ -13,13 +13,21 @@
 #include "ym/ClibCapacitance.h"
 #include "ym/ClibResistance.h"
 #include "ym/ShString.h"
+#include "ym/ClibPatGenParam.h"
+#include "ym/ClibLoadProfile.h"
 #include "ym/logic.h"
+#include "ym/Expr.h"
+#include "ym/TvFunc.h"
 #include "ci/CiPatMgr.h"
 #include "ci/CiCellNameHash.h"
 #include "ci/CiPin.h"
 #include "ci/CiBus.h"
 #include "ci/CiBundle.h"
+#include "ci/CiOperatingConditions.h"
 #include "ci/conv_list.h"
+#include <atomic>
+#include <mutex>
+#include <string_view>
 
 
 BEGIN_NAMESPACE_YM_CLIB
@@ -29,8 +37,11 @@ class CiCell;
 class CiCellClass;
 class CiCellGroup;
 class CiInternalPin;
+class CiLoadProfiler;
 class CiLutTemplate;
 class CiTiming;
+class CiWireLoad;
+class CiWireLoadSelection;
 class Serializer;
 
 //////////////////////////////////////////////////////////////////////
@@ -62,17 +73,42 @@ public:
   static
   CiCellLibrary*
   read_mislib(
-    const string& filename ///< [in] ファイル名
+    const string& filename,      ///< [in] ファイル名
+    const ClibPatGenParam& param ///< [in] パタングラフ生成の制限値
   );
 
   /// @brief liberty 形式のファイルを読み込む．
   /// @return 生成したライブラリを返す．
+  ///
+  /// profile が nullptr でない場合には各フェーズの計測結果を記録する．
   static
   CiCellLibrary*
   read_liberty(
-    const string& filename ///< [in] ファイル名
+    const string& filename,              ///< [in] ファイル名
+    const ClibPatGenParam& param,        ///< [in] パタングラフ生成の制限値
+    ClibLoadProfile* profile = nullptr   ///< [out] 計測結果
   );
 
+  /// @brief 読み込み処理の排他制御に用いる mutex を返す．
+  ///
+  /// ShString の文字列プールと MsgMgr はスレッドセーフではないので
+  /// read_mislib()，read_liberty()，restore() および subset() の
+  /// これらを用いる部分はこれを獲得して一度に一つずつ実行される．
+  /// read_liberty() ではファイルの読み込み，compile() および
+  /// wrap_up() はこの外で行われる．
+  static
+  std::mutex&
+  reader_mutex();
+
+  /// @brief 指定されたセルのみを含む部分ライブラリを作る．
+  /// @return 生成したライブラリを返す．
+  ///
+  /// 存在しない名前が含まれていた場合は std::invalid_argument 例外を送出する．
+  CiCellLibrary*
+  subset(
+    const vector<string>& cell_names ///< [in] 残すセル名のリスト
+  ) const;
+
 
 public:
   //////////////////////////////////////////////////////////////////////
@@ -201,6 +237,208 @@ public:
   }
 
 
+public:
+  //////////////////////////////////////////////////////////////////////
+  // ワイヤーロード関係の情報の取得
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief ワイヤーロード数の取得
+  ///
+  /// wire_load と wire_load_table の両方を含む．
+  SizeType
+  wire_load_num() const
+  {
+    return mWireLoadList.size();
+  }
+
+  /// @brief ワイヤーロードの取得
+  const CiWireLoad*
+  wire_load(
+    SizeType pos ///< [in] 位置番号 ( 0 <= pos < wire_load_num() )
+  ) const
+  {
+    ASSERT_COND( 0 <= pos && pos < wire_load_num() );
+    return mWireLoadList[pos].get();
+  }
+
+  /// @brief 名前からワイヤーロードを取得する．
+  ///
+  /// なければ nullptr を返す．
+  const CiWireLoad*
+  wire_load(
+    std::string_view name ///< [in] 名前
+  ) const
+  {
+    auto p = mWireLoadDict.find(name);
+    if ( p == mWireLoadDict.end() ) {
+      return nullptr;
+    }
+    return p->second;
+  }
+
+  /// @brief ワイヤーロードセレクション数の取得
+  SizeType
+  wire_load_selection_num() const
+  {
+    return mWireLoadSelectionList.size();
+  }
+
+  /// @brief ワイヤーロードセレクションの取得
+  const CiWireLoadSelection*
+  wire_load_selection(
+    SizeType pos ///< [in] 位置番号 ( 0 <= pos < wire_load_selection_num() )
+  ) const
+  {
+    ASSERT_COND( 0 <= pos && pos < wire_load_selection_num() );
+    return mWireLoadSelectionList[pos].get();
+  }
+
+  /// @brief 名前からワイヤーロードセレクションを取得する．
+  ///
+  /// なければ nullptr を返す．
+  const CiWireLoadSelection*
+  wire_load_selection(
+    std::string_view name ///< [in] 名前
+  ) const;
+
+  /// @brief デフォルトのワイヤーロードの取得
+  ///
+  /// 指定されていない場合は nullptr を返す．
+  const CiWireLoad*
+  default_wire_load() const
+  {
+    return mDefaultWireLoad;
+  }
+
+  /// @brief デフォルトのワイヤーロードセレクションの取得
+  ///
+  /// 'default_wire_load_selection' で指定されたものを返す．
+  /// 指定がなく，ワイヤーロードセレクションが一つだけの場合にはそれを返す．
+  /// それ以外の場合は nullptr を返す．
+  const CiWireLoadSelection*
+  default_wire_load_selection() const
+  {
+    return mDefaultWireLoadSelection;
+  }
+
+  /// @brief 面積からワイヤーロードを選ぶ．
+  ///
+  /// デフォルトのワイヤーロードセレクションを用いる．
+  /// 該当するものがない場合はデフォルトのワイヤーロードを返す．
+  const CiWireLoad*
+  select_wire_load(
+    double area ///< [in] 面積
+  ) const;
+
+  /// @brief 'default_wire_load_mode' の取得
+  string
+  default_wire_load_mode() const
+  {
+    return mDefaultWireLoadMode;
+  }
+
+  /// @brief 'default_wire_load_area' の取得
+  double
+  default_wire_load_area() const
+  {
+    return mDefaultWireLoadArea;
+  }
+
+  /// @brief 'default_wire_load_capacitance' の取得
+  double
+  default_wire_load_capacitance() const
+  {
+    return mDefaultWireLoadCapacitance;
+  }
+
+  /// @brief 'default_wire_load_resistance' の取得
+  double
+  default_wire_load_resistance() const
+  {
+    return mDefaultWireLoadResistance;
+  }
+
+
+public:
+  //////////////////////////////////////////////////////////////////////
+  // 動作条件関係の情報の取得
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief 'nom_process' の取得
+  double
+  nom_process() const
+  {
+    return mNomProcess;
+  }
+
+  /// @brief 'nom_temperature' の取得
+  double
+  nom_temperature() const
+  {
+    return mNomTemperature;
+  }
+
+  /// @brief 'nom_voltage' の取得
+  double
+  nom_voltage() const
+  {
+    return mNomVoltage;
+  }
+
+  /// @brief k_process_XXX/k_temp_XXX/k_volt_XXX の値を返す．
+  ///
+  /// 指定されていない場合は 0.0 を返す．
+  double
+  k_factor(
+    const string& name ///< [in] 属性名 ( "k_process_cell_rise" など )
+  ) const
+  {
+    auto p = mKFactorDict.find(name);
+    if ( p == mKFactorDict.end() ) {
+      return 0.0;
+    }
+    return p->second;
+  }
+
+  /// @brief 動作条件数の取得
+  SizeType
+  operating_conditions_num() const
+  {
+    return mOperatingConditionsList.size();
+  }
+
+  /// @brief 動作条件の取得
+  const CiOperatingConditions*
+  operating_conditions(
+    SizeType pos ///< [in] 位置番号 ( 0 <= pos < operating_conditions_num() )
+  ) const
+  {
+    ASSERT_COND( 0 <= pos && pos < operating_conditions_num() );
+    return &mOperatingConditionsList[pos];
+  }
+
+  /// @brief 名前から動作条件を取得する．
+  ///
+  /// なければ nullptr を返す．
+  const CiOperatingConditions*
+  operating_conditions(
+    std::string_view name ///< [in] 名前
+  ) const;
+
+  /// @brief デフォルトの動作条件を返す．
+  ///
+  /// 'default_operating_conditions' で指定されたものを返す．
+  /// 指定されていない場合は nullptr を返す．
+  const CiOperatingConditions*
+  default_operating_conditions() const
+  {
+    if ( mDefaultOperatingConditions == CLIB_NULLID ) {
+      return nullptr;
+    }
+    return &mOperatingConditionsList[mDefaultOperatingConditions];
+  }
+
+
 public:
   //////////////////////////////////////////////////////////////////////
   // セル情報の取得
@@ -224,24 +462,45 @@ public:
   }
 
   /// @brief 名前からのセルの取得
+  ///
+  /// ShString を作らないので見つからなかった名前が
+  /// 文字列プールに登録されることはない．
+  /// なければ nullptr を返す．
   const CiCell*
   cell(
-    const string& name
+    std::string_view name ///< [in] セル名
   ) const
   {
-    return cell(ShString{name});
+    auto p = mCellDict.find(name);
+    if ( p == mCellDict.end() ) {
+      return nullptr;
+    }
+    return p->second;
   }
 
   /// @brief 名前からのセルの取得
   const CiCell*
   cell(
-    const ShString& name
+    const ShString& name ///< [in] セル名
+  ) const
+  {
+    return cell(std::string_view{static_cast<const char*>(name)});
+  }
+
+  /// @brief 名前のリストからセルのリストを得る．
+  ///
+  /// 見つからなかった名前に対応する要素は nullptr となる．
+  vector<const CiCell*>
+  cell_list(
+    const vector<string>& name_list ///< [in] セル名のリスト
   ) const
   {
-    if ( mCellDict.count(name) > 0 ) {
-      return mCellDict.at(name);
+    vector<const CiCell*> ans;
+    ans.reserve(name_list.size());
+    for ( auto& name: name_list ) {
+      ans.push_back(cell(std::string_view{name}));
     }
-    return nullptr;
+    return ans;
   }
 
   /// @brief セルのリストの取得
@@ -450,15 +709,56 @@ public:
   ) const;
 
 
+public:
+  //////////////////////////////////////////////////////////////////////
+  // 論理関数によるセルグループ/セルクラスの検索
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief 論理関数に一致するセルグループを返す．
+  ///
+  /// 1出力で tristate 条件を持たない論理セルのグループのうち，
+  /// セルを持つものが対象となる．
+  /// 見つからない場合は nullptr を返す．
+  const CiCellGroup*
+  find_logic_group(
+    const TvFunc& func ///< [in] 論理関数
+  ) const
+  {
+    auto p = mLogicGroupDict.find(func);
+    if ( p == mLogicGroupDict.end() ) {
+      return nullptr;
+    }
+    return p->second;
+  }
+
+  /// @brief 論理関数と NPN 同値なセルクラスを返す．
+  ///
+  /// 見つからない場合は nullptr を返す．
+  const CiCellClass*
+  find_logic_class(
+    const TvFunc& func, ///< [in] 論理関数
+    ClibIOMap& iomap    ///< [out] func から代表関数への変換マップ
+  ) const;
+
+
 public:
   //////////////////////////////////////////////////////////////////////
   // パタングラフ関係の情報の取得
   //////////////////////////////////////////////////////////////////////
 
+  /// @brief パタングラフ生成の統計情報を返す．
+  ClibPatGenStats
+  pg_stats() const
+  {
+    _build_pg();
+    return mPgStats;
+  }
+
   /// @brief 総パタン数を返す．
   SizeType
   pg_pat_num() const
   {
+    _build_pg();
     return mPatMgr.pat_num();
   }
 
@@ -466,6 +766,7 @@ public:
   SizeType
   pg_max_input() const
   {
+    _build_pg();
     return mPatMgr.max_input();
   }
 
@@ -473,6 +774,7 @@ public:
   SizeType
   pg_node_num() const
   {
+    _build_pg();
     return mPatMgr.node_num();
   }
 
@@ -482,6 +784,7 @@ public:
     SizeType id ///< [in] ノード番号 ( 0 <= id < pg_node_num() )
   ) const
   {
+    _build_pg();
     return mPatMgr.node_type(id);
   }
 
@@ -493,6 +796,7 @@ public:
     SizeType id ///< [in] ノード番号 ( 0 <= id < pg_node_num() )
   ) const
   {
+    _build_pg();
     return mPatMgr.input_id(id);
   }
 
@@ -502,6 +806,7 @@ public:
     SizeType input_id ///< [in] 入力番号 ( 0 <= input_id < pg_max_input() )
   ) const
   {
+    _build_pg();
     return mPatMgr.input_node(input_id);
   }
 
@@ -509,6 +814,7 @@ public:
   SizeType
   pg_edge_num() const
   {
+    _build_pg();
     return mPatMgr.edge_num();
   }
 
@@ -518,6 +824,7 @@ public:
     SizeType id ///< [in] 枝番号 ( 0 <= id < pg_edge_num() )
   ) const
   {
+    _build_pg();
     return mPatMgr.edge_from(id);
   }
 
@@ -527,6 +834,7 @@ public:
     SizeType id ///< [in] 枝番号 ( 0 <= id < pg_edge_num() )
   ) const
   {
+    _build_pg();
     return mPatMgr.edge_to(id);
   }
 
@@ -536,6 +844,7 @@ public:
     SizeType id ///< [in] 枝番号 ( 0 <= id < pg_edge_num() )
   ) const
   {
+    _build_pg();
     return mPatMgr.edge_pos(id);
   }
 
@@ -545,9 +854,71 @@ public:
     SizeType id ///< [in] 枝番号 ( 0 <= id < pg_edge_num() )
   ) const
   {
+    _build_pg();
     return mPatMgr.edge_inv(id);
   }
 
+  /// @brief ノードの深さを返す．
+  SizeType
+  pg_node_depth(
+    SizeType id ///< [in] ノード番号 ( 0 <= id < pg_node_num() )
+  ) const
+  {
+    _build_pg();
+    return mPatMgr.node_depth(id);
+  }
+
+  /// @brief パタンの最大の深さを返す．
+  SizeType
+  pg_max_depth() const
+  {
+    _build_pg();
+    return mPatMgr.max_depth();
+  }
+
+  /// @brief パタンの論理関数を返す．
+  const TvFunc&
+  pg_pat_func(
+    SizeType id ///< [in] パタン番号 ( 0 <= id < pg_pat_num() )
+  ) const
+  {
+    _build_pg();
+    return mPatMgr.pat_func(id);
+  }
+
+  /// @brief 根の種類，深さ，入力数からパタン番号のリストを返す．
+  const vector<SizeType>&
+  pg_pat_list(
+    ClibPatType root_type, ///< [in] 根のノードの種類
+    SizeType depth,        ///< [in] 深さ
+    SizeType input_num     ///< [in] 入力数
+  ) const
+  {
+    _build_pg();
+    return mPatMgr.find_pat_list(root_type, depth, input_num);
+  }
+
+  /// @brief パタンの論理関数から NPN 正規形への変換マップを返す．
+  const ClibIOMap&
+  pg_pat_map(
+    SizeType id ///< [in] パタン番号 ( 0 <= id < pg_pat_num() )
+  ) const
+  {
+    _build_pg();
+    return mPatMgr.pat_map(id);
+  }
+
+  /// @brief 論理関数と NPN 同値なパタン番号のリストを返す．
+  const vector<SizeType>&
+  pg_pat_list(
+    const TvFunc& func, ///< [in] 論理関数
+    ClibIOMap& iomap    ///< [out] func から NPN 正規形への変換マップ
+  ) const
+  {
+    _build_pg();
+    return mPatMgr.find_pat_list(func, iomap);
+  }
+
 
 public:
   //////////////////////////////////////////////////////////////////////
@@ -642,14 +1013,36 @@ public:
     const string& value      ///< [in] 値
   );
 
+  /// @brief パタングラフ生成の制限値を設定する．
+  ///
+  /// compile() の前に設定しておく必要がある．
+  void
+  set_pg_param(
+    const ClibPatGenParam& param ///< [in] 制限値
+  )
+  {
+    mPgParam = param;
+  }
+
   /// @brief 設定後の最終処理を行う．
   void
   wrap_up();
 
   /// @brief セルグループ/セルクラスの設定を行なう．
+  ///
+  /// パタングラフはここでは作らずに，最初に参照された時に作る．
   void
   compile();
 
+  /// @brief 計測を行いながらセルグループ/セルクラスの設定を行なう．
+  ///
+  /// 計測を行う場合にはパタングラフの生成時間も計測するために
+  /// パタングラフをここで作る．
+  void
+  compile(
+    CiLoadProfiler& profiler ///< [in] 計測器
+  );
+
 
 public:
   //////////////////////////////////////////////////////////////////////
@@ -683,6 +1076,44 @@ public:
     const vector<double>& index_list3
   );
 
+  /// @brief wire_load を追加する．
+  CiWireLoad*
+  add_wire_load(
+    const ShString& name,                                    ///< [in] 名前
+    double resistance,                                       ///< [in] 単位長あたりの抵抗
+    double capacitance,                                      ///< [in] 単位長あたりの容量
+    double area,                                             ///< [in] 単位長あたりの面積
+    double slope,                                            ///< [in] 外挿用の傾き
+    const vector<pair<SizeType, double>>& fanout_length_list ///< [in] fanout_length のリスト
+  );
+
+  /// @brief wire_load_table を追加する．
+  CiWireLoad*
+  add_wire_load_table(
+    const ShString& name,                                          ///< [in] 名前
+    const vector<pair<SizeType, double>>& fanout_length_list,      ///< [in] fanout_length のリスト
+    const vector<pair<SizeType, double>>& fanout_capacitance_list, ///< [in] fanout_capacitance のリスト
+    const vector<pair<SizeType, double>>& fanout_resistance_list,  ///< [in] fanout_resistance のリスト
+    const vector<pair<SizeType, double>>& fanout_area_list         ///< [in] fanout_area のリスト
+  );
+
+  /// @brief wire_load_selection を追加する．
+  CiWireLoadSelection*
+  add_wire_load_selection(
+    const ShString& name,                                              ///< [in] 名前
+    const vector<tuple<double, double, const CiWireLoad*>>& entry_list ///< [in] (下限, 上限, ワイヤーロード) のリスト
+  );
+
+  /// @brief operating_conditions を追加する．
+  void
+  add_operating_conditions(
+    const ShString& name,     ///< [in] 名前
+    double process,           ///< [in] プロセス係数
+    double temperature,       ///< [in] 温度
+    double voltage,           ///< [in] 電圧
+    const ShString& tree_type ///< [in] 配線の RC ツリーの種類
+  );
+
   /// @brief セルクラスを作る．
   CiCellClass*
   add_cell_class(
@@ -804,9 +1235,26 @@ public:
     SizeType id ///< [in] ID番号
   ) const
   {
+    _build_pg();
     return &mPatMgr.pat(id);
   }
 
+  /// @brief パタングラフが作られていなければ作る．
+  ///
+  /// 複数のスレッドから同時に呼ばれても一度だけ実行される．
+  void
+  _build_pg() const
+  {
+    std::call_once(mPgOnce, [this]() { _gen_pg(); });
+  }
+
+  /// @brief パタングラフを作る．
+  ///
+  /// compile() で記録しておいた論理式からパタングラフを作る．
+  /// _build_pg() からのみ呼ばれる．
+  void
+  _gen_pg() const;
+
 
 private:
   //////////////////////////////////////////////////////////////////////
@@ -819,12 +1267,38 @@ private:
     Serializer& s ///< [in] シリアライザ
   ) const;
 
+  /// @brief ワイヤーロード関係の情報をダンプする．
+  ///
+  /// 要素は serialize() で登録済みでなければならない．
+  void
+  dump_wire_load(
+    Serializer& s ///< [in] シリアライザ
+  ) const;
+
+  /// @brief 動作条件関係の情報をダンプする．
+  void
+  dump_operating_conditions(
+    Serializer& s ///< [in] シリアライザ
+  ) const;
+
 
 private:
   //////////////////////////////////////////////////////////////////////
   // restore で用いられる関数
   //////////////////////////////////////////////////////////////////////
 
+  /// @brief ワイヤーロード関係の情報を読み込む．
+  void
+  restore_wire_load(
+    Deserializer& s ///< [in] デシリアライザ
+  );
+
+  /// @brief 動作条件関係の情報を読み込む．
+  void
+  restore_operating_conditions(
+    Deserializer& s ///< [in] デシリアライザ
+  );
+
   /// @brief 'capacitive_load_unit' を読み込む．
   void
   restore_capacitive_load_unit(
@@ -837,18 +1311,6 @@ public:
   // ピンハッシュ用の関数
   //////////////////////////////////////////////////////////////////////
 
-  /// @brief ピン名からピンを取り出す．
-  ///
-  /// 見つからない場合は nullptr を返す．
-  const CiPin*
-  find_pin(
-    const CiCell* cell, ///< [in] セル
-    ShString name       ///< [in] ピン名
-  ) const
-  {
-    return mPinDict.get(cell, name);
-  }
-
   /// @brief バス名からバスを取り出す．
   ///
   /// 見つからない場合は nullptr を返す．
@@ -883,6 +1345,14 @@ private:
   void
   clear();
 
+  /// @brief 論理関数による検索用の辞書を作る．
+  void
+  make_logic_dict();
+
+  /// @brief グループ/クラスごとにセルを並べたリストを作る．
+  void
+  make_sorted_list();
+
   /// @brief セルを登録する．
   /// @return セルを返す．
   CiCell*
@@ -910,8 +1380,10 @@ private:
   //////////////////////////////////////////////////////////////////////
 
   // 参照回数
+  // 複数のスレッドからセル等のハンドルが作られることがあるので
+  // アトミックに更新する．
   mutable
-  SizeType mRefCount{0};
+  std::atomic<SizeType> mRefCount{0};
 
   // 名前
   string mName;
@@ -967,14 +1439,72 @@ private:
   // 遅延テンプレートの実体のリスト
   vector<unique_ptr<CiLutTemplate>> mLutTemplateList;
 
+  // ワイヤーロードのリスト
+  vector<unique_ptr<CiWireLoad>> mWireLoadList;
+
+  // 名前をキーにしたワイヤーロードの辞書
+  // キーはワイヤーロードの名前(ShString)の文字列を指している．
+  unordered_map<std::string_view, const CiWireLoad*> mWireLoadDict;
+
+  // ワイヤーロードセレクションのリスト
+  vector<unique_ptr<CiWireLoadSelection>> mWireLoadSelectionList;
+
+  // 'default_wire_load' の名前
+  string mDefaultWireLoadName;
+
+  // 'default_wire_load_selection' の名前
+  string mDefaultWireLoadSelectionName;
+
+  // デフォルトのワイヤーロード
+  // wrap_up() で設定される．
+  const CiWireLoad* mDefaultWireLoad{nullptr};
+
+  // デフォルトのワイヤーロードセレクション
+  // wrap_up() で設定される．
+  const CiWireLoadSelection* mDefaultWireLoadSelection{nullptr};
+
+  // 'default_wire_load_mode'
+  string mDefaultWireLoadMode;
+
+  // 'default_wire_load_area'
+  double mDefaultWireLoadArea{0.0};
+
+  // 'default_wire_load_capacitance'
+  double mDefaultWireLoadCapacitance{0.0};
+
+  // 'default_wire_load_resistance'
+  double mDefaultWireLoadResistance{0.0};
+
+  // 'nom_process'
+  double mNomProcess{0.0};
+
+  // 'nom_temperature'
+  double mNomTemperature{0.0};
+
+  // 'nom_voltage'
+  double mNomVoltage{0.0};
+
+  // k_process_XXX/k_temp_XXX/k_volt_XXX の値の辞書
+  // キーは属性名
+  unordered_map<string, double> mKFactorDict;
+
+  // 動作条件のリスト
+  vector<CiOperatingConditions> mOperatingConditionsList;
+
+  // 'default_operating_conditions' の名前
+  string mDefaultOperatingConditionsName;
+
+  // デフォルトの動作条件の位置番号
+  // wrap_up() で設定される．
+  SizeType mDefaultOperatingConditions{CLIB_NULLID};
+
   // セルの所有権管理用のリスト
   vector<unique_ptr<CiCell>> mCellList;
 
   // 名前をキーにしたセルの辞書
-  unordered_map<ShString, const CiCell*> mCellDict;
-
-  // セルとピン名をキーにしたピンの辞書
-  CiCellNameHash<CiPin> mPinDict;
+  // キーはセルの名前(ShString)の文字列を指しているので
+  // セルが存在する限り有効
+  unordered_map<std::string_view, const CiCell*> mCellDict;
 
   // セルとバス名をキーにしたバスの辞書
   CiCellNameHash<CiBus> mBusDict;
@@ -1012,8 +1542,29 @@ private:
   // キーは ClibSeqAttr::index()
   std::unordered_map<SizeType, vector<const CiCellClass*>> mLatchClassDict;
 
+  // 論理関数をキーにしてセルグループを持つ辞書
+  std::unordered_map<TvFunc, const CiCellGroup*> mLogicGroupDict;
+
+  // 代表シグネチャの文字列をキーにしてセルクラスを持つ辞書
+  std::unordered_map<string, const CiCellClass*> mLogicClassDict;
+
+  // パタングラフ生成の制限値
+  ClibPatGenParam mPgParam;
+
+  // パタングラフ用の論理式のリスト
+  // パタングラフを作った後はクリアされる．
+  mutable vector<pair<const CiCellClass*, vector<Expr>>> mPgExprList;
+
+  // パタングラフの生成を一度だけ行うためのフラグ
+  mutable std::once_flag mPgOnce;
+
+  // パタングラフ生成の統計情報
+  // restore() したライブラリでは全て 0 になる．
+  mutable ClibPatGenStats mPgStats;
+
   // パタングラフを管理するオブジェクト
-  CiPatMgr mPatMgr;
+  // パタングラフは最初に参照された時に作られる．
+  mutable CiPatMgr mPatMgr;
 
 };
 
@@ -0,0 +1,241 @@
+#ifndef CIINTERNALPOWER_H
+#define CIINTERNALPOWER_H
+
+/// @file CiInternalPower.h
+/// @brief CiInternalPower のヘッダファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2024 Yusuke Matsunaga
+/// All rights reserved.
+
+#include "ym/clib.h"
+#include "ym/Expr.h"
+#include "ci/CiLut.h"
+
+
+BEGIN_NAMESPACE_YM_CLIB
+
+class CiPin;
+class Serializer;
+class Deserializer;
+
+//////////////////////////////////////////////////////////////////////
+/// @class CiInternalPower CiInternalPower.h "CiInternalPower.h"
+/// @brief 内部電力(internal_power)を表すクラス
+///
+/// - pin: internal_power グループを持つピン
+/// - related_pin: 遷移の起点となるピン(ない場合は nullptr)
+/// - when: 条件式
+/// - rise_power/fall_power: 1回の遷移あたりのエネルギーを表す LUT
+///
+/// power グループで指定された場合は rise_power/fall_power の両方に
+/// 同じ内容の LUT を持つ．
+/// LUT の変数は遷移時間(input_transition_time など)と
+/// 負荷容量(total_output_net_capacitance など)のみを扱う．
+//////////////////////////////////////////////////////////////////////
+class CiInternalPower
+{
+public:
+
+  /// @brief restore() 用のコンストラクタ
+  CiInternalPower() = default;
+
+  /// @brief コンストラクタ
+  CiInternalPower(
+    const CiPin* pin,                ///< [in] 対象のピン
+    const CiPin* related_pin,        ///< [in] 関連するピン
+    const Expr& when,                ///< [in] 条件式
+    unique_ptr<CiLut>&& rise_power,  ///< [in] 立ち上がり時のエネルギーテーブル
+    unique_ptr<CiLut>&& fall_power   ///< [in] 立ち下がり時のエネルギーテーブル
+  ) : mPin{pin},
+      mRelatedPin{related_pin},
+      mWhen{when},
+      mRisePower{std::move(rise_power)},
+      mFallPower{std::move(fall_power)}
+  {
+  }
+
+  /// @brief デストラクタ
+  ~CiInternalPower() = default;
+
+
+public:
+  //////////////////////////////////////////////////////////////////////
+  // 属性の取得
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief 対象のピンを返す．
+  const CiPin*
+  pin() const
+  {
+    return mPin;
+  }
+
+  /// @brief 関連するピンを返す．
+  ///
+  /// ない場合は nullptr を返す．
+  const CiPin*
+  related_pin() const
+  {
+    return mRelatedPin;
+  }
+
+  /// @brief 条件式を返す．
+  ///
+  /// ない場合には定数1の式を返す．
+  Expr
+  when() const
+  {
+    return mWhen;
+  }
+
+  /// @brief 立ち上がり時のエネルギーテーブルを返す．
+  const CiLut*
+  rise_power() const
+  {
+    return mRisePower.get();
+  }
+
+  /// @brief 立ち下がり時のエネルギーテーブルを返す．
+  const CiLut*
+  fall_power() const
+  {
+    return mFallPower.get();
+  }
+
+  /// @brief 立ち上がり時のエネルギーを計算する．
+  ///
+  /// テーブルがない場合は 0.0 を返す．
+  double
+  calc_rise_energy(
+    double input_transition,  ///< [in] 入力信号の遷移時間
+    double output_capacitance ///< [in] 出力の負荷容量
+  ) const
+  {
+    return calc_energy(mRisePower.get(), input_transition, output_capacitance);
+  }
+
+  /// @brief 立ち下がり時のエネルギーを計算する．
+  ///
+  /// テーブルがない場合は 0.0 を返す．
+  double
+  calc_fall_energy(
+    double input_transition,  ///< [in] 入力信号の遷移時間
+    double output_capacitance ///< [in] 出力の負荷容量
+  ) const
+  {
+    return calc_energy(mFallPower.get(), input_transition, output_capacitance);
+  }
+
+  /// @brief 立ち上がり時のエネルギーをまとめて計算する．
+  ///
+  /// input_transition_list と output_capacitance_list の同じ位置の
+  /// 値の組ごとにエネルギーを計算する．
+  vector<double>
+  calc_rise_energy_list(
+    const vector<double>& input_transition_list,  ///< [in] 遷移時間のリスト
+    const vector<double>& output_capacitance_list ///< [in] 負荷容量のリスト
+  ) const
+  {
+    return calc_energy_list(mRisePower.get(),
+			    input_transition_list, output_capacitance_list);
+  }
+
+  /// @brief 立ち下がり時のエネルギーをまとめて計算する．
+  vector<double>
+  calc_fall_energy_list(
+    const vector<double>& input_transition_list,  ///< [in] 遷移時間のリスト
+    const vector<double>& output_capacitance_list ///< [in] 負荷容量のリスト
+  ) const
+  {
+    return calc_energy_list(mFallPower.get(),
+			    input_transition_list, output_capacitance_list);
+  }
+
+
+public:
+  //////////////////////////////////////////////////////////////////////
+  // dump/restore 関数
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief 内容をシリアライズする．
+  void
+  serialize(
+    Serializer& s ///< [in] シリアライザ
+  ) const;
+
+  /// @brief 内容をバイナリダンプする．
+  void
+  dump(
+    Serializer& s ///< [in] シリアライザ
+  ) const;
+
+  /// @brief 内容を読み込む．
+  static
+  unique_ptr<CiInternalPower>
+  restore(
+    Deserializer& s ///< [in] デシリアライザ
+  );
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // 内部で用いられる関数
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief LUT の変数の割り当てを求める．
+  ///
+  /// var_map[i] は i 番目の変数が遷移時間の時 0，
+  /// 負荷容量の時 1 となる．
+  /// それ以外の変数を持つ場合は std::invalid_argument 例外を送出する．
+  static
+  void
+  make_var_map(
+    const CiLut* lut,
+    SizeType var_map[]
+  );
+
+  /// @brief エネルギーを計算する．
+  static
+  double
+  calc_energy(
+    const CiLut* lut,
+    double input_transition,
+    double output_capacitance
+  );
+
+  /// @brief エネルギーをまとめて計算する．
+  static
+  vector<double>
+  calc_energy_list(
+    const CiLut* lut,
+    const vector<double>& input_transition_list,
+    const vector<double>& output_capacitance_list
+  );
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // データメンバ
+  //////////////////////////////////////////////////////////////////////
+
+  // 対象のピン
+  const CiPin* mPin{nullptr};
+
+  // 関連するピン
+  const CiPin* mRelatedPin{nullptr};
+
+  // 条件式
+  Expr mWhen;
+
+  // 立ち上がり時のエネルギーテーブル
+  unique_ptr<CiLut> mRisePower;
+
+  // 立ち下がり時のエネルギーテーブル
+  unique_ptr<CiLut> mFallPower;
+
+};
+
+END_NAMESPACE_YM_CLIB
+
+#endif // CIINTERNALPOWER_H
@@ -0,0 +1,155 @@
+#ifndef CILEAKAGETABLE_H
+#define CILEAKAGETABLE_H
+
+/// @file CiLeakageTable.h
+/// @brief CiLeakageTable のヘッダファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2024 Yusuke Matsunaga
+/// All rights reserved.
+
+#include "ym/clib.h"
+#include "ym/Expr.h"
+
+
+BEGIN_NAMESPACE_YM_CLIB
+
+//////////////////////////////////////////////////////////////////////
+/// @class CiLeakageTable CiLeakageTable.h "CiLeakageTable.h"
+/// @brief 状態依存のリーク電力を評価するための表
+///
+/// leakage_power の when 条件を入力の真理値表のビットマスクに変換し，
+/// 入力状態ごとのリーク電力の表を作る．
+/// 入力状態は i 番目のビットが i 番目の入力の値を表す整数で表す．
+///
+/// - 複数の条件に合致する場合には先に定義されたものが優先される．
+/// - 条件なし(定数1)のものはどの条件にも合致しない状態に用いられる．
+/// - それもない場合には cell_leakage_power の値を用いる．
+///
+/// 入力数が max_input_num() を超える場合は表を作らない．
+//////////////////////////////////////////////////////////////////////
+class CiLeakageTable
+{
+public:
+
+  /// @brief 空のコンストラクタ
+  CiLeakageTable() = default;
+
+  /// @brief デストラクタ
+  ~CiLeakageTable() = default;
+
+
+public:
+  //////////////////////////////////////////////////////////////////////
+  // 外部インターフェイス
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief 扱える入力数の最大値
+  static
+  SizeType
+  max_input_num()
+  {
+    return 16;
+  }
+
+  /// @brief 表を作る．
+  void
+  build(
+    SizeType input_num,                ///< [in] 入力数
+    double default_value,              ///< [in] 既定値(cell_leakage_power)
+    const vector<Expr>& when_list,     ///< [in] 条件式のリスト
+    const vector<double>& value_list   ///< [in] 値のリスト
+  );
+
+  /// @brief 表が作られている時 true を返す．
+  bool
+  is_valid() const
+  {
+    return !mValueTable.empty();
+  }
+
+  /// @brief 入力数を返す．
+  SizeType
+  input_num() const
+  {
+    return mInputNum;
+  }
+
+  /// @brief 条件式のビットマスクを返す．
+  ///
+  /// 入力状態 m が条件を満たす時，
+  /// m / 64 番目のワードの m % 64 番目のビットが1となる．
+  vector<std::uint64_t>
+  when_mask(
+    SizeType pos ///< [in] 位置番号 ( 0 <= pos < 条件数 )
+  ) const;
+
+  /// @brief 入力状態に対するリーク電力を返す．
+  ///
+  /// input_num() 以上のビットは無視される．
+  double
+  value(
+    std::uint64_t state ///< [in] 入力状態
+  ) const
+  {
+    check_valid();
+    return mValueTable[state & (mValueTable.size() - 1)];
+  }
+
+  /// @brief 入力状態のリストに対するリーク電力のリストを返す．
+  vector<double>
+  value_list(
+    const vector<std::uint64_t>& state_list ///< [in] 入力状態のリスト
+  ) const;
+
+  /// @brief 入力の信号確率に対するリーク電力の期待値を返す．
+  ///
+  /// 状態によって値が異なる場合，
+  /// prob_list のサイズは input_num() と等しくなければならない．
+  double
+  average_value(
+    const vector<double>& prob_list ///< [in] 各入力が1となる確率のリスト
+  ) const;
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // 内部で用いられる関数
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief 表が作られているかチェックする．
+  ///
+  /// 作られていない場合は std::invalid_argument 例外を送出する．
+  void
+  check_valid() const
+  {
+    if ( !is_valid() ) {
+      throw std::invalid_argument{"too many inputs for leakage power evaluation"};
+    }
+  }
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // データメンバ
+  //////////////////////////////////////////////////////////////////////
+
+  // 入力数
+  SizeType mInputNum{0};
+
+  // 1つの真理値表のワード数
+  SizeType mWordNum{0};
+
+  // 条件式のビットマスク
+  // 条件ごとに mWordNum ワードずつ並んでいる．
+  vector<std::uint64_t> mMaskArray;
+
+  // 入力状態ごとのリーク電力の値
+  // サイズは 2^mInputNum か，状態によらず一定の場合は1
+  vector<double> mValueTable{0.0};
+
+};
+
+END_NAMESPACE_YM_CLIB
+
+#endif // CILEAKAGETABLE_H
@@ -0,0 +1,125 @@
+#ifndef CILOADPROFILER_H
+#define CILOADPROFILER_H
+
+/// @file CiLoadProfiler.h
+/// @brief CiLoadProfiler のヘッダファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2024 Yusuke Matsunaga
+/// All rights reserved.
+
+#include "ym/clib.h"
+#include "ym/ClibLoadProfile.h"
+#include <chrono>
+
+
+BEGIN_NAMESPACE_YM_CLIB
+
+//////////////////////////////////////////////////////////////////////
+/// @class CiLoadProfiler CiLoadProfiler.h "CiLoadProfiler.h"
+/// @brief ライブラリ読み込みの各フェーズを計測するクラス
+///
+/// 結果は ClibLoadProfile に追加される．
+/// ClibLoadProfile が指定されていない場合は何もしないので
+/// 計測を行わない場合のオーバーヘッドは is_enabled() の判定のみとなる．
+//////////////////////////////////////////////////////////////////////
+class CiLoadProfiler
+{
+public:
+
+  using Clock = std::chrono::steady_clock;
+
+  /// @brief コンストラクタ
+  explicit
+  CiLoadProfiler(
+    ClibLoadProfile* profile = nullptr ///< [in] 結果を格納するオブジェクト
+  ) : mProfile{profile}
+  {
+  }
+
+  /// @brief デストラクタ
+  ~CiLoadProfiler() = default;
+
+
+public:
+  //////////////////////////////////////////////////////////////////////
+  // 外部インターフェイス
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief 計測を行う時 true を返す．
+  bool
+  is_enabled() const
+  {
+    return mProfile != nullptr;
+  }
+
+  /// @brief フェーズの計測を開始する．
+  void
+  start()
+  {
+    if ( is_enabled() ) {
+      mStartTime = Clock::now();
+    }
+  }
+
+  /// @brief フェーズの計測を終了して結果を記録する．
+  void
+  stop(
+    const string& name,    ///< [in] フェーズ名
+    SizeType bytes,        ///< [in] 処理したバイト数
+    SizeType object_num    ///< [in] 処理したオブジェクト数
+  )
+  {
+    if ( is_enabled() ) {
+      auto dt = std::chrono::duration<double>{Clock::now() - mStartTime};
+      add(name, dt.count(), bytes, object_num);
+    }
+  }
+
+  /// @brief 別途計測した結果を記録する．
+  ///
+  /// 細切れの区間の時間を積算する場合に用いる．
+  void
+  add(
+    const string& name,    ///< [in] フェーズ名
+    double wall_time,      ///< [in] 経過時間(秒)
+    SizeType bytes,        ///< [in] 処理したバイト数
+    SizeType object_num    ///< [in] 処理したオブジェクト数
+  );
+
+  /// @brief 現在時刻を返す．
+  static
+  Clock::time_point
+  now()
+  {
+    return Clock::now();
+  }
+
+  /// @brief 2つの時刻の差を秒で返す．
+  static
+  double
+  elapsed(
+    Clock::time_point from, ///< [in] 開始時刻
+    Clock::time_point to    ///< [in] 終了時刻
+  )
+  {
+    return std::chrono::duration<double>{to - from}.count();
+  }
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // データメンバ
+  //////////////////////////////////////////////////////////////////////
+
+  // 結果を格納するオブジェクト
+  ClibLoadProfile* mProfile;
+
+  // 現在のフェーズの開始時刻
+  Clock::time_point mStartTime;
+
+};
+
+END_NAMESPACE_YM_CLIB
+
+#endif // CILOADPROFILER_H
@@ -116,6 +116,33 @@ public:
                                     ///< サイズは dimension() と同じ
   ) const = 0;
 
+  /// @brief 値をまとめて計算する．
+  ///
+  /// input_list[i] は i 番目の変数の値を n 個並べた配列を指す．
+  /// 結果は output_list[0] から output_list[n - 1] に書き込まれる．
+  virtual
+  void
+  value_list(
+    SizeType n,                       ///< [in] 値の組の数
+    const double* const input_list[], ///< [in] 変数ごとの値の配列
+                                      ///< サイズは dimension() と同じ
+    double* output_list               ///< [out] 結果を格納する配列
+  ) const = 0;
+
+  /// @brief インデックス値の配列を返す．
+  virtual
+  const vector<double>&
+  index_array(
+    SizeType var ///< [in] 変数番号 ( 0 <= var < dimension() )
+  ) const = 0;
+
+  /// @brief 格子点の値の配列を返す．
+  ///
+  /// 最後の変数が最も速く変わる順に並んでいる．
+  virtual
+  const vector<double>&
+  value_array() const = 0;
+
 
 public:
   //////////////////////////////////////////////////////////////////////
@@ -0,0 +1,151 @@
+#ifndef CIOPERATINGCONDITIONS_H
+#define CIOPERATINGCONDITIONS_H
+
+/// @file CiOperatingConditions.h
+/// @brief CiOperatingConditions のヘッダファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2024 Yusuke Matsunaga
+/// All rights reserved.
+
+#include "ym/clib.h"
+#include "ym/ShString.h"
+
+
+BEGIN_NAMESPACE_YM_CLIB
+
+class Serializer;
+class Deserializer;
+
+//////////////////////////////////////////////////////////////////////
+/// @class CiOperatingConditions CiOperatingConditions.h "CiOperatingConditions.h"
+/// @brief operating_conditions グループを表すクラス
+///
+/// 他の要素を参照しないのでライブラリが値として保持する．
+//////////////////////////////////////////////////////////////////////
+class CiOperatingConditions
+{
+public:
+
+  /// @brief 空のコンストラクタ
+  ///
+  /// restore() 用
+  CiOperatingConditions() = default;
+
+  /// @brief 内容を指定したコンストラクタ
+  CiOperatingConditions(
+    SizeType id,              ///< [in] ID番号
+    const ShString& name,     ///< [in] 名前
+    double process,           ///< [in] プロセス係数
+    double temperature,       ///< [in] 温度
+    double voltage,           ///< [in] 電圧
+    const ShString& tree_type ///< [in] 配線の RC ツリーの種類
+  ) : mId{id},
+      mName{name},
+      mProcess{process},
+      mTemperature{temperature},
+      mVoltage{voltage},
+      mTreeType{tree_type}
+  {
+  }
+
+  /// @brief デストラクタ
+  ~CiOperatingConditions() = default;
+
+
+public:
+  //////////////////////////////////////////////////////////////////////
+  // 属性の取得
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief ID番号を返す．
+  SizeType
+  id() const
+  {
+    return mId;
+  }
+
+  /// @brief 名前を返す．
+  ShString
+  name() const
+  {
+    return mName;
+  }
+
+  /// @brief プロセス係数を返す．
+  double
+  process() const
+  {
+    return mProcess;
+  }
+
+  /// @brief 温度を返す．
+  double
+  temperature() const
+  {
+    return mTemperature;
+  }
+
+  /// @brief 電圧を返す．
+  double
+  voltage() const
+  {
+    return mVoltage;
+  }
+
+  /// @brief 配線の RC ツリーの種類を返す．
+  ///
+  /// 指定されていない場合は空文字列となる．
+  ShString
+  tree_type() const
+  {
+    return mTreeType;
+  }
+
+
+public:
+  //////////////////////////////////////////////////////////////////////
+  // dump/restore 関数
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief 内容をバイナリダンプする．
+  void
+  dump(
+    Serializer& s ///< [in] シリアライザ
+  ) const;
+
+  /// @brief 内容を復元する．
+  void
+  restore(
+    Deserializer& s ///< [in] デシリアライザ
+  );
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // データメンバ
+  //////////////////////////////////////////////////////////////////////
+
+  // ID番号
+  SizeType mId{CLIB_NULLID};
+
+  // 名前
+  ShString mName;
+
+  // プロセス係数
+  double mProcess{1.0};
+
+  // 温度
+  double mTemperature{0.0};
+
+  // 電圧
+  double mVoltage{0.0};
+
+  // 配線の RC ツリーの種類
+  ShString mTreeType;
+
+};
+
+END_NAMESPACE_YM_CLIB
+
+#endif // CIOPERATINGCONDITIONS_H
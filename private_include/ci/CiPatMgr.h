@@ -9,6 +9,8 @@
 /// All rights reserved.
 
 #include "ym/clib.h"
+#include "ym/TvFunc.h"
+#include "ym/ClibIOMap.h"
 #include "ym/BinDec.h"
 #include "ym/BinEnc.h"
 
@@ -149,6 +151,61 @@ public:
     SizeType id ///< [in] パタン番号 ( 0 <= id < pat_num() )
   ) const;
 
+  /// @brief ノードの深さを返す．
+  ///
+  /// 入力ノードの深さは 0
+  SizeType
+  node_depth(
+    SizeType id ///< [in] ノード番号 ( 0 <= id < node_num() )
+  ) const
+  {
+    ASSERT_COND( 0 <= id && id < node_num() );
+    return mNodeDepthArray[id];
+  }
+
+  /// @brief パタンの最大の深さを返す．
+  SizeType
+  max_depth() const
+  {
+    return mMaxDepth;
+  }
+
+  /// @brief パタンの論理関数を返す．
+  ///
+  /// 入力番号 0 〜 input_num() - 1 を変数とする関数で
+  /// 根の反転属性も含む．
+  const TvFunc&
+  pat_func(
+    SizeType id ///< [in] パタン番号 ( 0 <= id < pat_num() )
+  ) const;
+
+  /// @brief 根の種類，深さ，入力数からパタン番号のリストを返す．
+  ///
+  /// 該当するパタンがない場合には空のリストを返す．
+  const vector<SizeType>&
+  find_pat_list(
+    ClibPatType root_type, ///< [in] 根のノードの種類
+    SizeType depth,        ///< [in] 深さ
+    SizeType input_num     ///< [in] 入力数
+  ) const;
+
+  /// @brief パタンの論理関数から NPN 正規形への変換マップを返す．
+  const ClibIOMap&
+  pat_map(
+    SizeType id ///< [in] パタン番号 ( 0 <= id < pat_num() )
+  ) const;
+
+  /// @brief 論理関数と NPN 同値なパタン番号のリストを返す．
+  ///
+  /// 該当するパタンがない場合には空のリストを返す．
+  /// 個々のパタンの論理関数との対応は pat_map(id) と
+  /// iomap から求められる．
+  const vector<SizeType>&
+  find_pat_list(
+    const TvFunc& func, ///< [in] 論理関数
+    ClibIOMap& iomap    ///< [out] func から NPN 正規形への変換マップ
+  ) const;
+
   /// @brief バイナリダンプを行う．
   void
   dump(
@@ -208,6 +265,13 @@ public:
     Deserializer& s ///< [in] デシリアライザ
   );
 
+  /// @brief パタン照合用の索引を作る．
+  ///
+  /// set_pat_info() で全てのパタンを設定した後に呼ぶ必要がある．
+  /// restore() の中では自動的に呼ばれる．
+  void
+  make_index();
+
 
 private:
   //////////////////////////////////////////////////////////////////////
@@ -226,6 +290,30 @@ private:
   // サイズはパタン数
   vector<CiPatGraph> mPatArray;
 
+  // ノードの深さの配列
+  // サイズはノード数
+  vector<SizeType> mNodeDepthArray;
+
+  // パタンの最大の深さ
+  SizeType mMaxDepth{0};
+
+  // パタンの論理関数の配列
+  // サイズはパタン数
+  vector<TvFunc> mPatFuncArray;
+
+  // 根の種類，深さ，入力数をキーにしてパタン番号のリストを持つ辞書
+  std::unordered_map<SizeType, vector<SizeType>> mPatIndex;
+
+  // パタンの論理関数から NPN 正規形への変換マップの配列
+  // サイズはパタン数
+  vector<ClibIOMap> mPatMapArray;
+
+  // NPN 正規形のシグネチャ文字列をキーにしてパタン番号のリストを持つ辞書
+  std::unordered_map<string, vector<SizeType>> mFuncIndex;
+
+  // 該当するパタンがない時に返す空のリスト
+  vector<SizeType> mEmptyList;
+
 };
 
 END_NAMESPACE_YM_CLIB
@@ -83,6 +83,27 @@ public:
     double val2  ///< [in] 入力2の値
   ) const;
 
+  /// @brief 値をまとめて計算する．
+  void
+  value_list(
+    SizeType n,                        ///< [in] 入力数
+    const double* const input_list[],  ///< [in] 変数ごとの入力値の配列
+    double* output_list                ///< [out] 結果を格納する配列
+  ) const override;
+
+  /// @brief インデックス値の配列を返す．
+  const vector<double>&
+  index_array(
+    SizeType var ///< [in] 変数番号 ( 0 <= var < dimension() )
+  ) const override;
+
+  /// @brief 格子点の値の配列を返す．
+  const vector<double>&
+  value_array() const override
+  {
+    return mValueArray;
+  }
+
 
 public:
   //////////////////////////////////////////////////////////////////////
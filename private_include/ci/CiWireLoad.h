@@ -0,0 +1,338 @@
+#ifndef CIWIRELOAD_H
+#define CIWIRELOAD_H
+
+/// @file CiWireLoad.h
+/// @brief CiWireLoad のヘッダファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2024 Yusuke Matsunaga
+/// All rights reserved.
+
+#include "ym/clib.h"
+#include "ym/ShString.h"
+
+
+BEGIN_NAMESPACE_YM_CLIB
+
+class Serializer;
+class Deserializer;
+
+//////////////////////////////////////////////////////////////////////
+/// @class CiWireLoad CiWireLoad.h "CiWireLoad.h"
+/// @brief ワイヤーロードモデルを表すクラス
+///
+/// wire_load グループと wire_load_table グループの両方を表す．
+/// どちらの場合もファンアウト数ごとの配線長/容量/抵抗/面積の値を
+/// 密な配列に展開しておくので，値の計算は定数時間で行える．
+///
+/// - 定義されている点の間は線形補間する．
+/// - 最初の点よりも小さいファンアウトは原点との間で線形補間する．
+/// - 最後の点よりも大きいファンアウトは傾きを用いて外挿する．
+///   wire_load の場合は slope 属性を，wire_load_table の場合は
+///   最後の区間の傾きを用いる．
+///
+/// wire_load の場合，容量/抵抗/面積は配線長に単位長あたりの値を掛けたもの
+/// となる．
+//////////////////////////////////////////////////////////////////////
+class CiWireLoad
+{
+public:
+
+  /// @brief (ファンアウト数, 値) の組
+  using FanoutPoint = pair<SizeType, double>;
+
+
+public:
+
+  /// @brief 空のコンストラクタ
+  ///
+  /// restore() 用
+  CiWireLoad() = default;
+
+  /// @brief デストラクタ
+  ~CiWireLoad() = default;
+
+
+public:
+  //////////////////////////////////////////////////////////////////////
+  // 生成用のクラスメソッド
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief wire_load グループのインスタンスを生成する．
+  static
+  unique_ptr<CiWireLoad>
+  new_model(
+    SizeType id,                                  ///< [in] ID番号
+    const ShString& name,                         ///< [in] 名前
+    double resistance,                            ///< [in] 単位長あたりの抵抗
+    double capacitance,                           ///< [in] 単位長あたりの容量
+    double area,                                  ///< [in] 単位長あたりの面積
+    double slope,                                 ///< [in] 外挿用の傾き
+    const vector<FanoutPoint>& fanout_length_list ///< [in] fanout_length のリスト
+  );
+
+  /// @brief wire_load_table グループのインスタンスを生成する．
+  static
+  unique_ptr<CiWireLoad>
+  new_table(
+    SizeType id,                                        ///< [in] ID番号
+    const ShString& name,                               ///< [in] 名前
+    const vector<FanoutPoint>& fanout_length_list,      ///< [in] fanout_length のリスト
+    const vector<FanoutPoint>& fanout_capacitance_list, ///< [in] fanout_capacitance のリスト
+    const vector<FanoutPoint>& fanout_resistance_list,  ///< [in] fanout_resistance のリスト
+    const vector<FanoutPoint>& fanout_area_list         ///< [in] fanout_area のリスト
+  );
+
+
+public:
+  //////////////////////////////////////////////////////////////////////
+  // 属性の取得
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief ID番号を返す．
+  SizeType
+  id() const
+  {
+    return mId;
+  }
+
+  /// @brief 名前を返す．
+  ShString
+  name() const
+  {
+    return mName;
+  }
+
+  /// @brief wire_load_table の時 true を返す．
+  bool
+  is_table() const
+  {
+    return mIsTable;
+  }
+
+  /// @brief 単位長あたりの抵抗を返す．
+  ///
+  /// wire_load_table の場合は 0.0 を返す．
+  double
+  resistance() const
+  {
+    return mResistance;
+  }
+
+  /// @brief 単位長あたりの容量を返す．
+  ///
+  /// wire_load_table の場合は 0.0 を返す．
+  double
+  capacitance() const
+  {
+    return mCapacitance;
+  }
+
+  /// @brief 単位長あたりの面積を返す．
+  ///
+  /// wire_load_table の場合は 0.0 を返す．
+  double
+  area() const
+  {
+    return mArea;
+  }
+
+  /// @brief 外挿用の傾きを返す．
+  ///
+  /// wire_load_table の場合は 0.0 を返す．
+  double
+  slope() const
+  {
+    return mSlope;
+  }
+
+  /// @brief ファンアウト数から配線長を求める．
+  double
+  wire_length(
+    SizeType fanout ///< [in] ファンアウト数
+  ) const
+  {
+    return mLengthTable.value(fanout);
+  }
+
+  /// @brief ファンアウト数から配線容量を求める．
+  double
+  wire_capacitance(
+    SizeType fanout ///< [in] ファンアウト数
+  ) const
+  {
+    return mCapacitanceTable.value(fanout);
+  }
+
+  /// @brief ファンアウト数から配線抵抗を求める．
+  double
+  wire_resistance(
+    SizeType fanout ///< [in] ファンアウト数
+  ) const
+  {
+    return mResistanceTable.value(fanout);
+  }
+
+  /// @brief ファンアウト数から配線面積を求める．
+  double
+  wire_area(
+    SizeType fanout ///< [in] ファンアウト数
+  ) const
+  {
+    return mAreaTable.value(fanout);
+  }
+
+  /// @brief ファンアウト数のリストから配線容量のリストを求める．
+  vector<double>
+  wire_capacitance_list(
+    const vector<SizeType>& fanout_list ///< [in] ファンアウト数のリスト
+  ) const
+  {
+    return mCapacitanceTable.value_list(fanout_list);
+  }
+
+
+public:
+  //////////////////////////////////////////////////////////////////////
+  // dump/restore 関数
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief 内容をシリアライズする．
+  void
+  serialize(
+    Serializer& s ///< [in] シリアライザ
+  ) const;
+
+  /// @brief 内容をバイナリダンプする．
+  void
+  dump(
+    Serializer& s ///< [in] シリアライザ
+  ) const;
+
+  /// @brief 内容を復元する．
+  static
+  unique_ptr<CiWireLoad>
+  restore(
+    Deserializer& s ///< [in] デシリアライザ
+  );
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // 内部で用いられるクラス
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief ファンアウト数ごとの値の表
+  struct FanoutTable
+  {
+    /// @brief 点のリストから表を作る．
+    ///
+    /// 外挿用の傾きは最後の区間の傾きとなる．
+    void
+    build(
+      const vector<FanoutPoint>& point_list ///< [in] 点のリスト
+    );
+
+    /// @brief 値を定数倍した表を作る．
+    void
+    scale(
+      const FanoutTable& src, ///< [in] 元の表
+      double factor           ///< [in] 係数
+    );
+
+    /// @brief 値を返す．
+    double
+    value(
+      SizeType fanout ///< [in] ファンアウト数
+    ) const
+    {
+      SizeType n = mArray.size();
+      if ( fanout < n ) {
+	return mArray[fanout];
+      }
+      return mArray[n - 1] + (fanout - (n - 1)) * mSlope;
+    }
+
+    /// @brief 値のリストを返す．
+    vector<double>
+    value_list(
+      const vector<SizeType>& fanout_list ///< [in] ファンアウト数のリスト
+    ) const;
+
+    /// @brief 内容をバイナリダンプする．
+    void
+    dump(
+      Serializer& s ///< [in] シリアライザ
+    ) const;
+
+    /// @brief 内容を復元する．
+    void
+    restore(
+      Deserializer& s ///< [in] デシリアライザ
+    );
+
+    // ファンアウト数をインデックスとした値の配列
+    // 0 番目の要素は必ず存在する．
+    vector<double> mArray{0.0};
+
+    // 配列の範囲外の値を求めるための傾き
+    double mSlope{0.0};
+
+  };
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // 内部で用いられる関数
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief restore() の本体
+  void
+  _restore(
+    Deserializer& s
+  );
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // データメンバ
+  //////////////////////////////////////////////////////////////////////
+
+  // ID番号
+  SizeType mId{0};
+
+  // 名前
+  ShString mName;
+
+  // wire_load_table の時 true
+  bool mIsTable{false};
+
+  // 単位長あたりの抵抗
+  double mResistance{0.0};
+
+  // 単位長あたりの容量
+  double mCapacitance{0.0};
+
+  // 単位長あたりの面積
+  double mArea{0.0};
+
+  // 外挿用の傾き
+  double mSlope{0.0};
+
+  // 配線長の表
+  FanoutTable mLengthTable;
+
+  // 配線容量の表
+  FanoutTable mCapacitanceTable;
+
+  // 配線抵抗の表
+  FanoutTable mResistanceTable;
+
+  // 配線面積の表
+  FanoutTable mAreaTable;
+
+};
+
+END_NAMESPACE_YM_CLIB
+
+#endif // CIWIRELOAD_H
@@ -0,0 +1,156 @@
+#ifndef CIWIRELOADSELECTION_H
+#define CIWIRELOADSELECTION_H
+
+/// @file CiWireLoadSelection.h
+/// @brief CiWireLoadSelection のヘッダファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2024 Yusuke Matsunaga
+/// All rights reserved.
+
+#include "ym/clib.h"
+#include "ym/ShString.h"
+
+
+BEGIN_NAMESPACE_YM_CLIB
+
+class CiWireLoad;
+class Serializer;
+class Deserializer;
+
+//////////////////////////////////////////////////////////////////////
+/// @class CiWireLoadSelection CiWireLoadSelection.h "CiWireLoadSelection.h"
+/// @brief wire_load_selection グループを表すクラス
+///
+/// 面積の範囲とワイヤーロードの組のリストを持つ．
+//////////////////////////////////////////////////////////////////////
+class CiWireLoadSelection
+{
+public:
+
+  /// @brief wire_load_from_area の内容
+  struct Entry
+  {
+    // 面積の下限
+    double mMinArea;
+
+    // 面積の上限
+    double mMaxArea;
+
+    // ワイヤーロード
+    const CiWireLoad* mWireLoad;
+  };
+
+
+public:
+
+  /// @brief 空のコンストラクタ
+  ///
+  /// restore() 用
+  CiWireLoadSelection() = default;
+
+  /// @brief 内容を指定したコンストラクタ
+  CiWireLoadSelection(
+    const ShString& name,           ///< [in] 名前
+    const vector<Entry>& entry_list ///< [in] 要素のリスト
+  ) : mName{name},
+      mEntryList{entry_list}
+  {
+  }
+
+  /// @brief デストラクタ
+  ~CiWireLoadSelection() = default;
+
+
+public:
+  //////////////////////////////////////////////////////////////////////
+  // 属性の取得
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief 名前を返す．
+  ///
+  /// 名前を持たない場合は空文字列となる．
+  ShString
+  name() const
+  {
+    return mName;
+  }
+
+  /// @brief 要素のリストを返す．
+  const vector<Entry>&
+  entry_list() const
+  {
+    return mEntryList;
+  }
+
+  /// @brief 面積からワイヤーロードを選ぶ．
+  ///
+  /// min_area <= area < max_area を満たす最初の要素のワイヤーロードを返す．
+  /// 該当するものがない場合は nullptr を返す．
+  const CiWireLoad*
+  select(
+    double area ///< [in] 面積
+  ) const
+  {
+    for ( auto& entry: mEntryList ) {
+      if ( entry.mMinArea <= area && area < entry.mMaxArea ) {
+	return entry.mWireLoad;
+      }
+    }
+    return nullptr;
+  }
+
+
+public:
+  //////////////////////////////////////////////////////////////////////
+  // dump/restore 関数
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief 内容をシリアライズする．
+  void
+  serialize(
+    Serializer& s ///< [in] シリアライザ
+  ) const;
+
+  /// @brief 内容をバイナリダンプする．
+  void
+  dump(
+    Serializer& s ///< [in] シリアライザ
+  ) const;
+
+  /// @brief 内容を復元する．
+  static
+  unique_ptr<CiWireLoadSelection>
+  restore(
+    Deserializer& s ///< [in] デシリアライザ
+  );
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // 内部で用いられる関数
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief restore() の本体
+  void
+  _restore(
+    Deserializer& s
+  );
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // データメンバ
+  //////////////////////////////////////////////////////////////////////
+
+  // 名前
+  ShString mName;
+
+  // 要素のリスト
+  vector<Entry> mEntryList;
+
+};
+
+END_NAMESPACE_YM_CLIB
+
+#endif // CIWIRELOADSELECTION_H
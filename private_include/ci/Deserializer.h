@@ -18,12 +18,15 @@
 #include "ym/ClibTime.h"
 #include "ci/CiBusType.h"
 #include "ci/CiLutTemplate.h"
+#include "ci/CiWireLoad.h"
+#include "ci/CiWireLoadSelection.h"
 #include "ci/CiLut.h"
 #include "ci/CiStLut.h"
 #include "ci/CiPin.h"
 #include "ci/CiBus.h"
 #include "ci/CiBundle.h"
 #include "ci/CiTiming.h"
+#include "ci/CiInternalPower.h"
 #include "ci/CiCell.h"
 #include "ci/CiCellGroup.h"
 #include "ci/CiCellClass.h"
@@ -72,12 +75,15 @@ public:
   {
     mBusTypeList.restore(*this);
     mLutTemplateList.restore(*this);
+    mWireLoadList.restore(*this);
+    mWireLoadSelectionList.restore(*this);
     mLutList.restore(*this);
     mStLutList.restore(*this);
     mPinList.restore(*this);
     mBusList.restore(*this);
     mBundleList.restore(*this);
     mTimingList.restore(*this);
+    mInternalPowerList.restore(*this);
     mCellList.restore(*this);
     mCellGroupList.restore(*this);
     mCellClassList.restore(*this);
@@ -337,6 +343,24 @@ public:
     std::swap(dst, mTimingList.restore_ptr(*this));
   }
 
+  /// @brief 内部電力の読み込み
+  void
+  restore(
+    CiInternalPower*& dst
+  )
+  {
+    dst = mInternalPowerList.restore_ref(*this);
+  }
+
+  /// @brief 内部電力の読み込み
+  void
+  restore(
+    unique_ptr<CiInternalPower>& dst
+  )
+  {
+    std::swap(dst, mInternalPowerList.restore_ptr(*this));
+  }
+
   /// @brief LUTテンプレートの読み込み
   void
   restore(
@@ -355,6 +379,42 @@ public:
     std::swap(dst, mLutTemplateList.restore_ptr(*this));
   }
 
+  /// @brief ワイヤーロードの読み込み
+  void
+  restore(
+    CiWireLoad*& dst
+  )
+  {
+    dst = mWireLoadList.restore_ref(*this);
+  }
+
+  /// @brief ワイヤーロードの読み込み
+  void
+  restore(
+    unique_ptr<CiWireLoad>& dst
+  )
+  {
+    std::swap(dst, mWireLoadList.restore_ptr(*this));
+  }
+
+  /// @brief ワイヤーロードセレクションの読み込み
+  void
+  restore(
+    CiWireLoadSelection*& dst
+  )
+  {
+    dst = mWireLoadSelectionList.restore_ref(*this);
+  }
+
+  /// @brief ワイヤーロードセレクションの読み込み
+  void
+  restore(
+    unique_ptr<CiWireLoadSelection>& dst
+  )
+  {
+    std::swap(dst, mWireLoadSelectionList.restore_ptr(*this));
+  }
+
   /// @brief LUTの読み込み
   void
   restore(
@@ -564,6 +624,12 @@ private:
   // LUTテンプレートのリスト
   ObjList<CiLutTemplate> mLutTemplateList;
 
+  // ワイヤーロードのリスト
+  ObjList<CiWireLoad> mWireLoadList;
+
+  // ワイヤーロードセレクションのリスト
+  ObjList<CiWireLoadSelection> mWireLoadSelectionList;
+
   // LUTのリスト
   ObjList<CiLut> mLutList;
 
@@ -582,6 +648,9 @@ private:
   // タイミングのリスト
   ObjList<CiTiming> mTimingList;
 
+  // 内部電力のリスト
+  ObjList<CiInternalPower> mInternalPowerList;
+
   // セルのリスト
   ObjList<CiCell> mCellList;
 
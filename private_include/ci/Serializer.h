@@ -27,7 +27,10 @@ class CiPin;
 class CiBus;
 class CiBundle;
 class CiTiming;
+class CiInternalPower;
 class CiLutTemplate;
+class CiWireLoad;
+class CiWireLoadSelection;
 class CiLut;
 class CiStLut;
 class CiCell;
@@ -103,6 +106,15 @@ public:
     mTimingList.put(obj);
   }
 
+  /// @brief 内部電力を追加する．
+  void
+  reg_obj(
+    const CiInternalPower* obj
+  )
+  {
+    mInternalPowerList.put(obj);
+  }
+
   /// @brief LUTテンプレートを追加する．
   void
   reg_obj(
@@ -112,6 +124,24 @@ public:
     mLutTemplateList.put(obj);
   }
 
+  /// @brief ワイヤーロードを追加する．
+  void
+  reg_obj(
+    const CiWireLoad* obj
+  )
+  {
+    mWireLoadList.put(obj);
+  }
+
+  /// @brief ワイヤーロードセレクションを追加する．
+  void
+  reg_obj(
+    const CiWireLoadSelection* obj
+  )
+  {
+    mWireLoadSelectionList.put(obj);
+  }
+
   /// @brief LUTを追加する．
   void
   reg_obj(
@@ -160,18 +190,35 @@ public:
     mCellClassList.put(obj);
   }
 
+  /// @brief 登録されたバスタイプのリストを返す．
+  const vector<const CiBusType*>&
+  bus_type_list() const
+  {
+    return mBusTypeList.obj_list();
+  }
+
+  /// @brief 登録されたLUTテンプレートのリストを返す．
+  const vector<const CiLutTemplate*>&
+  lut_template_list() const
+  {
+    return mLutTemplateList.obj_list();
+  }
+
   /// @brief 登録された要素の内容をダンプする．
   void
   dump_obj()
   {
     mBusTypeList.dump(*this);
     mLutTemplateList.dump(*this);
+    mWireLoadList.dump(*this);
+    mWireLoadSelectionList.dump(*this);
     mLutList.dump(*this);
     mStLutList.dump(*this);
     mPinList.dump(*this);
     mBusList.dump(*this);
     mBundleList.dump(*this);
     mTimingList.dump(*this);
+    mInternalPowerList.dump(*this);
     mCellList.dump(*this);
     mCellGroupList.dump(*this);
     mCellClassList.dump(*this);
@@ -389,6 +436,16 @@ public:
     dump(id);
   }
 
+  /// @brief 内部電力番号を出力する．
+  void
+  dump(
+    const CiInternalPower* obj
+  )
+  {
+    SizeType id = mInternalPowerList.get_id(obj);
+    dump(id);
+  }
+
   /// @brief LUTテンプレート番号を出力する．
   void
   dump(
@@ -399,6 +456,26 @@ public:
     dump(id);
   }
 
+  /// @brief ワイヤーロード番号を出力する．
+  void
+  dump(
+    const CiWireLoad* obj
+  )
+  {
+    SizeType id = mWireLoadList.get_id(obj);
+    dump(id);
+  }
+
+  /// @brief ワイヤーロードセレクション番号を出力する．
+  void
+  dump(
+    const CiWireLoadSelection* obj
+  )
+  {
+    SizeType id = mWireLoadSelectionList.get_id(obj);
+    dump(id);
+  }
+
   /// @brief LUT番号を出力する．
   void
   dump(
@@ -605,6 +682,12 @@ private:
   // テンプレートのリスト
   ListMap<CiLutTemplate> mLutTemplateList;
 
+  // ワイヤーロードのリスト
+  ListMap<CiWireLoad> mWireLoadList;
+
+  // ワイヤーロードセレクションのリスト
+  ListMap<CiWireLoadSelection> mWireLoadSelectionList;
+
   // LUTのリスト
   ListMap<CiLut> mLutList;
 
@@ -623,6 +706,9 @@ private:
   // タイミングのリスト
   ListMap<CiTiming> mTimingList;
 
+  // 内部電力のリスト
+  ListMap<CiInternalPower> mInternalPowerList;
+
   // セルクラスのリスト
   ListMap<CiCellClass> mCellClassList;
 
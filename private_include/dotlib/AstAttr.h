@@ -10,6 +10,7 @@
 
 #include "dotlib/dotlib_nsdef.h"
 #include "dotlib/AstValue.h"
+#include "dotlib/AttrKwd.h"
 
 
 BEGIN_NAMESPACE_YM_DOTLIB
@@ -39,6 +40,7 @@ public:
     const FileRegion& kwd_loc, ///< [in] 属性名の位置
     AstValuePtr&& value        ///< [in] 値
   ) : mKwd{kwd},
+      mKwdId{attr_kwd(kwd)},
       mKwdLoc{kwd_loc},
       mValue{std::move(value)}
   {
@@ -61,6 +63,12 @@ public:
   string
   kwd() const { return mKwd; }
 
+  /// @brief 属性名を表す AttrKwd を返す．
+  ///
+  /// 登録されていない属性名の場合は AttrKwd::none となる．
+  AttrKwd
+  kwd_id() const { return mKwdId; }
+
   /// @brief 属性名の位置
   FileRegion
   kwd_loc() const { return mKwdLoc; }
@@ -85,6 +93,9 @@ private:
   // 属性名
   string mKwd;
 
+  // 属性名を表す AttrKwd
+  AttrKwd mKwdId{AttrKwd::none};
+
   // 属性名の位置
   FileRegion mKwdLoc;
 
@@ -0,0 +1,52 @@
+#ifndef ATTRKWD_H
+#define ATTRKWD_H
+
+/// @file AttrKwd.h
+/// @brief AttrKwd のヘッダファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2024 Yusuke Matsunaga
+/// All rights reserved.
+
+#include "dotlib/dotlib_nsdef.h"
+
+
+BEGIN_NAMESPACE_YM_DOTLIB
+
+//////////////////////////////////////////////////////////////////////
+/// @brief 属性名を表す列挙型
+///
+/// パース時に属性名をこの値に変換して AstAttr に持たせておく．
+/// 値の並びは AttrKwd_list.h の順(属性名の辞書順)となる．
+/// AttrKwd_list.h は pyutils/parse_gen.py の -k オプションで生成する．
+/// C++ の予約語と重なる属性名は末尾に '_' をつけた名前となる．
+//////////////////////////////////////////////////////////////////////
+enum class AttrKwd : std::uint16_t {
+#define ATTR_KWD(id, str) id,
+#include "dotlib/AttrKwd_list.h"
+#undef ATTR_KWD
+  none ///< 不正値
+};
+
+/// @brief 属性名の数
+const SizeType ATTR_KWD_NUM = static_cast<SizeType>(AttrKwd::none);
+
+/// @brief 属性名から AttrKwd を得る．
+///
+/// 登録されていない属性名の場合は AttrKwd::none を返す．
+extern
+AttrKwd
+attr_kwd(
+  const string& kwd ///< [in] 属性名
+);
+
+/// @brief AttrKwd の属性名を返す．
+extern
+const char*
+attr_kwd_str(
+  AttrKwd kwd ///< [in] 属性名を表す値
+);
+
+END_NAMESPACE_YM_DOTLIB
+
+#endif // ATTRKWD_H
@@ -0,0 +1,606 @@
+﻿ATTR_KWD(area, "area")
+ATTR_KWD(area_coefficent, "area_coefficent")
+ATTR_KWD(auxiliary_pad_cell, "auxiliary_pad_cell")
+ATTR_KWD(average_number_of_faults, "average_number_of_faults")
+ATTR_KWD(base_curve_type, "base_curve_type")
+ATTR_KWD(base_curves, "base_curves")
+ATTR_KWD(base_curves_group, "base_curves_group")
+ATTR_KWD(base_name, "base_name")
+ATTR_KWD(base_type, "base_type")
+ATTR_KWD(bit_from, "bit_from")
+ATTR_KWD(bit_to, "bit_to")
+ATTR_KWD(bit_width, "bit_width")
+ATTR_KWD(bundle, "bundle")
+ATTR_KWD(bus, "bus")
+ATTR_KWD(bus_naming_style, "bus_naming_style")
+ATTR_KWD(bus_type, "bus_type")
+ATTR_KWD(calc_mode, "calc_mode")
+ATTR_KWD(capacitance, "capacitance")
+ATTR_KWD(capacitive_load_unit, "capacitive_load_unit")
+ATTR_KWD(ccsn_first_stage, "ccsn_first_stage")
+ATTR_KWD(ccsn_last_stage, "ccsn_last_stage")
+ATTR_KWD(cell, "cell")
+ATTR_KWD(cell_degradation, "cell_degradation")
+ATTR_KWD(cell_fall, "cell_fall")
+ATTR_KWD(cell_footprint, "cell_footprint")
+ATTR_KWD(cell_leakage_power, "cell_leakage_power")
+ATTR_KWD(cell_name, "cell_name")
+ATTR_KWD(cell_rise, "cell_rise")
+ATTR_KWD(clear, "clear")
+ATTR_KWD(clear_preset_var1, "clear_preset_var1")
+ATTR_KWD(clear_preset_var2, "clear_preset_var2")
+ATTR_KWD(cleare_preset_var1, "cleare_preset_var1")
+ATTR_KWD(cleare_preset_var2, "cleare_preset_var2")
+ATTR_KWD(clock, "clock")
+ATTR_KWD(clock_gate_clock_pin, "clock_gate_clock_pin")
+ATTR_KWD(clock_gate_enable_pin, "clock_gate_enable_pin")
+ATTR_KWD(clock_gate_obs_pin, "clock_gate_obs_pin")
+ATTR_KWD(clock_gate_out_pin, "clock_gate_out_pin")
+ATTR_KWD(clock_gate_test_pin, "clock_gate_test_pin")
+ATTR_KWD(clock_gating_flag, "clock_gating_flag")
+ATTR_KWD(clock_gating_integrated_cell, "clock_gating_integrated_cell")
+ATTR_KWD(clock_pin, "clock_pin")
+ATTR_KWD(clocked_on, "clocked_on")
+ATTR_KWD(clocked_on_also, "clocked_on_also")
+ATTR_KWD(coefs, "coefs")
+ATTR_KWD(comment, "comment")
+ATTR_KWD(compact_ccs_fall, "compact_ccs_fall")
+ATTR_KWD(compact_ccs_rise, "compact_ccs_rise")
+ATTR_KWD(compact_lut_template, "compact_lut_template")
+ATTR_KWD(complementary_pin, "complementary_pin")
+ATTR_KWD(connection_class, "connection_class")
+ATTR_KWD(constraint, "constraint")
+ATTR_KWD(constraint_high, "constraint_high")
+ATTR_KWD(constraint_low, "constraint_low")
+ATTR_KWD(contention_condition, "contention_condition")
+ATTR_KWD(current_unit, "current_unit")
+ATTR_KWD(curve_x, "curve_x")
+ATTR_KWD(curve_y, "curve_y")
+ATTR_KWD(data_in, "data_in")
+ATTR_KWD(data_type, "data_type")
+ATTR_KWD(date, "date")
+ATTR_KWD(dc_current, "dc_current")
+ATTR_KWD(dc_current_template, "dc_current_template")
+ATTR_KWD(default_cell_leakage_power, "default_cell_leakage_power")
+ATTR_KWD(default_connection_class, "default_connection_class")
+ATTR_KWD(default_fall_delay_intercept, "default_fall_delay_intercept")
+ATTR_KWD(default_fall_pin_resistance, "default_fall_pin_resistance")
+ATTR_KWD(default_fanout_load, "default_fanout_load")
+ATTR_KWD(default_fpga_isd, "default_fpga_isd")
+ATTR_KWD(default_inout_pin_cap, "default_inout_pin_cap")
+ATTR_KWD(default_inout_pin_fall_res, "default_inout_pin_fall_res")
+ATTR_KWD(default_inout_pin_rise_res, "default_inout_pin_rise_res")
+ATTR_KWD(default_input_pin_cap, "default_input_pin_cap")
+ATTR_KWD(default_input_pin_fall_res, "default_input_pin_fall_res")
+ATTR_KWD(default_input_pin_rise_res, "default_input_pin_rise_res")
+ATTR_KWD(default_intrinsic_fall, "default_intrinsic_fall")
+ATTR_KWD(default_intrinsic_rise, "default_intrinsic_rise")
+ATTR_KWD(default_leakage_power_density, "default_leakage_power_density")
+ATTR_KWD(default_max_capacitance, "default_max_capacitance")
+ATTR_KWD(default_max_fanout, "default_max_fanout")
+ATTR_KWD(default_max_transition, "default_max_transition")
+ATTR_KWD(default_max_utilization, "default_max_utilization")
+ATTR_KWD(default_min_porosity, "default_min_porosity")
+ATTR_KWD(default_operating_conditions, "default_operating_conditions")
+ATTR_KWD(default_output_pin_cap, "default_output_pin_cap")
+ATTR_KWD(default_output_pin_fall_res, "default_output_pin_fall_res")
+ATTR_KWD(default_output_pin_rise_res, "default_output_pin_rise_res")
+ATTR_KWD(default_part, "default_part")
+ATTR_KWD(default_power_rail, "default_power_rail")
+ATTR_KWD(default_rise_delay_intercept, "default_rise_delay_intercept")
+ATTR_KWD(default_rise_pin_resistance, "default_rise_pin_resistance")
+ATTR_KWD(default_slope_fall, "default_slope_fall")
+ATTR_KWD(default_slope_rise, "default_slope_rise")
+ATTR_KWD(default_step_level, "default_step_level")
+ATTR_KWD(default_threshold_voltage_group, "default_threshold_voltage_group")
+ATTR_KWD(default_timing, "default_timing")
+ATTR_KWD(default_wire_load, "default_wire_load")
+ATTR_KWD(default_wire_load_area, "default_wire_load_area")
+ATTR_KWD(default_wire_load_capacitance, "default_wire_load_capacitance")
+ATTR_KWD(default_wire_load_mode, "default_wire_load_mode")
+ATTR_KWD(default_wire_load_resistance, "default_wire_load_resistance")
+ATTR_KWD(default_wire_load_selection, "default_wire_load_selection")
+ATTR_KWD(define, "define")
+ATTR_KWD(define_cell_area, "define_cell_area")
+ATTR_KWD(define_group, "define_group")
+ATTR_KWD(delay_model, "delay_model")
+ATTR_KWD(direction, "direction")
+ATTR_KWD(divided_by, "divided_by")
+ATTR_KWD(domain, "domain")
+ATTR_KWD(dont_fault, "dont_fault")
+ATTR_KWD(dont_touch, "dont_touch")
+ATTR_KWD(dont_use, "dont_use")
+ATTR_KWD(downto, "downto")
+ATTR_KWD(drive, "drive")
+ATTR_KWD(drive_current, "drive_current")
+ATTR_KWD(driver_type, "driver_type")
+ATTR_KWD(duty_cycle, "duty_cycle")
+ATTR_KWD(dynamic_current, "dynamic_current")
+ATTR_KWD(edge_type, "edge_type")
+ATTR_KWD(edges, "edges")
+ATTR_KWD(edif_name, "edif_name")
+ATTR_KWD(electromigration, "electromigration")
+ATTR_KWD(em_lut_template, "em_lut_template")
+ATTR_KWD(em_max_toggle_rate, "em_max_toggle_rate")
+ATTR_KWD(em_temp_degradation_factor, "em_temp_degradation_factor")
+ATTR_KWD(enable, "enable")
+ATTR_KWD(enable_also, "enable_also")
+ATTR_KWD(equal_or_opposite_output, "equal_or_opposite_output")
+ATTR_KWD(fall_capacitance, "fall_capacitance")
+ATTR_KWD(fall_capacitance_range, "fall_capacitance_range")
+ATTR_KWD(fall_constraint, "fall_constraint")
+ATTR_KWD(fall_current_slope_after_threshold, "fall_current_slope_after_threshold")
+ATTR_KWD(fall_current_slope_before_threshold, "fall_current_slope_before_threshold")
+ATTR_KWD(fall_delay_intercept, "fall_delay_intercept")
+ATTR_KWD(fall_net_delay, "fall_net_delay")
+ATTR_KWD(fall_pin_resistance, "fall_pin_resistance")
+ATTR_KWD(fall_power, "fall_power")
+ATTR_KWD(fall_propagation, "fall_propagation")
+ATTR_KWD(fall_resistance, "fall_resistance")
+ATTR_KWD(fall_time_after_threshold, "fall_time_after_threshold")
+ATTR_KWD(fall_time_before_threshold, "fall_time_before_threshold")
+ATTR_KWD(fall_transition, "fall_transition")
+ATTR_KWD(fall_transition_degradation, "fall_transition_degradation")
+ATTR_KWD(falling_together_group, "falling_together_group")
+ATTR_KWD(fanout_area, "fanout_area")
+ATTR_KWD(fanout_capacitance, "fanout_capacitance")
+ATTR_KWD(fanout_length, "fanout_length")
+ATTR_KWD(fanout_load, "fanout_load")
+ATTR_KWD(fanout_resistance, "fanout_resistance")
+ATTR_KWD(faster_factor, "faster_factor")
+ATTR_KWD(fault_model, "fault_model")
+ATTR_KWD(faults_lut_template, "faults_lut_template")
+ATTR_KWD(ff, "ff")
+ATTR_KWD(ff_bank, "ff_bank")
+ATTR_KWD(fpga_arc_condition, "fpga_arc_condition")
+ATTR_KWD(fpga_cell_type, "fpga_cell_type")
+ATTR_KWD(fpga_condition, "fpga_condition")
+ATTR_KWD(fpga_condition_value, "fpga_condition_value")
+ATTR_KWD(fpga_domain_style, "fpga_domain_style")
+ATTR_KWD(fpga_isd, "fpga_isd")
+ATTR_KWD(fpga_technology, "fpga_technology")
+ATTR_KWD(function, "function")
+ATTR_KWD(functional_yield_metric, "functional_yield_metric")
+ATTR_KWD(gate_leakage, "gate_leakage")
+ATTR_KWD(generated_clock, "generated_clock")
+ATTR_KWD(geometry_print, "geometry_print")
+ATTR_KWD(handle_negative_constraint, "handle_negative_constraint")
+ATTR_KWD(has_builtin_pad, "has_builtin_pad")
+ATTR_KWD(height_coefficient, "height_coefficient")
+ATTR_KWD(hyperbolic_noise_above_high, "hyperbolic_noise_above_high")
+ATTR_KWD(hyperbolic_noise_below_low, "hyperbolic_noise_below_low")
+ATTR_KWD(hyperbolic_noise_high, "hyperbolic_noise_high")
+ATTR_KWD(hyperbolic_noise_low, "hyperbolic_noise_low")
+ATTR_KWD(hysterisis, "hysterisis")
+ATTR_KWD(in_place_swap_mode, "in_place_swap_mode")
+ATTR_KWD(index_1, "index_1")
+ATTR_KWD(index_2, "index_2")
+ATTR_KWD(index_3, "index_3")
+ATTR_KWD(index_4, "index_4")
+ATTR_KWD(index_output, "index_output")
+ATTR_KWD(input_high_value, "input_high_value")
+ATTR_KWD(input_low_value, "input_low_value")
+ATTR_KWD(input_map, "input_map")
+ATTR_KWD(input_pins, "input_pins")
+ATTR_KWD(input_signal_level, "input_signal_level")
+ATTR_KWD(input_switching_condition, "input_switching_condition")
+ATTR_KWD(input_threshold_pct_fall, "input_threshold_pct_fall")
+ATTR_KWD(input_threshold_pct_rise, "input_threshold_pct_rise")
+ATTR_KWD(input_voltage, "input_voltage")
+ATTR_KWD(input_voltage_range, "input_voltage_range")
+ATTR_KWD(interdependence_id, "interdependence_id")
+ATTR_KWD(interface_timing, "interface_timing")
+ATTR_KWD(internal_node, "internal_node")
+ATTR_KWD(internal_power, "internal_power")
+ATTR_KWD(intrinsic_capacitance, "intrinsic_capacitance")
+ATTR_KWD(intrinsic_fall, "intrinsic_fall")
+ATTR_KWD(intrinsic_parasitic, "intrinsic_parasitic")
+ATTR_KWD(intrinsic_resistance, "intrinsic_resistance")
+ATTR_KWD(intrinsic_rise, "intrinsic_rise")
+ATTR_KWD(invert, "invert")
+ATTR_KWD(inverted_output, "inverted_output")
+ATTR_KWD(io_type, "io_type")
+ATTR_KWD(is_clock_gating_cell, "is_clock_gating_cell")
+ATTR_KWD(is_inverting, "is_inverting")
+ATTR_KWD(is_isolation_cell, "is_isolation_cell")
+ATTR_KWD(is_level_shifter, "is_level_shifter")
+ATTR_KWD(is_needge, "is_needge")
+ATTR_KWD(is_pad, "is_pad")
+ATTR_KWD(isolation_cell_enable_pin, "isolation_cell_enable_pin")
+ATTR_KWD(iv_lut_template, "iv_lut_template")
+ATTR_KWD(k_process_cell_fall, "k_process_cell_fall")
+ATTR_KWD(k_process_cell_leakage_power, "k_process_cell_leakage_power")
+ATTR_KWD(k_process_cell_rise, "k_process_cell_rise")
+ATTR_KWD(k_process_drive_current, "k_process_drive_current")
+ATTR_KWD(k_process_drive_fall, "k_process_drive_fall")
+ATTR_KWD(k_process_drive_rise, "k_process_drive_rise")
+ATTR_KWD(k_process_fall_delay_intercept, "k_process_fall_delay_intercept")
+ATTR_KWD(k_process_fall_pin_resistance, "k_process_fall_pin_resistance")
+ATTR_KWD(k_process_fall_propagation, "k_process_fall_propagation")
+ATTR_KWD(k_process_fall_transition, "k_process_fall_transition")
+ATTR_KWD(k_process_hold_fall, "k_process_hold_fall")
+ATTR_KWD(k_process_hold_rise, "k_process_hold_rise")
+ATTR_KWD(k_process_internal_power, "k_process_internal_power")
+ATTR_KWD(k_process_intrinsic_fall, "k_process_intrinsic_fall")
+ATTR_KWD(k_process_intrinsic_rise, "k_process_intrinsic_rise")
+ATTR_KWD(k_process_min_period, "k_process_min_period")
+ATTR_KWD(k_process_min_pulse_width_high, "k_process_min_pulse_width_high")
+ATTR_KWD(k_process_min_pulse_width_low, "k_process_min_pulse_width_low")
+ATTR_KWD(k_process_nochange_fall, "k_process_nochange_fall")
+ATTR_KWD(k_process_nochange_rise, "k_process_nochange_rise")
+ATTR_KWD(k_process_pin_cap, "k_process_pin_cap")
+ATTR_KWD(k_process_recovery_fall, "k_process_recovery_fall")
+ATTR_KWD(k_process_recovery_rise, "k_process_recovery_rise")
+ATTR_KWD(k_process_removal_fall, "k_process_removal_fall")
+ATTR_KWD(k_process_removal_rise, "k_process_removal_rise")
+ATTR_KWD(k_process_rise_delay_intercept, "k_process_rise_delay_intercept")
+ATTR_KWD(k_process_rise_pin_resistance, "k_process_rise_pin_resistance")
+ATTR_KWD(k_process_rise_propagation, "k_process_rise_propagation")
+ATTR_KWD(k_process_rise_transition, "k_process_rise_transition")
+ATTR_KWD(k_process_setup_fall, "k_process_setup_fall")
+ATTR_KWD(k_process_setup_rise, "k_process_setup_rise")
+ATTR_KWD(k_process_skew_fall, "k_process_skew_fall")
+ATTR_KWD(k_process_skew_rise, "k_process_skew_rise")
+ATTR_KWD(k_process_slope_fall, "k_process_slope_fall")
+ATTR_KWD(k_process_slope_rise, "k_process_slope_rise")
+ATTR_KWD(k_process_wire_cap, "k_process_wire_cap")
+ATTR_KWD(k_process_wire_res, "k_process_wire_res")
+ATTR_KWD(k_temp_cell_fall, "k_temp_cell_fall")
+ATTR_KWD(k_temp_cell_leakage_power, "k_temp_cell_leakage_power")
+ATTR_KWD(k_temp_cell_rise, "k_temp_cell_rise")
+ATTR_KWD(k_temp_drive_current, "k_temp_drive_current")
+ATTR_KWD(k_temp_drive_fall, "k_temp_drive_fall")
+ATTR_KWD(k_temp_drive_rise, "k_temp_drive_rise")
+ATTR_KWD(k_temp_fall_delay_intercept, "k_temp_fall_delay_intercept")
+ATTR_KWD(k_temp_fall_pin_resistance, "k_temp_fall_pin_resistance")
+ATTR_KWD(k_temp_fall_propagation, "k_temp_fall_propagation")
+ATTR_KWD(k_temp_fall_transition, "k_temp_fall_transition")
+ATTR_KWD(k_temp_hold_fall, "k_temp_hold_fall")
+ATTR_KWD(k_temp_hold_rise, "k_temp_hold_rise")
+ATTR_KWD(k_temp_internal_power, "k_temp_internal_power")
+ATTR_KWD(k_temp_intrinsic_fall, "k_temp_intrinsic_fall")
+ATTR_KWD(k_temp_intrinsic_rise, "k_temp_intrinsic_rise")
+ATTR_KWD(k_temp_min_period, "k_temp_min_period")
+ATTR_KWD(k_temp_min_pulse_width_high, "k_temp_min_pulse_width_high")
+ATTR_KWD(k_temp_min_pulse_width_low, "k_temp_min_pulse_width_low")
+ATTR_KWD(k_temp_nochange_fall, "k_temp_nochange_fall")
+ATTR_KWD(k_temp_nochange_rise, "k_temp_nochange_rise")
+ATTR_KWD(k_temp_pin_cap, "k_temp_pin_cap")
+ATTR_KWD(k_temp_recovery_fall, "k_temp_recovery_fall")
+ATTR_KWD(k_temp_recovery_rise, "k_temp_recovery_rise")
+ATTR_KWD(k_temp_removal_fall, "k_temp_removal_fall")
+ATTR_KWD(k_temp_removal_rise, "k_temp_removal_rise")
+ATTR_KWD(k_temp_rise_delay_intercept, "k_temp_rise_delay_intercept")
+ATTR_KWD(k_temp_rise_pin_resistance, "k_temp_rise_pin_resistance")
+ATTR_KWD(k_temp_rise_propagation, "k_temp_rise_propagation")
+ATTR_KWD(k_temp_rise_transition, "k_temp_rise_transition")
+ATTR_KWD(k_temp_setup_fall, "k_temp_setup_fall")
+ATTR_KWD(k_temp_setup_rise, "k_temp_setup_rise")
+ATTR_KWD(k_temp_skew_fall, "k_temp_skew_fall")
+ATTR_KWD(k_temp_skew_rise, "k_temp_skew_rise")
+ATTR_KWD(k_temp_slope_fall, "k_temp_slope_fall")
+ATTR_KWD(k_temp_slope_rise, "k_temp_slope_rise")
+ATTR_KWD(k_temp_wire_cap, "k_temp_wire_cap")
+ATTR_KWD(k_temp_wire_res, "k_temp_wire_res")
+ATTR_KWD(k_volt_cell_fall, "k_volt_cell_fall")
+ATTR_KWD(k_volt_cell_leakage_power, "k_volt_cell_leakage_power")
+ATTR_KWD(k_volt_cell_rise, "k_volt_cell_rise")
+ATTR_KWD(k_volt_drive_current, "k_volt_drive_current")
+ATTR_KWD(k_volt_drive_fall, "k_volt_drive_fall")
+ATTR_KWD(k_volt_drive_rise, "k_volt_drive_rise")
+ATTR_KWD(k_volt_fall_delay_intercept, "k_volt_fall_delay_intercept")
+ATTR_KWD(k_volt_fall_pin_resistance, "k_volt_fall_pin_resistance")
+ATTR_KWD(k_volt_fall_propagation, "k_volt_fall_propagation")
+ATTR_KWD(k_volt_fall_transition, "k_volt_fall_transition")
+ATTR_KWD(k_volt_hold_fall, "k_volt_hold_fall")
+ATTR_KWD(k_volt_hold_rise, "k_volt_hold_rise")
+ATTR_KWD(k_volt_internal_power, "k_volt_internal_power")
+ATTR_KWD(k_volt_intrinsic_fall, "k_volt_intrinsic_fall")
+ATTR_KWD(k_volt_intrinsic_rise, "k_volt_intrinsic_rise")
+ATTR_KWD(k_volt_min_period, "k_volt_min_period")
+ATTR_KWD(k_volt_min_pulse_width_high, "k_volt_min_pulse_width_high")
+ATTR_KWD(k_volt_min_pulse_width_low, "k_volt_min_pulse_width_low")
+ATTR_KWD(k_volt_nochange_fall, "k_volt_nochange_fall")
+ATTR_KWD(k_volt_nochange_rise, "k_volt_nochange_rise")
+ATTR_KWD(k_volt_pin_cap, "k_volt_pin_cap")
+ATTR_KWD(k_volt_recovery_fall, "k_volt_recovery_fall")
+ATTR_KWD(k_volt_recovery_rise, "k_volt_recovery_rise")
+ATTR_KWD(k_volt_removal_fall, "k_volt_removal_fall")
+ATTR_KWD(k_volt_removal_rise, "k_volt_removal_rise")
+ATTR_KWD(k_volt_rise_delay_intercept, "k_volt_rise_delay_intercept")
+ATTR_KWD(k_volt_rise_pin_resistance, "k_volt_rise_pin_resistance")
+ATTR_KWD(k_volt_rise_propagation, "k_volt_rise_propagation")
+ATTR_KWD(k_volt_rise_transition, "k_volt_rise_transition")
+ATTR_KWD(k_volt_setup_fall, "k_volt_setup_fall")
+ATTR_KWD(k_volt_setup_rise, "k_volt_setup_rise")
+ATTR_KWD(k_volt_skew_fall, "k_volt_skew_fall")
+ATTR_KWD(k_volt_skew_rise, "k_volt_skew_rise")
+ATTR_KWD(k_volt_slope_fall, "k_volt_slope_fall")
+ATTR_KWD(k_volt_slope_rise, "k_volt_slope_rise")
+ATTR_KWD(k_volt_wire_cap, "k_volt_wire_cap")
+ATTR_KWD(k_volt_wire_res, "k_volt_wire_res")
+ATTR_KWD(latch, "latch")
+ATTR_KWD(latch_bank, "latch_bank")
+ATTR_KWD(leakage_current, "leakage_current")
+ATTR_KWD(leakage_power, "leakage_power")
+ATTR_KWD(leakage_power_unit, "leakage_power_unit")
+ATTR_KWD(level_shifter_enable_pin, "level_shifter_enable_pin")
+ATTR_KWD(level_shifter_type, "level_shifter_type")
+ATTR_KWD(library, "library")
+ATTR_KWD(library_features, "library_features")
+ATTR_KWD(lower, "lower")
+ATTR_KWD(lu_table_template, "lu_table_template")
+ATTR_KWD(lut, "lut")
+ATTR_KWD(map_only, "map_only")
+ATTR_KWD(map_to_logic, "map_to_logic")
+ATTR_KWD(mapping, "mapping")
+ATTR_KWD(master_pin, "master_pin")
+ATTR_KWD(max_cap, "max_cap")
+ATTR_KWD(max_capacitance, "max_capacitance")
+ATTR_KWD(max_count, "max_count")
+ATTR_KWD(max_fanout, "max_fanout")
+ATTR_KWD(max_input_noise_width, "max_input_noise_width")
+ATTR_KWD(max_input_switching_count, "max_input_switching_count")
+ATTR_KWD(max_trans, "max_trans")
+ATTR_KWD(max_transition, "max_transition")
+ATTR_KWD(maxcap_lut_template, "maxcap_lut_template")
+ATTR_KWD(maxtrans_lut_template, "maxtrans_lut_template")
+ATTR_KWD(members, "members")
+ATTR_KWD(miller_cap_fall, "miller_cap_fall")
+ATTR_KWD(miller_cap_rise, "miller_cap_rise")
+ATTR_KWD(min_capacitance, "min_capacitance")
+ATTR_KWD(min_fanout, "min_fanout")
+ATTR_KWD(min_input_noise_width, "min_input_noise_width")
+ATTR_KWD(min_input_switching_count, "min_input_switching_count")
+ATTR_KWD(min_period, "min_period")
+ATTR_KWD(min_pulse_width, "min_pulse_width")
+ATTR_KWD(min_pulse_width_high, "min_pulse_width_high")
+ATTR_KWD(min_pulse_width_low, "min_pulse_width_low")
+ATTR_KWD(min_transition, "min_transition")
+ATTR_KWD(minimum_period, "minimum_period")
+ATTR_KWD(mode, "mode")
+ATTR_KWD(mode_definition, "mode_definition")
+ATTR_KWD(mode_value, "mode_value")
+ATTR_KWD(multicell_pad_pin, "multicell_pad_pin")
+ATTR_KWD(multipled_by, "multipled_by")
+ATTR_KWD(next_state, "next_state")
+ATTR_KWD(nextstate_type, "nextstate_type")
+ATTR_KWD(noise_immunity_above_high, "noise_immunity_above_high")
+ATTR_KWD(noise_immunity_below_low, "noise_immunity_below_low")
+ATTR_KWD(noise_immunity_high, "noise_immunity_high")
+ATTR_KWD(noise_immunity_low, "noise_immunity_low")
+ATTR_KWD(noise_lut_template, "noise_lut_template")
+ATTR_KWD(nom_calc_mode, "nom_calc_mode")
+ATTR_KWD(nom_process, "nom_process")
+ATTR_KWD(nom_temperature, "nom_temperature")
+ATTR_KWD(nom_voltage, "nom_voltage")
+ATTR_KWD(num_blockrams, "num_blockrams")
+ATTR_KWD(num_cols, "num_cols")
+ATTR_KWD(num_ffs, "num_ffs")
+ATTR_KWD(num_luts, "num_luts")
+ATTR_KWD(num_rows, "num_rows")
+ATTR_KWD(operating_conditions, "operating_conditions")
+ATTR_KWD(orders, "orders")
+ATTR_KWD(output_current_fall, "output_current_fall")
+ATTR_KWD(output_current_rise, "output_current_rise")
+ATTR_KWD(output_current_template, "output_current_template")
+ATTR_KWD(output_signal_level, "output_signal_level")
+ATTR_KWD(output_switching_condition, "output_switching_condition")
+ATTR_KWD(output_threshold_pct_fall, "output_threshold_pct_fall")
+ATTR_KWD(output_threshold_pct_rise, "output_threshold_pct_rise")
+ATTR_KWD(output_voltage, "output_voltage")
+ATTR_KWD(output_voltage_range, "output_voltage_range")
+ATTR_KWD(pad_cell, "pad_cell")
+ATTR_KWD(pad_type, "pad_type")
+ATTR_KWD(parametr1, "parametr1")
+ATTR_KWD(parametr2, "parametr2")
+ATTR_KWD(parametr3, "parametr3")
+ATTR_KWD(parametr4, "parametr4")
+ATTR_KWD(parametr5, "parametr5")
+ATTR_KWD(part, "part")
+ATTR_KWD(pg_current, "pg_current")
+ATTR_KWD(pg_function, "pg_function")
+ATTR_KWD(pg_pin, "pg_pin")
+ATTR_KWD(pg_type, "pg_type")
+ATTR_KWD(piece_define, "piece_define")
+ATTR_KWD(piece_type, "piece_type")
+ATTR_KWD(pin, "pin")
+ATTR_KWD(pin_capacitance, "pin_capacitance")
+ATTR_KWD(pin_count, "pin_count")
+ATTR_KWD(pin_equal, "pin_equal")
+ATTR_KWD(pin_func_type, "pin_func_type")
+ATTR_KWD(pin_name_map, "pin_name_map")
+ATTR_KWD(pin_names, "pin_names")
+ATTR_KWD(pin_opposite, "pin_opposite")
+ATTR_KWD(poly_template, "poly_template")
+ATTR_KWD(power, "power")
+ATTR_KWD(power_cell_type, "power_cell_type")
+ATTR_KWD(power_down_function, "power_down_function")
+ATTR_KWD(power_gating_cell, "power_gating_cell")
+ATTR_KWD(power_gating_pin, "power_gating_pin")
+ATTR_KWD(power_level, "power_level")
+ATTR_KWD(power_lut_template, "power_lut_template")
+ATTR_KWD(power_model, "power_model")
+ATTR_KWD(power_poly_template, "power_poly_template")
+ATTR_KWD(power_rail, "power_rail")
+ATTR_KWD(power_supply, "power_supply")
+ATTR_KWD(power_unit, "power_unit")
+ATTR_KWD(powerlevel, "powerlevel")
+ATTR_KWD(powerrail, "powerrail")
+ATTR_KWD(prefer_tied, "prefer_tied")
+ATTR_KWD(preferred, "preferred")
+ATTR_KWD(preferred_input_pad_voltage, "preferred_input_pad_voltage")
+ATTR_KWD(preferred_output_pad_slew_rate_control, "preferred_output_pad_slew_rate_control")
+ATTR_KWD(preferred_output_pad_voltage, "preferred_output_pad_voltage")
+ATTR_KWD(preset, "preset")
+ATTR_KWD(primary_output, "primary_output")
+ATTR_KWD(process, "process")
+ATTR_KWD(propagated_noise_height_above_high, "propagated_noise_height_above_high")
+ATTR_KWD(propagated_noise_height_below_low, "propagated_noise_height_below_low")
+ATTR_KWD(propagated_noise_height_high, "propagated_noise_height_high")
+ATTR_KWD(propagated_noise_height_low, "propagated_noise_height_low")
+ATTR_KWD(propagated_noise_peak_time_ratio_above_high, "propagated_noise_peak_time_ratio_above_high")
+ATTR_KWD(propagated_noise_peak_time_ratio_below_low, "propagated_noise_peak_time_ratio_below_low")
+ATTR_KWD(propagated_noise_peak_time_ratio_high, "propagated_noise_peak_time_ratio_high")
+ATTR_KWD(propagated_noise_peak_time_ratio_low, "propagated_noise_peak_time_ratio_low")
+ATTR_KWD(propagated_noise_width_above_high, "propagated_noise_width_above_high")
+ATTR_KWD(propagated_noise_width_below_low, "propagated_noise_width_below_low")
+ATTR_KWD(propagated_noise_width_high, "propagated_noise_width_high")
+ATTR_KWD(propagated_noise_width_low, "propagated_noise_width_low")
+ATTR_KWD(propagation_lut_template, "propagation_lut_template")
+ATTR_KWD(pulling_current, "pulling_current")
+ATTR_KWD(pulling_resistance, "pulling_resistance")
+ATTR_KWD(pulling_resistance_unit, "pulling_resistance_unit")
+ATTR_KWD(pulse_clock, "pulse_clock")
+ATTR_KWD(rail_connection, "rail_connection")
+ATTR_KWD(receiver_capacitance1_fall, "receiver_capacitance1_fall")
+ATTR_KWD(receiver_capacitance1_rise, "receiver_capacitance1_rise")
+ATTR_KWD(receiver_capacitance2_fall, "receiver_capacitance2_fall")
+ATTR_KWD(receiver_capacitance2_rise, "receiver_capacitance2_rise")
+ATTR_KWD(reference_time, "reference_time")
+ATTR_KWD(related_bus_equivalent, "related_bus_equivalent")
+ATTR_KWD(related_bus_pins, "related_bus_pins")
+ATTR_KWD(related_ground_pin, "related_ground_pin")
+ATTR_KWD(related_inputs, "related_inputs")
+ATTR_KWD(related_output, "related_output")
+ATTR_KWD(related_output_pin, "related_output_pin")
+ATTR_KWD(related_outputs, "related_outputs")
+ATTR_KWD(related_pg_pin, "related_pg_pin")
+ATTR_KWD(related_pin, "related_pin")
+ATTR_KWD(related_power_pin, "related_power_pin")
+ATTR_KWD(resistance, "resistance")
+ATTR_KWD(resistance_unit, "resistance_unit")
+ATTR_KWD(resource_usage, "resource_usage")
+ATTR_KWD(retain_fall_slew, "retain_fall_slew")
+ATTR_KWD(retain_rise_slew, "retain_rise_slew")
+ATTR_KWD(retaining_fall, "retaining_fall")
+ATTR_KWD(retaining_rise, "retaining_rise")
+ATTR_KWD(revision, "revision")
+ATTR_KWD(rise_capacitance, "rise_capacitance")
+ATTR_KWD(rise_capacitance_range, "rise_capacitance_range")
+ATTR_KWD(rise_constraint, "rise_constraint")
+ATTR_KWD(rise_current_slope_after_threshold, "rise_current_slope_after_threshold")
+ATTR_KWD(rise_current_slope_before_threshold, "rise_current_slope_before_threshold")
+ATTR_KWD(rise_delay_intercept, "rise_delay_intercept")
+ATTR_KWD(rise_net_delay, "rise_net_delay")
+ATTR_KWD(rise_pin_resistance, "rise_pin_resistance")
+ATTR_KWD(rise_power, "rise_power")
+ATTR_KWD(rise_propagation, "rise_propagation")
+ATTR_KWD(rise_resistance, "rise_resistance")
+ATTR_KWD(rise_time_after_threshold, "rise_time_after_threshold")
+ATTR_KWD(rise_time_before_threshold, "rise_time_before_threshold")
+ATTR_KWD(rise_transition, "rise_transition")
+ATTR_KWD(rise_transition_degradation, "rise_transition_degradation")
+ATTR_KWD(rising_together_group, "rising_together_group")
+ATTR_KWD(routing_layers, "routing_layers")
+ATTR_KWD(routing_track, "routing_track")
+ATTR_KWD(scaled_cell, "scaled_cell")
+ATTR_KWD(scaling_factors, "scaling_factors")
+ATTR_KWD(sdf_cond, "sdf_cond")
+ATTR_KWD(sdf_cond_end, "sdf_cond_end")
+ATTR_KWD(sdf_cond_start, "sdf_cond_start")
+ATTR_KWD(sdf_edges, "sdf_edges")
+ATTR_KWD(sensitization, "sensitization")
+ATTR_KWD(sensitization_master, "sensitization_master")
+ATTR_KWD(shifts, "shifts")
+ATTR_KWD(short_, "short")
+ATTR_KWD(signal_type, "signal_type")
+ATTR_KWD(simulation, "simulation")
+ATTR_KWD(single_bit_degenerate, "single_bit_degenerate")
+ATTR_KWD(slew, "slew")
+ATTR_KWD(slew_control, "slew_control")
+ATTR_KWD(slew_derate_from_library, "slew_derate_from_library")
+ATTR_KWD(slew_lower_threshold_pct_fall, "slew_lower_threshold_pct_fall")
+ATTR_KWD(slew_lower_threshold_pct_rise, "slew_lower_threshold_pct_rise")
+ATTR_KWD(slew_type, "slew_type")
+ATTR_KWD(slew_upper_threshold_pct_fall, "slew_upper_threshold_pct_fall")
+ATTR_KWD(slew_upper_threshold_pct_rise, "slew_upper_threshold_pct_rise")
+ATTR_KWD(slope, "slope")
+ATTR_KWD(slope_fall, "slope_fall")
+ATTR_KWD(slope_rise, "slope_rise")
+ATTR_KWD(slower_factor, "slower_factor")
+ATTR_KWD(stage_type, "stage_type")
+ATTR_KWD(state_function, "state_function")
+ATTR_KWD(state_table, "state_table")
+ATTR_KWD(statetable, "statetable")
+ATTR_KWD(std_cell_main_rail, "std_cell_main_rail")
+ATTR_KWD(steady_state_current_high, "steady_state_current_high")
+ATTR_KWD(steady_state_current_low, "steady_state_current_low")
+ATTR_KWD(steady_state_current_tristate, "steady_state_current_tristate")
+ATTR_KWD(steady_state_resistance_above_high, "steady_state_resistance_above_high")
+ATTR_KWD(steady_state_resistance_below_low, "steady_state_resistance_below_low")
+ATTR_KWD(steady_state_resistance_high, "steady_state_resistance_high")
+ATTR_KWD(steady_state_resistance_low, "steady_state_resistance_low")
+ATTR_KWD(step_level, "step_level")
+ATTR_KWD(switch_cell_type, "switch_cell_type")
+ATTR_KWD(switch_function, "switch_function")
+ATTR_KWD(switch_pin, "switch_pin")
+ATTR_KWD(switching_group, "switching_group")
+ATTR_KWD(switching_interval, "switching_interval")
+ATTR_KWD(switching_together_group, "switching_together_group")
+ATTR_KWD(table, "table")
+ATTR_KWD(tdisable, "tdisable")
+ATTR_KWD(technology, "technology")
+ATTR_KWD(temperature, "temperature")
+ATTR_KWD(test_cell, "test_cell")
+ATTR_KWD(test_output_only, "test_output_only")
+ATTR_KWD(three_state, "three_state")
+ATTR_KWD(threshold_voltage_group, "threshold_voltage_group")
+ATTR_KWD(tied_off, "tied_off")
+ATTR_KWD(time_unit, "time_unit")
+ATTR_KWD(timing, "timing")
+ATTR_KWD(timing_model_type, "timing_model_type")
+ATTR_KWD(timing_range, "timing_range")
+ATTR_KWD(timing_sense, "timing_sense")
+ATTR_KWD(timing_type, "timing_type")
+ATTR_KWD(tlatch, "tlatch")
+ATTR_KWD(total_capacitance, "total_capacitance")
+ATTR_KWD(total_track_area, "total_track_area")
+ATTR_KWD(tracks, "tracks")
+ATTR_KWD(tree_type, "tree_type")
+ATTR_KWD(type, "type")
+ATTR_KWD(typical_capacitances, "typical_capacitances")
+ATTR_KWD(upper, "upper")
+ATTR_KWD(use_for_size_only, "use_for_size_only")
+ATTR_KWD(valid_speed_grade, "valid_speed_grade")
+ATTR_KWD(valid_step_levels, "valid_step_levels")
+ATTR_KWD(value, "value")
+ATTR_KWD(values, "values")
+ATTR_KWD(valures, "valures")
+ATTR_KWD(variable_1, "variable_1")
+ATTR_KWD(variable_1_range, "variable_1_range")
+ATTR_KWD(variable_2, "variable_2")
+ATTR_KWD(variable_2_range, "variable_2_range")
+ATTR_KWD(variable_3, "variable_3")
+ATTR_KWD(variable_3_range, "variable_3_range")
+ATTR_KWD(variable_n_range, "variable_n_range")
+ATTR_KWD(variables, "variables")
+ATTR_KWD(vector, "vector")
+ATTR_KWD(vhdl_name, "vhdl_name")
+ATTR_KWD(vih, "vih")
+ATTR_KWD(vil, "vil")
+ATTR_KWD(vimax, "vimax")
+ATTR_KWD(vimin, "vimin")
+ATTR_KWD(voh, "voh")
+ATTR_KWD(vol, "vol")
+ATTR_KWD(voltage, "voltage")
+ATTR_KWD(voltage_map, "voltage_map")
+ATTR_KWD(voltage_name, "voltage_name")
+ATTR_KWD(voltage_unit, "voltage_unit")
+ATTR_KWD(vomax, "vomax")
+ATTR_KWD(vomin, "vomin")
+ATTR_KWD(wave_fall, "wave_fall")
+ATTR_KWD(wave_fall_sampling_index, "wave_fall_sampling_index")
+ATTR_KWD(wave_fall_time_interval, "wave_fall_time_interval")
+ATTR_KWD(wave_rise, "wave_rise")
+ATTR_KWD(wave_rise_sampling_index, "wave_rise_sampling_index")
+ATTR_KWD(wave_rise_time_interval, "wave_rise_time_interval")
+ATTR_KWD(when, "when")
+ATTR_KWD(when_end, "when_end")
+ATTR_KWD(when_start, "when_start")
+ATTR_KWD(width_coefficient, "width_coefficient")
+ATTR_KWD(wire_load, "wire_load")
+ATTR_KWD(wire_load_from_area, "wire_load_from_area")
+ATTR_KWD(wire_load_selection, "wire_load_selection")
+ATTR_KWD(wire_load_table, "wire_load_table")
+ATTR_KWD(x_function, "x_function")
@@ -14,6 +14,7 @@
 #include "dotlib/LatchInfo.h"
 #include "dotlib/FSMInfo.h"
 #include "dotlib/PinInfo.h"
+#include "dotlib/LeakagePowerInfo.h"
 #include "ym/ShString.h"
 #include "ym/clib.h"
 
@@ -91,6 +92,10 @@ private:
   void
   set_pin();
 
+  /// @brief リーク電力の情報を取り出す．
+  void
+  set_leakage_power();
+
   /// @brief FF セルを作る．
   CiCell*
   add_ff_cell() const;
@@ -130,6 +135,12 @@ private:
   // ピンの情報
   vector<PinInfo> mPinInfoList;
 
+  // cell_leakage_power の値
+  double mCellLeakagePower{0.0};
+
+  // leakage_power の情報
+  vector<LeakagePowerInfo> mLeakagePowerInfoList;
+
   // 割当済みの入力ピン番号
   SizeType mInputId;
 
@@ -183,6 +183,13 @@ public:
     TokenType exp_type ///< [in] 期待値
   );
 
+  /// @brief これまでに読み込んだトークン数を返す．
+  SizeType
+  token_num() const
+  {
+    return mTokenNum;
+  }
+
   //////////////////////////////////////////////////////////////////////
   /// @}
   //////////////////////////////////////////////////////////////////////
@@ -235,6 +242,9 @@ private:
   // _scan の結果の文字列を格納する
   StrBuff mCurString;
 
+  // 読み込んだトークン数
+  SizeType mTokenNum{0};
+
 };
 
 END_NAMESPACE_YM_DOTLIB
@@ -9,6 +9,7 @@
 /// All rights reserved.
 
 #include "dotlib/dotlib_nsdef.h"
+#include "dotlib/AttrKwd.h"
 #include "ym/ShString.h"
 #include "ym/FileRegion.h"
 
@@ -18,6 +19,11 @@ BEGIN_NAMESPACE_YM_DOTLIB
 //////////////////////////////////////////////////////////////////////
 /// @class GroupInfo GroupInfo.h "GroupInfo.h"
 /// @brief グループ構造を表すクラス
+///
+/// 要素は (属性名を表す AttrKwd, 要素番号) の対を属性名の順に
+/// 並べた配列で管理する．同じ属性名の要素は出現順に隣接している．
+/// 配列の大きさは要素数に比例するので，属性の少ないグループを
+/// 大量に処理する場合でもキーワード数分の領域は用いない．
 //////////////////////////////////////////////////////////////////////
 class GroupInfo
 {
@@ -54,12 +60,14 @@ protected:
   // 継承クラスから用いられる関数
   //////////////////////////////////////////////////////////////////////
 
-  /// @brief 要素の辞書を返す．
-  const unordered_map<string, vector<const AstValue*>>&
-  elem_dict() const
-  {
-    return mElemDict;
-  }
+  /// @brief キーワードの値のリストを返す．
+  ///
+  /// 値は出現順に並んでいる．
+  /// 値を持たない場合は空のリストを返す．
+  vector<const AstValue*>
+  elem_list(
+    AttrKwd keyword ///< [in] キーワード
+  ) const;
 
   /// @brief キーワードの値を返す．
   ///
@@ -67,7 +75,7 @@ protected:
   /// 複数の値を持つ場合には invalid_argment 例外が送出される．
   const AstValue*
   get_value(
-    const char* keyword ///< [in] キーワード
+    AttrKwd keyword ///< [in] キーワード
   ) const;
 
   /// @brief string の値を取り出す．
@@ -81,10 +89,25 @@ protected:
   /// true 以外の場合には val の値は変更されない．
   bool
   get_string(
-    const char* keyword, ///< [in] キーワード
+    AttrKwd keyword,     ///< [in] キーワード
     ShString& val        ///< [out] 値を格納する変数
   ) const;
 
+  /// @brief float の値を取り出す．
+  /// @retval true 成功
+  /// @retval false 定義されていなかった
+  ///
+  /// 以下の場合にエラーとなる．
+  /// - 複数回定義されている．
+  /// - 対象が数値でなかった．
+  /// エラーの場合には invalid_argment 例外が送出される．
+  /// true 以外の場合には val の値は変更されない．
+  bool
+  get_float(
+    AttrKwd keyword,     ///< [in] キーワード
+    double& val          ///< [out] 値を格納する変数
+  ) const;
+
   /// @brief area の値を取り出す．
   /// @retval true 成功
   /// @retval false 定義されていなかった
@@ -96,7 +119,7 @@ protected:
   /// true 以外の場合には val の値は変更されない．
   bool
   get_area(
-    const char* keyword, ///< [in] キーワード
+    AttrKwd keyword,     ///< [in] キーワード
     ClibArea& val        ///< [out] 値を格納する変数
   ) const;
 
@@ -111,7 +134,7 @@ protected:
   /// true 以外の場合には val の値は変更されない．
   bool
   get_capacitance(
-    const char* keyword, ///< [in] キーワード
+    AttrKwd keyword,     ///< [in] キーワード
     ClibCapacitance& val ///< [out] 値を格納する変数
   ) const;
 
@@ -126,7 +149,7 @@ protected:
   /// true 以外の場合には val の値は変更されない．
   bool
   get_resistance(
-    const char* keyword, ///< [in] キーワード
+    AttrKwd keyword,     ///< [in] キーワード
     ClibResistance& val  ///< [out] 値を格納する変数
   ) const;
 
@@ -141,7 +164,7 @@ protected:
   /// true 以外の場合には val の値は変更されない．
   bool
   get_time(
-    const char* keyword, ///< [in] キーワード
+    AttrKwd keyword,     ///< [in] キーワード
     ClibTime& val	 ///< [out] 値を格納する変数
   ) const;
 
@@ -156,7 +179,7 @@ protected:
   /// true 以外の場合には val の値は変更されない．
   bool
   get_cpv(
-    const char* keyword, ///< [in] キーワード
+    AttrKwd keyword,     ///< [in] キーワード
     ClibCPV& val	 ///< [out] 値を格納する変数
   ) const;
 
@@ -171,7 +194,7 @@ protected:
   /// true 以外の場合には val の値は変更されない．
   bool
   get_variable_type(
-    const char* keyword, ///< [in] キーワード
+    AttrKwd keyword,     ///< [in] キーワード
     ClibVarType& val     ///< [out] 値を格納する変数
   ) const;
 
@@ -186,7 +209,7 @@ protected:
   /// true 以外の場合には val の値は変更されない．
   bool
   get_direction(
-    const char* keyword, ///< [in] キーワード
+    AttrKwd keyword,     ///< [in] キーワード
     ClibDirection& val   ///< [out] 値を格納する変数
   ) const;
 
@@ -201,7 +224,7 @@ protected:
   /// true 以外の場合には val の値は変更されない．
   bool
   get_timing_type(
-    const char* keyword,  ///< [in] キーワード
+    AttrKwd keyword,      ///< [in] キーワード
     ClibTimingType& val   ///< [out] 値を格納する変数
   ) const;
 
@@ -216,7 +239,7 @@ protected:
   /// true 以外の場合には val の値は変更されない．
   bool
   get_timing_sense(
-    const char* keyword,  ///< [in] キーワード
+    AttrKwd keyword,      ///< [in] キーワード
     ClibTimingSense& val  ///< [out] 値を格納する変数
   ) const;
 
@@ -231,7 +254,7 @@ protected:
   /// true 以外の場合には val の値は変更されない．
   bool
   get_float_vector(
-    const char* keyword,  ///< [in] キーワード
+    AttrKwd keyword,      ///< [in] キーワード
     vector<double>& val	  ///< [out] 値を格納する変数
   ) const;
 
@@ -246,7 +269,7 @@ protected:
   /// true 以外の場合には val の値は変更されない．
   bool
   get_expr(
-    const char* keyword, ///< [in] キーワード
+    AttrKwd keyword,     ///< [in] キーワード
     const AstExpr*& val  ///< [out] 値を格納する変数
   ) const;
 
@@ -261,7 +284,7 @@ protected:
   /// true 以外の場合には val の値は変更されない．
   bool
   get_complex_float_vector(
-    const char* keyword,  ///< [in] キーワード
+    AttrKwd keyword,      ///< [in] キーワード
     vector<double>& val	  ///< [out] 値を格納する変数
   ) const;
 
@@ -278,6 +301,21 @@ protected:
   ) const;
 
 
+private:
+  //////////////////////////////////////////////////////////////////////
+  // 内部で用いられる関数
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief キーワードの最初の要素を指す反復子を返す．
+  ///
+  /// 要素を持たない場合には mKwdList.end() もしくは
+  /// 異なるキーワードの要素を指す反復子を返す．
+  vector<pair<std::uint32_t, std::uint32_t>>::const_iterator
+  find_first(
+    AttrKwd keyword ///< [in] キーワード
+  ) const;
+
+
 private:
   //////////////////////////////////////////////////////////////////////
   // データメンバ
@@ -286,8 +324,13 @@ private:
   // 対象のグループの位置
   FileRegion mLoc;
 
-  // 要素の辞書
-  unordered_map<string, vector<const AstValue*>> mElemDict;
+  // 要素のリスト
+  vector<const AstValue*> mElemList;
+
+  // (キーワード番号, mElemList 上の番号) の対のリスト
+  // キーワード番号，要素番号の順に整列している．
+  // 未登録の属性名の要素は含まない．
+  vector<pair<std::uint32_t, std::uint32_t>> mKwdList;
 
 };
 
@@ -0,0 +1,96 @@
+#ifndef INTERNALPOWERINFO_H
+#define INTERNALPOWERINFO_H
+
+/// @file InternalPowerInfo.h
+/// @brief InternalPowerInfo のヘッダファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2024 Yusuke Matsunaga
+/// All rights reserved.
+
+#include "dotlib/ElemInfo.h"
+#include "dotlib/TableInfo.h"
+#include "dotlib/AstValue.h"
+
+
+BEGIN_NAMESPACE_YM_DOTLIB
+
+//////////////////////////////////////////////////////////////////////
+/// @class InternalPowerInfo InternalPowerInfo.h "InternalPowerInfo.h"
+/// @brief internal_power グループのパース情報
+//////////////////////////////////////////////////////////////////////
+class InternalPowerInfo :
+  public ElemInfo
+{
+public:
+
+  /// @brief コンストラクタ
+  InternalPowerInfo(
+    LibraryInfo& library_info ///< [in] ライブラリのパース情報
+  ) : ElemInfo{library_info},
+      mPower{library_info},
+      mRisePower{library_info},
+      mFallPower{library_info}
+  {
+  }
+
+  /// @brief デストラクタ
+  ~InternalPowerInfo() = default;
+
+
+public:
+  //////////////////////////////////////////////////////////////////////
+  // 外部インターフェイス
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief 内容を設定する．
+  void
+  set(
+    const AstValue* ip_val ///< [in] internal_power のパース木
+  );
+
+  /// @brief 内部電力を作る．
+  ///
+  /// related_pin が複数指定されている場合にはそれぞれに対して作る．
+  void
+  add_internal_power(
+    CiCell* cell,                                     ///< [in] セル
+    const vector<const CiPin*>& pin_list,             ///< [in] 対象のピンのリスト
+    const unordered_map<ShString, SizeType>& ipin_map ///< [in] 入力ピン番号の辞書
+  ) const;
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // データメンバ
+  //////////////////////////////////////////////////////////////////////
+
+  // when 属性
+  const AstExpr* mWhen{nullptr};
+
+  // related_pin 属性
+  vector<ShString> mRelatedPin;
+
+  // power グループを持つ時 true
+  bool mHasPower{false};
+
+  // rise_power グループを持つ時 true
+  bool mHasRisePower{false};
+
+  // fall_power グループを持つ時 true
+  bool mHasFallPower{false};
+
+  // power グループ
+  TableInfo mPower;
+
+  // rise_power グループ
+  TableInfo mRisePower;
+
+  // fall_power グループ
+  TableInfo mFallPower;
+
+};
+
+END_NAMESPACE_YM_DOTLIB
+
+#endif // INTERNALPOWERINFO_H
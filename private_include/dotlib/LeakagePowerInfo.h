@@ -0,0 +1,71 @@
+#ifndef LEAKAGEPOWERINFO_H
+#define LEAKAGEPOWERINFO_H
+
+/// @file LeakagePowerInfo.h
+/// @brief LeakagePowerInfo のヘッダファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2024 Yusuke Matsunaga
+/// All rights reserved.
+
+#include "dotlib/ElemInfo.h"
+#include "dotlib/AstValue.h"
+
+
+BEGIN_NAMESPACE_YM_DOTLIB
+
+//////////////////////////////////////////////////////////////////////
+/// @class LeakagePowerInfo LeakagePowerInfo.h "LeakagePowerInfo.h"
+/// @brief leakage_power グループのパース情報
+//////////////////////////////////////////////////////////////////////
+class LeakagePowerInfo :
+  public ElemInfo
+{
+public:
+
+  /// @brief コンストラクタ
+  LeakagePowerInfo(
+    LibraryInfo& library_info ///< [in] ライブラリのパース情報
+  ) : ElemInfo{library_info}
+  {
+  }
+
+  /// @brief デストラクタ
+  ~LeakagePowerInfo() = default;
+
+
+public:
+  //////////////////////////////////////////////////////////////////////
+  // 外部インターフェイス
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief 内容を設定する．
+  void
+  set(
+    const AstValue* lp_val ///< [in] leakage_power のパース木
+  );
+
+  /// @brief リーク電力を追加する．
+  void
+  add_leakage_power(
+    CiCell* cell,                                     ///< [in] セル
+    const unordered_map<ShString, SizeType>& ipin_map ///< [in] 入力ピン番号の辞書
+  ) const;
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // データメンバ
+  //////////////////////////////////////////////////////////////////////
+
+  // when 属性
+  const AstExpr* mWhen{nullptr};
+
+  // value 属性
+  double mValue{0.0};
+
+};
+
+END_NAMESPACE_YM_DOTLIB
+
+#endif // LEAKAGEPOWERINFO_H
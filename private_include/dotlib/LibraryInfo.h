@@ -10,6 +10,7 @@
 
 #include "dotlib/GroupInfo.h"
 #include "ci/CiCellLibrary.h"
+#include "ci/CiLoadProfiler.h"
 
 
 BEGIN_NAMESPACE_YM_DOTLIB
@@ -25,8 +26,10 @@ public:
 
   /// @brief コンストラクタ
   LibraryInfo(
-    CiCellLibrary* library ///< [in] 対象のライブラリ
-  ) : mLibrary{library}
+    CiCellLibrary* library,            ///< [in] 対象のライブラリ
+    ClibLoadProfile* profile = nullptr ///< [out] 計測結果
+  ) : mLibrary{library},
+      mProfiler{profile}
   {
   }
 
@@ -40,6 +43,9 @@ public:
   //////////////////////////////////////////////////////////////////////
 
   /// @brief 内容を設定する．
+  ///
+  /// セルの生成までを行う．
+  /// compile() と wrap_up() は呼び出し側で行う．
   void
   set(
     const AstValue& lib_val ///< [in] ライブラリ情報のパース木
@@ -85,7 +91,13 @@ private:
   /// @brief 文字列型の属性をセットする．
   void
   set_str_attr(
-    const char* keyword ///< [in] キーワード
+    AttrKwd keyword ///< [in] キーワード
+  );
+
+  /// @brief 浮動小数点型の属性をセットする．
+  void
+  set_float_attr(
+    AttrKwd keyword ///< [in] キーワード
   );
 
   /// @brief capacitive_load_unit の属性をセットする．
@@ -101,6 +113,9 @@ private:
   // ライブラリ
   CiCellLibrary* mLibrary{nullptr};
 
+  // 各フェーズの計測器
+  CiLoadProfiler mProfiler;
+
   // 名前をキーにしてLUTテンプレートを格納する辞書
   unordered_map<ShString, const CiLutTemplate*> mLutDict;
 
@@ -0,0 +1,77 @@
+#ifndef OPERATINGCONDITIONSINFO_H
+#define OPERATINGCONDITIONSINFO_H
+
+/// @file OperatingConditionsInfo.h
+/// @brief OperatingConditionsInfo のヘッダファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2024 Yusuke Matsunaga
+/// All rights reserved.
+
+#include "dotlib/ElemInfo.h"
+#include "ym/ShString.h"
+
+
+BEGIN_NAMESPACE_YM_DOTLIB
+
+//////////////////////////////////////////////////////////////////////
+/// @class OperatingConditionsInfo OperatingConditionsInfo.h "OperatingConditionsInfo.h"
+/// @brief operating_conditions グループのパース情報
+//////////////////////////////////////////////////////////////////////
+class OperatingConditionsInfo :
+  public ElemInfo
+{
+public:
+
+  /// @brief コンストラクタ
+  OperatingConditionsInfo(
+    LibraryInfo& library_info ///< [in] ライブラリのパース情報
+  ) : ElemInfo{library_info}
+  {
+  }
+
+  /// @brief デストラクタ
+  ~OperatingConditionsInfo() = default;
+
+
+public:
+  //////////////////////////////////////////////////////////////////////
+  // 外部インターフェイス
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief 内容を設定する．
+  void
+  set(
+    const AstValue* oc_val ///< [in] operating_conditions のパース木
+  );
+
+  /// @brief 動作条件を作る．
+  void
+  add_operating_conditions() const;
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // データメンバ
+  //////////////////////////////////////////////////////////////////////
+
+  // 名前
+  ShString mName;
+
+  // process 属性
+  double mProcess{1.0};
+
+  // temperature 属性
+  double mTemperature{0.0};
+
+  // voltage 属性
+  double mVoltage{0.0};
+
+  // tree_type 属性
+  ShString mTreeType;
+
+};
+
+END_NAMESPACE_YM_DOTLIB
+
+#endif // OPERATINGCONDITIONSINFO_H
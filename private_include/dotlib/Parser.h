@@ -49,6 +49,13 @@ public:
   AstAttrPtr
   parse();
 
+  /// @brief これまでに読み込んだトークン数を返す．
+  SizeType
+  token_num() const
+  {
+    return mScanner.token_num();
+  }
+
 
 public:
   //////////////////////////////////////////////////////////////////////
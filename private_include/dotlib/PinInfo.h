@@ -10,6 +10,7 @@
 
 #include "dotlib/ElemInfo.h"
 #include "dotlib/TimingInfo.h"
+#include "dotlib/InternalPowerInfo.h"
 #include "ci/CiCell.h"
 #include "ym/Expr.h"
 #include "ym/ShString.h"
@@ -77,6 +78,15 @@ public:
     const unordered_map<ShString, SizeType>& pin_map ///< [in] 入力ピン番号の辞書
   ) const;
 
+  /// @brief 内部電力を生成する．
+  ///
+  /// add_pin() の後で呼ばれる必要がある．
+  void
+  add_internal_power(
+    CiCell* cell,                                    ///< [in] セル番号
+    const unordered_map<ShString, SizeType>& pin_map ///< [in] 入力ピン番号の辞書
+  ) const;
+
 
 private:
   //////////////////////////////////////////////////////////////////////
@@ -103,6 +113,10 @@ private:
   void
   set_output_params();
 
+  /// @brief internal_power グループの情報を取り出す．
+  void
+  set_internal_power();
+
 
 private:
   //////////////////////////////////////////////////////////////////////
@@ -134,9 +148,15 @@ private:
 
   vector<SizeType> mOpinList;
 
+  // 生成されたピンのリスト
+  vector<const CiPin*> mPinList;
+
   // タイミング情報
   vector<TimingInfo> mTimingInfoList;
 
+  // 内部電力情報
+  vector<InternalPowerInfo> mInternalPowerInfoList;
+
 };
 
 END_NAMESPACE_YM_DOTLIB
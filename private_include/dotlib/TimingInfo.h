@@ -92,7 +92,7 @@ private:
   /// @brief piecewise_cmos タイプのパラメータ の値を取り出す．
   vector<pair<SizeType, double>>
   extract_piecewise_params(
-    const char* keyword
+    AttrKwd keyword
   );
 
 
@@ -0,0 +1,116 @@
+#ifndef WIRELOADINFO_H
+#define WIRELOADINFO_H
+
+/// @file WireLoadInfo.h
+/// @brief WireLoadInfo のヘッダファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2024 Yusuke Matsunaga
+/// All rights reserved.
+
+#include "dotlib/ElemInfo.h"
+#include "ym/ShString.h"
+
+
+BEGIN_NAMESPACE_YM_DOTLIB
+
+//////////////////////////////////////////////////////////////////////
+/// @class WireLoadInfo WireLoadInfo.h "WireLoadInfo.h"
+/// @brief wire_load/wire_load_table グループのパース情報
+//////////////////////////////////////////////////////////////////////
+class WireLoadInfo :
+  public ElemInfo
+{
+public:
+
+  /// @brief コンストラクタ
+  WireLoadInfo(
+    LibraryInfo& library_info ///< [in] ライブラリのパース情報
+  ) : ElemInfo{library_info}
+  {
+  }
+
+  /// @brief デストラクタ
+  ~WireLoadInfo() = default;
+
+
+public:
+  //////////////////////////////////////////////////////////////////////
+  // 外部インターフェイス
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief wire_load グループの内容を設定する．
+  void
+  set_wire_load(
+    const AstValue* wl_val ///< [in] wire_load のパース木
+  );
+
+  /// @brief wire_load_table グループの内容を設定する．
+  void
+  set_wire_load_table(
+    const AstValue* wl_val ///< [in] wire_load_table のパース木
+  );
+
+  /// @brief ワイヤーロードを作る．
+  void
+  add_wire_load() const;
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // 内部で用いられる関数
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief 名前を設定する．
+  void
+  set_name(
+    const AstValue* wl_val ///< [in] パース木
+  );
+
+  /// @brief (ファンアウト数, 値) のリストを取り出す．
+  vector<pair<SizeType, double>>
+  get_fanout_list(
+    AttrKwd keyword ///< [in] キーワード
+  ) const;
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // データメンバ
+  //////////////////////////////////////////////////////////////////////
+
+  // 名前
+  ShString mName;
+
+  // wire_load_table の時 true
+  bool mIsTable{false};
+
+  // resistance 属性
+  double mResistance{0.0};
+
+  // capacitance 属性
+  double mCapacitance{0.0};
+
+  // area 属性
+  double mArea{0.0};
+
+  // slope 属性
+  double mSlope{0.0};
+
+  // fanout_length 属性のリスト
+  vector<pair<SizeType, double>> mFanoutLengthList;
+
+  // fanout_capacitance 属性のリスト
+  vector<pair<SizeType, double>> mFanoutCapacitanceList;
+
+  // fanout_resistance 属性のリスト
+  vector<pair<SizeType, double>> mFanoutResistanceList;
+
+  // fanout_area 属性のリスト
+  vector<pair<SizeType, double>> mFanoutAreaList;
+
+};
+
+END_NAMESPACE_YM_DOTLIB
+
+#endif // WIRELOADINFO_H
@@ -0,0 +1,70 @@
+#ifndef WIRELOADSELECTIONINFO_H
+#define WIRELOADSELECTIONINFO_H
+
+/// @file WireLoadSelectionInfo.h
+/// @brief WireLoadSelectionInfo のヘッダファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2024 Yusuke Matsunaga
+/// All rights reserved.
+
+#include "dotlib/ElemInfo.h"
+#include "ym/ShString.h"
+
+
+BEGIN_NAMESPACE_YM_DOTLIB
+
+//////////////////////////////////////////////////////////////////////
+/// @class WireLoadSelectionInfo WireLoadSelectionInfo.h "WireLoadSelectionInfo.h"
+/// @brief wire_load_selection グループのパース情報
+//////////////////////////////////////////////////////////////////////
+class WireLoadSelectionInfo :
+  public ElemInfo
+{
+public:
+
+  /// @brief コンストラクタ
+  WireLoadSelectionInfo(
+    LibraryInfo& library_info ///< [in] ライブラリのパース情報
+  ) : ElemInfo{library_info}
+  {
+  }
+
+  /// @brief デストラクタ
+  ~WireLoadSelectionInfo() = default;
+
+
+public:
+  //////////////////////////////////////////////////////////////////////
+  // 外部インターフェイス
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief 内容を設定する．
+  ///
+  /// 参照しているワイヤーロードは登録済みでなければならない．
+  void
+  set(
+    const AstValue* sel_val ///< [in] wire_load_selection のパース木
+  );
+
+  /// @brief ワイヤーロードセレクションを作る．
+  void
+  add_wire_load_selection() const;
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // データメンバ
+  //////////////////////////////////////////////////////////////////////
+
+  // 名前
+  ShString mName;
+
+  // (下限, 上限, ワイヤーロード) のリスト
+  vector<tuple<double, double, const CiWireLoad*>> mEntryList;
+
+};
+
+END_NAMESPACE_YM_DOTLIB
+
+#endif // WIRELOADSELECTIONINFO_H
@@ -10,14 +10,106 @@
 #include "pym/PyClibTechnology.h"
 #include "pym/PyClibDelayModel.h"
 #include "pym/PyClibCell.h"
+#include "pym/PyExpr.h"
 #include "pym/PyModule.h"
 #include "ym/ClibLibraryPtr.h"
+#include "ym/ClibCellGroup.h"
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 
 
 BEGIN_NAMESPACE_YM
 
 BEGIN_NONAMESPACE
 
+// pickle 用の復元関数
+PyObject* ClibCellLibrary_restore_func = nullptr;
+
+// メモリ上のデータを istream として読むための streambuf
+class MemBuf :
+  public std::streambuf
+{
+public:
+
+  /// @brief コンストラクタ
+  MemBuf(
+    const char* data, ///< [in] データの先頭
+    SizeType size     ///< [in] データのサイズ
+  )
+  {
+    auto p = const_cast<char*>(data);
+    setg(p, p, p + size);
+  }
+
+};
+
+// メモリ上のバイナリダンプからライブラリを復元する．
+//
+// GIL を解放した状態で呼ばれる．
+// 失敗したら false を返す．
+bool
+restore_from_memory(
+  const char* data,
+  SizeType size,
+  ClibCellLibrary& lib
+)
+{
+  MemBuf buf{data, size};
+  istream s{&buf};
+  try {
+    lib = ClibCellLibrary::restore(s);
+  }
+  catch ( std::exception& ) {
+    return false;
+  }
+  return lib.is_valid();
+}
+
+// ライブラリのバイナリダンプを文字列として作る．
+//
+// GIL を解放した状態で呼ばれる．
+string
+dump_to_string(
+  const ClibCellLibrary& lib
+)
+{
+  ostringstream s;
+  lib.dump(s);
+  return s.str();
+}
+
+// パタングラフ生成のパラメータを設定する．
+//
+// 負の値の場合は ValueError を設定して false を返す．
+bool
+set_pat_gen_param(
+  Py_ssize_t max_input,
+  Py_ssize_t max_pat_per_class,
+  Py_ssize_t max_node_num,
+  ClibPatGenParam& param
+)
+{
+  if ( max_input < 0 ) {
+    PyErr_SetString(PyExc_ValueError, "'max_input' must be non-negative");
+    return false;
+  }
+  if ( max_pat_per_class < 0 ) {
+    PyErr_SetString(PyExc_ValueError, "'max_pat_per_class' must be non-negative");
+    return false;
+  }
+  if ( max_node_num < 0 ) {
+    PyErr_SetString(PyExc_ValueError, "'max_node_num' must be non-negative");
+    return false;
+  }
+  param.max_input = max_input;
+  param.max_pat_per_class = max_pat_per_class;
+  param.max_node_num = max_node_num;
+  return true;
+}
+
 // Python 用のオブジェクト定義
 struct ClibCellLibraryObject
 {
@@ -57,50 +149,499 @@ ClibCellLibrary_dealloc(
 PyObject*
 ClibCellLibrary_mislib(
   PyObject* Py_UNUSED(self), // nullptr のはず
-  PyObject* args
+  PyObject* args,
+  PyObject* kwds
 )
 {
+  static const char* kwlist[] = {
+    "filename",
+    "max_input",
+    "max_pat_per_class",
+    "max_node_num",
+    nullptr
+  };
   const char* filename = nullptr;
-  if ( !PyArg_ParseTuple(args, "s", &filename) ) {
+  Py_ssize_t max_input = 0;
+  Py_ssize_t max_pat_per_class = 0;
+  Py_ssize_t max_node_num = 0;
+  if ( !PyArg_ParseTupleAndKeywords(args, kwds, "s|nnn",
+				    const_cast<char**>(kwlist),
+				    &filename,
+				    &max_input,
+				    &max_pat_per_class,
+				    &max_node_num) ) {
+    return nullptr;
+  }
+  ClibPatGenParam param;
+  if ( !set_pat_gen_param(max_input, max_pat_per_class, max_node_num, param) ) {
     return nullptr;
   }
 
+  // 読み込み中は GIL を解放する．
+  string filename_str{filename};
+  ClibCellLibrary clib;
+  bool error = false;
+  Py_BEGIN_ALLOW_THREADS
   try {
     // mislib ファイルを読み込む．
-    auto clib = ClibCellLibrary::read_mislib(filename);
-    return PyClibCellLibrary::ToPyObject(clib);
+    clib = ClibCellLibrary::read_mislib(filename_str, param);
   }
-  catch ( std::invalid_argument& error ) {
+  catch ( std::exception& ) {
+    // GIL を解放している間に例外を外に出してはいけない．
+    error = true;
+  }
+  Py_END_ALLOW_THREADS
+  if ( error ) {
     ostringstream buf;
-    buf << "read_mislib(\"" << filename << "\") failed";
+    buf << "read_mislib(\"" << filename_str << "\") failed";
     PyErr_SetString(PyExc_ValueError, buf.str().c_str());
     return nullptr;
   }
+  return PyClibCellLibrary::ToPyObject(clib);
+}
+
+// 計測結果を辞書に変換する．
+//
+// キーは ClibLoadProfile::write_json() の出力と同じにする．
+PyObject*
+profile_to_dict(
+  const ClibLoadProfile& profile
+)
+{
+  auto n = profile.phase_list.size();
+  auto phase_list_obj = PyList_New(n);
+  for ( SizeType i = 0; i < n; ++ i ) {
+    auto& phase = profile.phase_list[i];
+    auto phase_obj = Py_BuildValue("{s:s,s:d,s:k,s:k,s:k}",
+				   "name", phase.name.c_str(),
+				   "wall_time", phase.wall_time,
+				   "bytes", phase.bytes,
+				   "objects", phase.object_num,
+				   "peak_rss", phase.peak_rss);
+    PyList_SET_ITEM(phase_list_obj, i, phase_obj);
+  }
+  return Py_BuildValue("{s:s,s:d,s:k,s:N}",
+		       "filename", profile.filename.c_str(),
+		       "total_time", profile.total_time(),
+		       "peak_rss", profile.peak_rss(),
+		       "phases", phase_list_obj);
 }
 
 // liberty 形式のファイルを読み込む．
 PyObject*
 ClibCellLibrary_liberty(
   PyObject* Py_UNUSED(self), // nullptr のはず
-  PyObject* args
+  PyObject* args,
+  PyObject* kwds
 )
 {
+  static const char* kwlist[] = {
+    "filename",
+    "max_input",
+    "max_pat_per_class",
+    "max_node_num",
+    "profile",
+    nullptr
+  };
   const char* filename = nullptr;
-  if ( !PyArg_ParseTuple(args, "s", &filename) ) {
+  Py_ssize_t max_input = 0;
+  Py_ssize_t max_pat_per_class = 0;
+  Py_ssize_t max_node_num = 0;
+  int profile_flag = false;
+  if ( !PyArg_ParseTupleAndKeywords(args, kwds, "s|nnn$p",
+				    const_cast<char**>(kwlist),
+				    &filename,
+				    &max_input,
+				    &max_pat_per_class,
+				    &max_node_num,
+				    &profile_flag) ) {
+    return nullptr;
+  }
+  ClibPatGenParam param;
+  if ( !set_pat_gen_param(max_input, max_pat_per_class, max_node_num, param) ) {
     return nullptr;
   }
 
+  // 読み込み中は GIL を解放する．
+  string filename_str{filename};
+  ClibCellLibrary clib;
+  ClibLoadProfile profile;
+  bool error = false;
+  Py_BEGIN_ALLOW_THREADS
   try {
     // liberty ファイルを読み込む．
-    auto clib = ClibCellLibrary::read_liberty(filename);
-    return PyClibCellLibrary::ToPyObject(clib);
+    if ( profile_flag ) {
+      clib = ClibCellLibrary::read_liberty(filename_str, param, profile);
+    }
+    else {
+      clib = ClibCellLibrary::read_liberty(filename_str, param);
+    }
+  }
+  catch ( std::exception& ) {
+    // GIL を解放している間に例外を外に出してはいけない．
+    error = true;
+  }
+  Py_END_ALLOW_THREADS
+  if ( error ) {
+    ostringstream buf;
+    buf << "read_liberty(\"" << filename_str << "\") failed";
+    PyErr_SetString(PyExc_ValueError, buf.str().c_str());
+    return nullptr;
+  }
+  if ( profile_flag ) {
+    // (ライブラリ, 計測結果) のタプルを返す．
+    return Py_BuildValue("(NN)",
+			 PyClibCellLibrary::ToPyObject(clib),
+			 profile_to_dict(profile));
+  }
+  return PyClibCellLibrary::ToPyObject(clib);
+}
+
+// 複数の liberty 形式のファイルを並行して読み込む．
+PyObject*
+ClibCellLibrary_liberty_many(
+  PyObject* Py_UNUSED(self), // nullptr のはず
+  PyObject* args,
+  PyObject* kwds
+)
+{
+  static const char* kwlist[] = {
+    "paths",
+    "num_threads",
+    "max_input",
+    "max_pat_per_class",
+    "max_node_num",
+    nullptr
+  };
+  PyObject* paths_obj = nullptr;
+  SizeType num_threads = 0;
+  Py_ssize_t max_input = 0;
+  Py_ssize_t max_pat_per_class = 0;
+  Py_ssize_t max_node_num = 0;
+  if ( !PyArg_ParseTupleAndKeywords(args, kwds, "O|knnn",
+				    const_cast<char**>(kwlist),
+				    &paths_obj,
+				    &num_threads,
+				    &max_input,
+				    &max_pat_per_class,
+				    &max_node_num) ) {
+    return nullptr;
+  }
+  ClibPatGenParam param;
+  if ( !set_pat_gen_param(max_input, max_pat_per_class, max_node_num, param) ) {
+    return nullptr;
+  }
+
+  auto seq_obj = PySequence_Fast(paths_obj, "argument 1 must be a sequence of str");
+  if ( seq_obj == nullptr ) {
+    return nullptr;
+  }
+  SizeType n = PySequence_Fast_GET_SIZE(seq_obj);
+  vector<string> filename_list(n);
+  for ( SizeType i = 0; i < n; ++ i ) {
+    auto item_obj = PySequence_Fast_GET_ITEM(seq_obj, i);
+    auto str = PyUnicode_Check(item_obj) ? PyUnicode_AsUTF8(item_obj) : nullptr;
+    if ( str == nullptr ) {
+      Py_DECREF(seq_obj);
+      if ( !PyErr_Occurred() ) {
+	PyErr_SetString(PyExc_TypeError, "argument 1 must be a sequence of str");
+      }
+      return nullptr;
+    }
+    filename_list[i] = str;
+  }
+  Py_DECREF(seq_obj);
+
+  // 読み込み中は GIL を解放する．
+  vector<ClibCellLibrary> lib_list;
+  string error_msg;
+  bool error = false;
+  Py_BEGIN_ALLOW_THREADS
+  try {
+    lib_list = ClibCellLibrary::read_liberty_many(filename_list, param, num_threads);
+  }
+  catch ( std::exception& err ) {
+    // GIL を解放している間に例外を外に出してはいけない．
+    // ワーカーの送出した例外がそのまま送出されるので
+    // std::invalid_argument 以外の場合もある．
+    error = true;
+    error_msg = err.what();
+  }
+  Py_END_ALLOW_THREADS
+  if ( error ) {
+    ostringstream buf;
+    buf << "read_liberty_many() failed: " << error_msg;
+    PyErr_SetString(PyExc_ValueError, buf.str().c_str());
+    return nullptr;
+  }
+
+  auto list_obj = PyList_New(n);
+  for ( SizeType i = 0; i < n; ++ i ) {
+    auto lib_obj = PyClibCellLibrary::ToPyObject(lib_list[i]);
+    PyList_SET_ITEM(list_obj, i, lib_obj);
+  }
+  return list_obj;
+}
+
+// バイナリダンプされたファイルを読み込む．
+PyObject*
+ClibCellLibrary_restore(
+  PyObject* Py_UNUSED(self), // nullptr のはず
+  PyObject* args,
+  PyObject* kwds
+)
+{
+  static const char* kwlist[] = {
+    "filename",
+    nullptr
+  };
+  const char* filename = nullptr;
+  if ( !PyArg_ParseTupleAndKeywords(args, kwds, "s",
+				    const_cast<char**>(kwlist),
+				    &filename) ) {
+    return nullptr;
+  }
+
+  // 読み込み中は GIL を解放する．
+  string filename_str{filename};
+  ClibCellLibrary clib;
+  bool error = false;
+  Py_BEGIN_ALLOW_THREADS
+  ifstream s{filename_str};
+  if ( s ) {
+    try {
+      clib = ClibCellLibrary::restore(s);
+    }
+    catch ( std::exception& ) {
+      error = true;
+    }
+  }
+  else {
+    error = true;
+  }
+  Py_END_ALLOW_THREADS
+  if ( error ) {
+    ostringstream buf;
+    buf << "restore(\"" << filename_str << "\") failed";
+    PyErr_SetString(PyExc_ValueError, buf.str().c_str());
+    return nullptr;
+  }
+  return PyClibCellLibrary::ToPyObject(clib);
+}
+
+// バイナリダンプされた内容をバッファから読み込む．
+PyObject*
+ClibCellLibrary_from_bytes(
+  PyObject* Py_UNUSED(self), // nullptr のはず
+  PyObject* args
+)
+{
+  PyObject* data_obj = nullptr;
+  if ( !PyArg_ParseTuple(args, "O", &data_obj) ) {
+    return nullptr;
+  }
+  Py_buffer view;
+  if ( PyObject_GetBuffer(data_obj, &view, PyBUF_SIMPLE) < 0 ) {
+    return nullptr;
+  }
+
+  ClibCellLibrary clib;
+  bool ok = false;
+  Py_BEGIN_ALLOW_THREADS
+  ok = restore_from_memory(reinterpret_cast<const char*>(view.buf),
+			   view.len, clib);
+  Py_END_ALLOW_THREADS
+  PyBuffer_Release(&view);
+  if ( !ok ) {
+    PyErr_SetString(PyExc_ValueError, "from_bytes() failed");
+    return nullptr;
+  }
+  return PyClibCellLibrary::ToPyObject(clib);
+}
+
+// 内容をバイナリダンプした bytes を返す．
+PyObject*
+ClibCellLibrary_to_bytes(
+  PyObject* self,
+  PyObject* Py_UNUSED(args)
+)
+{
+  auto lib = PyClibCellLibrary::Get(self);
+  string data;
+  Py_BEGIN_ALLOW_THREADS
+  data = dump_to_string(lib);
+  Py_END_ALLOW_THREADS
+  return PyBytes_FromStringAndSize(data.c_str(), data.size());
+}
+
+// pickle 用の関数
+PyObject*
+ClibCellLibrary_reduce(
+  PyObject* self,
+  PyObject* Py_UNUSED(args)
+)
+{
+  auto data_obj = ClibCellLibrary_to_bytes(self, nullptr);
+  if ( data_obj == nullptr ) {
+    return nullptr;
+  }
+  return Py_BuildValue("(O(N))", ClibCellLibrary_restore_func, data_obj);
+}
+
+// 内容を POSIX 共有メモリにバイナリダンプする．
+PyObject*
+ClibCellLibrary_to_shm(
+  PyObject* self,
+  PyObject* args
+)
+{
+  const char* name = nullptr;
+  if ( !PyArg_ParseTuple(args, "s", &name) ) {
+    return nullptr;
+  }
+
+  string name_str{name};
+  auto lib = PyClibCellLibrary::Get(self);
+  SizeType size = 0;
+  int error = 0;
+  Py_BEGIN_ALLOW_THREADS
+  auto data = dump_to_string(lib);
+  size = data.size();
+  auto fd = shm_open(name_str.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+  if ( fd < 0 ) {
+    error = errno;
+  }
+  else {
+    if ( ftruncate(fd, size) < 0 ) {
+      error = errno;
+    }
+    else if ( size > 0 ) {
+      auto ptr = mmap(nullptr, size, PROT_WRITE, MAP_SHARED, fd, 0);
+      if ( ptr == MAP_FAILED ) {
+	error = errno;
+      }
+      else {
+	memcpy(ptr, data.c_str(), size);
+	munmap(ptr, size);
+      }
+    }
+    close(fd);
+    if ( error != 0 ) {
+      shm_unlink(name_str.c_str());
+    }
+  }
+  Py_END_ALLOW_THREADS
+  if ( error != 0 ) {
+    errno = error;
+    PyErr_SetFromErrnoWithFilename(PyExc_OSError, name_str.c_str());
+    return nullptr;
+  }
+  return PyLong_FromSize_t(size);
+}
+
+// POSIX 共有メモリ上のバイナリダンプからライブラリを復元する．
+PyObject*
+ClibCellLibrary_from_shm(
+  PyObject* Py_UNUSED(self), // nullptr のはず
+  PyObject* args
+)
+{
+  const char* name = nullptr;
+  if ( !PyArg_ParseTuple(args, "s", &name) ) {
+    return nullptr;
+  }
+
+  string name_str{name};
+  ClibCellLibrary clib;
+  int error = 0;
+  bool ok = false;
+  Py_BEGIN_ALLOW_THREADS
+  auto fd = shm_open(name_str.c_str(), O_RDONLY, 0);
+  if ( fd < 0 ) {
+    error = errno;
+  }
+  else {
+    struct stat st;
+    if ( fstat(fd, &st) < 0 ) {
+      error = errno;
+    }
+    else if ( st.st_size > 0 ) {
+      SizeType size = st.st_size;
+      auto ptr = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+      if ( ptr == MAP_FAILED ) {
+	error = errno;
+      }
+      else {
+	ok = restore_from_memory(reinterpret_cast<const char*>(ptr), size, clib);
+	munmap(ptr, size);
+      }
+    }
+    close(fd);
+  }
+  Py_END_ALLOW_THREADS
+  if ( error != 0 ) {
+    errno = error;
+    PyErr_SetFromErrnoWithFilename(PyExc_OSError, name_str.c_str());
+    return nullptr;
+  }
+  if ( !ok ) {
+    ostringstream buf;
+    buf << "from_shm(\"" << name_str << "\") failed";
+    PyErr_SetString(PyExc_ValueError, buf.str().c_str());
+    return nullptr;
+  }
+  return PyClibCellLibrary::ToPyObject(clib);
+}
+
+// POSIX 共有メモリを削除する．
+PyObject*
+ClibCellLibrary_unlink_shm(
+  PyObject* Py_UNUSED(self), // nullptr のはず
+  PyObject* args
+)
+{
+  const char* name = nullptr;
+  if ( !PyArg_ParseTuple(args, "s", &name) ) {
+    return nullptr;
+  }
+  if ( shm_unlink(name) < 0 ) {
+    PyErr_SetFromErrnoWithFilename(PyExc_OSError, name);
+    return nullptr;
+  }
+  Py_RETURN_NONE;
+}
+
+// 内容をバイナリダンプする．
+PyObject*
+ClibCellLibrary_dump(
+  PyObject* self,
+  PyObject* args
+)
+{
+  const char* filename = nullptr;
+  if ( !PyArg_ParseTuple(args, "s", &filename) ) {
+    return nullptr;
+  }
+
+  string filename_str{filename};
+  auto lib = PyClibCellLibrary::Get(self);
+  bool error = false;
+  Py_BEGIN_ALLOW_THREADS
+  ofstream s{filename_str};
+  if ( s ) {
+    lib.dump(s);
   }
-  catch ( std::invalid_argument& error ) {
+  else {
+    error = true;
+  }
+  Py_END_ALLOW_THREADS
+  if ( error ) {
     ostringstream buf;
-    buf << "read_liberty(\"" << filename << "\") failed";
+    buf << filename_str << ": Could not open file";
     PyErr_SetString(PyExc_ValueError, buf.str().c_str());
     return nullptr;
   }
+  Py_RETURN_NONE;
 }
 
 PyObject*
@@ -144,6 +685,69 @@ ClibCellLibrary_display(
   Py_RETURN_NONE;
 }
 
+// パタングラフ生成の統計情報を返す．
+PyObject*
+ClibCellLibrary_pg_stats(
+  PyObject* self,
+  PyObject* Py_UNUSED(args)
+)
+{
+  auto lib = PyClibCellLibrary::Get(self);
+  auto stats = lib.pg_stats();
+  return Py_BuildValue("{s:k,s:k,s:k,s:k,s:k,s:k,s:k}",
+		       "expr_num", stats.expr_num,
+		       "input_pruned_expr_num", stats.input_pruned_expr_num,
+		       "node_pruned_expr_num", stats.node_pruned_expr_num,
+		       "class_pruned_pat_num", stats.class_pruned_pat_num,
+		       "swept_node_num", stats.swept_node_num,
+		       "pat_num", stats.pat_num,
+		       "node_num", stats.node_num);
+}
+
+// 論理式に一致するセルのリストを返す．
+PyObject*
+ClibCellLibrary_find_logic_cells(
+  PyObject* self,
+  PyObject* args,
+  PyObject* kwds
+)
+{
+  static const char* kwlist[] = {
+    "expr",
+    "ni",
+    nullptr
+  };
+  PyObject* expr_obj = nullptr;
+  int ni = -1;
+  if ( !PyArg_ParseTupleAndKeywords(args, kwds, "O|i",
+				    const_cast<char**>(kwlist),
+				    &expr_obj, &ni) ) {
+    return nullptr;
+  }
+  if ( !PyExpr::Check(expr_obj) ) {
+    PyErr_SetString(PyExc_TypeError, "argument 1 must be an Expr");
+    return nullptr;
+  }
+  auto expr = PyExpr::Get(expr_obj);
+  if ( ni < 0 ) {
+    ni = expr.input_size();
+  }
+  auto lib = PyClibCellLibrary::Get(self);
+  auto group = lib.find_logic_group(expr, ni);
+  if ( group.is_invalid() ) {
+    return PyList_New(0);
+  }
+  auto cell_list = group.cell_list();
+  SizeType n = cell_list.size();
+  auto obj = PyList_New(n);
+  for ( SizeType i = 0; i < n; ++ i ) {
+    auto cell = cell_list[i];
+    auto cell_obj = PyClibCell::ToPyObject(cell);
+    PyList_SetItem(obj, i, cell_obj);
+  }
+  return obj;
+}
+
 // 内容を表す文字列のリストを作る．
 PyObject*
 ClibCellLibrary_to_string_list(
@@ -174,19 +778,63 @@ ClibCellLibrary_to_string_list(
 
 // メソッド定義
 PyMethodDef ClibCellLibrary_methods[] = {
-  {"read_mislib", ClibCellLibrary_mislib, METH_VARARGS | METH_STATIC,
+  {"read_mislib",
+   reinterpret_cast<PyCFunction>(ClibCellLibrary_mislib),
+   METH_VARARGS | METH_KEYWORDS | METH_STATIC,
    PyDoc_STR("read mislib file")},
-  {"read_liberty", ClibCellLibrary_liberty, METH_VARARGS | METH_STATIC,
-   PyDoc_STR("read liberty(.lib) file")},
+  {"read_liberty",
+   reinterpret_cast<PyCFunction>(ClibCellLibrary_liberty),
+   METH_VARARGS | METH_KEYWORDS | METH_STATIC,
+   PyDoc_STR("read liberty(.lib) file\n"
+	     "returns (library, profile) if 'profile' is True")},
+  {"read_liberty_many",
+   reinterpret_cast<PyCFunction>(ClibCellLibrary_liberty_many),
+   METH_VARARGS | METH_KEYWORDS | METH_STATIC,
+   PyDoc_STR("read liberty(.lib) files using worker threads\n"
+	     "(parsing and cell construction are serialized by a global lock)")},
+  {"restore",
+   reinterpret_cast<PyCFunction>(ClibCellLibrary_restore),
+   METH_VARARGS | METH_KEYWORDS | METH_STATIC,
+   PyDoc_STR("read the binary dump file")},
+  {"dump", ClibCellLibrary_dump, METH_VARARGS,
+   PyDoc_STR("write the binary dump file")},
+  {"from_bytes", ClibCellLibrary_from_bytes, METH_VARARGS | METH_STATIC,
+   PyDoc_STR("restore from the binary dump in a bytes-like object")},
+  {"to_bytes", ClibCellLibrary_to_bytes, METH_NOARGS,
+   PyDoc_STR("return the binary dump as bytes")},
+  {"to_shm", ClibCellLibrary_to_shm, METH_VARARGS,
+   PyDoc_STR("write the binary dump into a new POSIX shared memory object\n"
+	     "and return its size")},
+  {"from_shm", ClibCellLibrary_from_shm, METH_VARARGS | METH_STATIC,
+   PyDoc_STR("restore from the binary dump in a POSIX shared memory object")},
+  {"unlink_shm", ClibCellLibrary_unlink_shm, METH_VARARGS | METH_STATIC,
+   PyDoc_STR("remove a POSIX shared memory object")},
+  {"__reduce__", ClibCellLibrary_reduce, METH_NOARGS,
+   PyDoc_STR("support for pickle")},
   {"is_valid", ClibCellLibrary_is_valid, METH_NOARGS,
    PyDoc_STR("check if valid")},
   {"display", ClibCellLibrary_display, METH_VARARGS,
    PyDoc_STR("display the contents of the cell library")},
+  {"pg_stats", ClibCellLibrary_pg_stats, METH_NOARGS,
+   PyDoc_STR("return the statistics of the pattern graph generation")},
+  {"find_logic_cells",
+   reinterpret_cast<PyCFunction>(ClibCellLibrary_find_logic_cells),
+   METH_VARARGS | METH_KEYWORDS,
+   PyDoc_STR("return the list of cells implementing the expression")},
   {"to_string_list", ClibCellLibrary_to_string_list, METH_NOARGS,
    PyDoc_STR("return the list of strings representing the cell library")},
   {nullptr, nullptr, 0, nullptr}
 };
 
+// モジュールに登録する関数
+//
+// pickle の復元関数はモジュールから名前で参照できる必要がある．
+PyMethodDef ClibCellLibrary_module_methods[] = {
+  {"_restore_library", ClibCellLibrary_from_bytes, METH_VARARGS,
+   PyDoc_STR("restore ClibCellLibrary from the binary dump (used by pickle)")},
+  {nullptr, nullptr, 0, nullptr}
+};
+
 PyObject*
 ClibCellLibrary_name(
   PyObject* self,
@@ -428,6 +1076,15 @@ PyClibCellLibrary::init(
     goto error;
   }
 
+  // pickle 用の復元関数の登録
+  if ( PyModule_AddFunctions(m, ClibCellLibrary_module_methods) < 0 ) {
+    goto error;
+  }
+  ClibCellLibrary_restore_func = PyObject_GetAttrString(m, "_restore_library");
+  if ( ClibCellLibrary_restore_func == nullptr ) {
+    goto error;
+  }
+
   return true;
 
  error:
@@ -0,0 +1,680 @@
+
+/// @file PyClibLut.cc
+/// @brief PyClibLut の実装ファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2024 Yusuke Matsunaga
+/// All rights reserved.
+
+#include "pym/PyClibLut.h"
+#include "pym/PyClibVarType.h"
+#include "pym/PyModule.h"
+
+
+BEGIN_NAMESPACE_YM
+
+BEGIN_NONAMESPACE
+
+// LUT の最大次元数
+const SizeType MAX_DIM = 3;
+
+// Python 用のオブジェクト定義
+struct ClibLutObject
+{
+  PyObject_HEAD
+  ClibLut mLut;
+  // バッファプロトコル用の形状
+  Py_ssize_t mShape[MAX_DIM];
+  // バッファプロトコル用のストライド
+  Py_ssize_t mStrides[MAX_DIM];
+};
+
+// インデックス値の配列を参照するためのオブジェクト定義
+//
+// ClibLut.index_array() の返す memoryview の実体となる．
+struct ClibLutIndexObject
+{
+  PyObject_HEAD
+  ClibLut mLut;
+  SizeType mVar;
+  Py_ssize_t mShape[1];
+};
+
+// Python 用のタイプ定義
+PyTypeObject ClibLut_Type = {
+  PyVarObject_HEAD_INIT(nullptr, 0)
+};
+
+// インデックス値の配列用のタイプ定義
+PyTypeObject ClibLutIndex_Type = {
+  PyVarObject_HEAD_INIT(nullptr, 0)
+};
+
+// バッファの情報を設定する．
+int
+fill_buffer(
+  PyObject* exporter,
+  Py_buffer* view,
+  int flags,
+  const vector<double>& array,
+  int ndim,
+  Py_ssize_t* shape,
+  Py_ssize_t* strides
+)
+{
+  if ( (flags & PyBUF_WRITABLE) == PyBUF_WRITABLE ) {
+    PyErr_SetString(PyExc_BufferError, "ClibLut data is read-only");
+    view->obj = nullptr;
+    return -1;
+  }
+  view->obj = exporter;
+  Py_INCREF(exporter);
+  view->buf = const_cast<double*>(array.data());
+  view->len = array.size() * sizeof(double);
+  view->readonly = 1;
+  view->itemsize = sizeof(double);
+  view->format = nullptr;
+  if ( (flags & PyBUF_FORMAT) == PyBUF_FORMAT ) {
+    view->format = const_cast<char*>("d");
+  }
+  view->ndim = ndim;
+  view->shape = nullptr;
+  if ( (flags & PyBUF_ND) == PyBUF_ND ) {
+    view->shape = shape;
+  }
+  view->strides = nullptr;
+  if ( (flags & PyBUF_STRIDES) == PyBUF_STRIDES ) {
+    view->strides = strides;
+  }
+  view->suboffsets = nullptr;
+  view->internal = nullptr;
+  return 0;
+}
+
+// 生成関数
+PyObject*
+ClibLut_new(
+  PyTypeObject* type,
+  PyObject* args,
+  PyObject* kwds
+)
+{
+  PyErr_SetString(PyExc_TypeError, "instantiation of 'ClibLut' is disabled");
+  return nullptr;
+}
+
+// 終了関数
+void
+ClibLut_dealloc(
+  PyObject* self
+)
+{
+  auto lut_obj = reinterpret_cast<ClibLutObject*>(self);
+  lut_obj->mLut.~ClibLut();
+  Py_TYPE(self)->tp_free(self);
+}
+
+// バッファ取得関数
+int
+ClibLut_getbuffer(
+  PyObject* self,
+  Py_buffer* view,
+  int flags
+)
+{
+  auto lut_obj = reinterpret_cast<ClibLutObject*>(self);
+  auto& lut = lut_obj->mLut;
+  return fill_buffer(self, view, flags,
+		     lut.value_array(), lut.dimension(),
+		     lut_obj->mShape, lut_obj->mStrides);
+}
+
+// バッファプロトコル
+PyBufferProcs ClibLut_as_buffer = {
+  ClibLut_getbuffer,
+  nullptr
+};
+
+// インデックス用の終了関数
+void
+ClibLutIndex_dealloc(
+  PyObject* self
+)
+{
+  auto index_obj = reinterpret_cast<ClibLutIndexObject*>(self);
+  index_obj->mLut.~ClibLut();
+  Py_TYPE(self)->tp_free(self);
+}
+
+// インデックス用のバッファ取得関数
+int
+ClibLutIndex_getbuffer(
+  PyObject* self,
+  Py_buffer* view,
+  int flags
+)
+{
+  static Py_ssize_t strides[1] = { sizeof(double) };
+  auto index_obj = reinterpret_cast<ClibLutIndexObject*>(self);
+  auto& array = index_obj->mLut.index_array(index_obj->mVar);
+  return fill_buffer(self, view, flags, array, 1,
+		     index_obj->mShape, strides);
+}
+
+// インデックス用のバッファプロトコル
+PyBufferProcs ClibLutIndex_as_buffer = {
+  ClibLutIndex_getbuffer,
+  nullptr
+};
+
+// value() の引数を保持するクラス
+//
+// スカラー値の場合は n 個に複製した配列を持つ．
+// デストラクタでバッファを解放する．
+struct ValueArg
+{
+  ~ValueArg()
+  {
+    if ( mHasView ) {
+      PyBuffer_Release(&mView);
+    }
+  }
+
+  // バッファを持つとき true
+  bool mHasView{false};
+
+  // バッファ
+  Py_buffer mView;
+
+  // スカラー値もしくはシーケンスの値
+  vector<double> mValues;
+
+  // 要素数(スカラーの場合は -1)
+  Py_ssize_t mNum{-1};
+
+  // 値の配列の先頭
+  const double* mPtr{nullptr};
+};
+
+// value() の引数を解釈する．
+bool
+parse_value_arg(
+  PyObject* obj,
+  ValueArg& arg
+)
+{
+  if ( PyFloat_Check(obj) || PyLong_Check(obj) ) {
+    auto val = PyFloat_AsDouble(obj);
+    if ( val == -1.0 && PyErr_Occurred() ) {
+      return false;
+    }
+    arg.mValues.push_back(val);
+    return true;
+  }
+  if ( PyObject_CheckBuffer(obj) ) {
+    if ( PyObject_GetBuffer(obj, &arg.mView,
+			    PyBUF_C_CONTIGUOUS | PyBUF_FORMAT) < 0 ) {
+      return false;
+    }
+    arg.mHasView = true;
+    auto fmt = arg.mView.format;
+    if ( fmt == nullptr ||
+	 ( strcmp(fmt, "d") != 0 && strcmp(fmt, "=d") != 0 && strcmp(fmt, "@d") != 0 ) ||
+	 arg.mView.itemsize != sizeof(double) ) {
+      PyErr_SetString(PyExc_TypeError, "buffer must be an array of 'double'");
+      return false;
+    }
+    arg.mPtr = reinterpret_cast<const double*>(arg.mView.buf);
+    if ( arg.mView.ndim == 0 ) {
+      // 0次元の配列はスカラーとみなす．
+      arg.mValues.push_back(arg.mPtr[0]);
+      arg.mPtr = nullptr;
+      return true;
+    }
+    arg.mNum = arg.mView.len / sizeof(double);
+    return true;
+  }
+  if ( PySequence_Check(obj) ) {
+    auto seq = PySequence_Fast(obj, "sequence of float expected");
+    if ( seq == nullptr ) {
+      return false;
+    }
+    auto n = PySequence_Fast_GET_SIZE(seq);
+    auto items = PySequence_Fast_ITEMS(seq);
+    arg.mValues.resize(n);
+    for ( Py_ssize_t i = 0; i < n; ++ i ) {
+      auto val = PyFloat_AsDouble(items[i]);
+      if ( val == -1.0 && PyErr_Occurred() ) {
+	Py_DECREF(seq);
+	return false;
+      }
+      arg.mValues[i] = val;
+    }
+    Py_DECREF(seq);
+    arg.mNum = n;
+    arg.mPtr = arg.mValues.data();
+    return true;
+  }
+  PyErr_SetString(PyExc_TypeError, "float, sequence of float or buffer of double expected");
+  return false;
+}
+
+// 結果の memoryview の形状を表すタプルを作る．
+PyObject*
+make_shape(
+  const ValueArg& arg
+)
+{
+  if ( arg.mHasView ) {
+    auto ndim = arg.mView.ndim;
+    auto shape_obj = PyTuple_New(ndim);
+    for ( int i = 0; i < ndim; ++ i ) {
+      PyTuple_SetItem(shape_obj, i, PyLong_FromSsize_t(arg.mView.shape[i]));
+    }
+    return shape_obj;
+  }
+  return Py_BuildValue("(n)", arg.mNum);
+}
+
+PyObject*
+ClibLut_value(
+  PyObject* self,
+  PyObject* args
+)
+{
+  auto& lut = PyClibLut::Get(self);
+  SizeType d = lut.dimension();
+  auto nargs = PyTuple_GET_SIZE(args);
+  if ( nargs != d ) {
+    ostringstream buf;
+    buf << "value() takes exactly " << d << " argument(s) ("
+	<< nargs << " given)";
+    PyErr_SetString(PyExc_TypeError, buf.str().c_str());
+    return nullptr;
+  }
+
+  ValueArg arg_list[MAX_DIM];
+  Py_ssize_t n = -1;
+  const ValueArg* shape_arg = nullptr;
+  for ( SizeType i = 0; i < d; ++ i ) {
+    auto& arg = arg_list[i];
+    if ( !parse_value_arg(PyTuple_GET_ITEM(args, i), arg) ) {
+      return nullptr;
+    }
+    if ( arg.mNum == -1 ) {
+      continue;
+    }
+    if ( n == -1 ) {
+      n = arg.mNum;
+      shape_arg = &arg;
+    }
+    else if ( arg.mNum != n ) {
+      PyErr_SetString(PyExc_ValueError, "all arrays must have the same size");
+      return nullptr;
+    }
+  }
+
+  if ( n == -1 ) {
+    // 全てスカラーだった．
+    vector<double> val_array(d);
+    for ( SizeType i = 0; i < d; ++ i ) {
+      val_array[i] = arg_list[i].mValues[0];
+    }
+    try {
+      auto val = lut.value(val_array);
+      return PyFloat_FromDouble(val);
+    }
+    catch ( std::exception& error ) {
+      PyErr_SetString(PyExc_ValueError, error.what());
+      return nullptr;
+    }
+  }
+
+  // スカラーの引数は n 個に複製する．
+  const double* src_list[MAX_DIM];
+  for ( SizeType i = 0; i < d; ++ i ) {
+    auto& arg = arg_list[i];
+    if ( arg.mNum == -1 ) {
+      arg.mValues.resize(n, arg.mValues[0]);
+      arg.mPtr = arg.mValues.data();
+    }
+    src_list[i] = arg.mPtr;
+  }
+
+  auto out_obj = PyByteArray_FromStringAndSize(nullptr, n * sizeof(double));
+  if ( out_obj == nullptr ) {
+    return nullptr;
+  }
+  auto dst = reinterpret_cast<double*>(PyByteArray_AS_STRING(out_obj));
+  bool error = false;
+  Py_BEGIN_ALLOW_THREADS
+  try {
+    lut.value_list(n, src_list, dst);
+  }
+  catch ( std::exception& ) {
+    error = true;
+  }
+  Py_END_ALLOW_THREADS
+  if ( error ) {
+    Py_DECREF(out_obj);
+    PyErr_SetString(PyExc_ValueError, "value() failed");
+    return nullptr;
+  }
+
+  auto mv_obj = PyMemoryView_FromObject(out_obj);
+  Py_DECREF(out_obj);
+  if ( mv_obj == nullptr ) {
+    return nullptr;
+  }
+  auto shape_obj = make_shape(*shape_arg);
+  auto ans_obj = PyObject_CallMethod(mv_obj, "cast", "sO", "d", shape_obj);
+  Py_DECREF(shape_obj);
+  Py_DECREF(mv_obj);
+  return ans_obj;
+}
+
+PyObject*
+ClibLut_variable_type(
+  PyObject* self,
+  PyObject* args
+)
+{
+  SizeType var = 0;
+  if ( !PyArg_ParseTuple(args, "k", &var) ) {
+    return nullptr;
+  }
+  auto& lut = PyClibLut::Get(self);
+  try {
+    auto ans = lut.variable_type(var);
+    return PyClibVarType::ToPyObject(ans);
+  }
+  catch ( std::exception& error ) {
+    PyErr_SetString(PyExc_ValueError, error.what());
+    return nullptr;
+  }
+}
+
+PyObject*
+ClibLut_index_num(
+  PyObject* self,
+  PyObject* args
+)
+{
+  SizeType var = 0;
+  if ( !PyArg_ParseTuple(args, "k", &var) ) {
+    return nullptr;
+  }
+  auto& lut = PyClibLut::Get(self);
+  try {
+    auto ans = lut.index_num(var);
+    return PyLong_FromSize_t(ans);
+  }
+  catch ( std::exception& error ) {
+    PyErr_SetString(PyExc_ValueError, error.what());
+    return nullptr;
+  }
+}
+
+PyObject*
+ClibLut_index(
+  PyObject* self,
+  PyObject* args
+)
+{
+  SizeType var = 0;
+  SizeType pos = 0;
+  if ( !PyArg_ParseTuple(args, "kk", &var, &pos) ) {
+    return nullptr;
+  }
+  auto& lut = PyClibLut::Get(self);
+  try {
+    auto ans = lut.index(var, pos);
+    return PyFloat_FromDouble(ans);
+  }
+  catch ( std::exception& error ) {
+    PyErr_SetString(PyExc_ValueError, error.what());
+    return nullptr;
+  }
+}
+
+PyObject*
+ClibLut_grid_value(
+  PyObject* self,
+  PyObject* args
+)
+{
+  auto& lut = PyClibLut::Get(self);
+  SizeType d = lut.dimension();
+  auto nargs = PyTuple_GET_SIZE(args);
+  if ( nargs != d ) {
+    ostringstream buf;
+    buf << "grid_value() takes exactly " << d << " argument(s) ("
+	<< nargs << " given)";
+    PyErr_SetString(PyExc_TypeError, buf.str().c_str());
+    return nullptr;
+  }
+  vector<SizeType> pos_array(d);
+  for ( SizeType i = 0; i < d; ++ i ) {
+    auto pos = PyLong_AsSsize_t(PyTuple_GET_ITEM(args, i));
+    if ( pos == -1 && PyErr_Occurred() ) {
+      return nullptr;
+    }
+    pos_array[i] = pos;
+  }
+  try {
+    auto ans = lut.grid_value(pos_array);
+    return PyFloat_FromDouble(ans);
+  }
+  catch ( std::exception& error ) {
+    PyErr_SetString(PyExc_ValueError, error.what());
+    return nullptr;
+  }
+}
+
+PyObject*
+ClibLut_index_array(
+  PyObject* self,
+  PyObject* args
+)
+{
+  SizeType var = 0;
+  if ( !PyArg_ParseTuple(args, "k", &var) ) {
+    return nullptr;
+  }
+  auto& lut = PyClibLut::Get(self);
+  if ( var >= lut.dimension() ) {
+    PyErr_SetString(PyExc_ValueError, "var is out of range");
+    return nullptr;
+  }
+  auto obj = ClibLutIndex_Type.tp_alloc(&ClibLutIndex_Type, 0);
+  auto index_obj = reinterpret_cast<ClibLutIndexObject*>(obj);
+  new (&index_obj->mLut) ClibLut{lut};
+  index_obj->mVar = var;
+  index_obj->mShape[0] = lut.index_num(var);
+  auto ans_obj = PyMemoryView_FromObject(obj);
+  Py_DECREF(obj);
+  return ans_obj;
+}
+
+PyObject*
+ClibLut_value_array(
+  PyObject* self,
+  PyObject* Py_UNUSED(args)
+)
+{
+  return PyMemoryView_FromObject(self);
+}
+
+// メソッド定義
+PyMethodDef ClibLut_methods[] = {
+  {"value", ClibLut_value, METH_VARARGS,
+   PyDoc_STR("return the interpolated value.\n"
+	     "each argument may be a float or an array of float(double).\n"
+	     "arrays are evaluated element-wise without holding the GIL")},
+  {"variable_type", ClibLut_variable_type, METH_VARARGS,
+   PyDoc_STR("return the variable type")},
+  {"index_num", ClibLut_index_num, METH_VARARGS,
+   PyDoc_STR("return the number of indices")},
+  {"index", ClibLut_index, METH_VARARGS,
+   PyDoc_STR("return the index value")},
+  {"grid_value", ClibLut_grid_value, METH_VARARGS,
+   PyDoc_STR("return the value at the grid point")},
+  {"index_array", ClibLut_index_array, METH_VARARGS,
+   PyDoc_STR("return the read-only memoryview of the index values")},
+  {"value_array", ClibLut_value_array, METH_NOARGS,
+   PyDoc_STR("return the read-only memoryview of the grid values")},
+  {nullptr, nullptr, 0, nullptr}
+};
+
+PyObject*
+ClibLut_dimension(
+  PyObject* self,
+  void* Py_UNUSED(closure)
+)
+{
+  auto& lut = PyClibLut::Get(self);
+  auto ans = lut.dimension();
+  return PyLong_FromSize_t(ans);
+}
+
+PyObject*
+ClibLut_shape(
+  PyObject* self,
+  void* Py_UNUSED(closure)
+)
+{
+  auto lut_obj = reinterpret_cast<ClibLutObject*>(self);
+  auto d = lut_obj->mLut.dimension();
+  auto ans_obj = PyTuple_New(d);
+  for ( SizeType i = 0; i < d; ++ i ) {
+    PyTuple_SetItem(ans_obj, i, PyLong_FromSsize_t(lut_obj->mShape[i]));
+  }
+  return ans_obj;
+}
+
+// getter/setter 関数テーブル
+PyGetSetDef ClibLut_getsetters[] = {
+  {"dimension", ClibLut_dimension, nullptr,
+   PyDoc_STR("dimension"), nullptr},
+  {"shape", ClibLut_shape, nullptr,
+   PyDoc_STR("shape of the value array"), nullptr},
+  {nullptr, nullptr, nullptr, nullptr, nullptr}
+};
+
+// 比較関数
+PyObject*
+ClibLut_richcmpfunc(
+  PyObject* self,
+  PyObject* other,
+  int op
+)
+{
+  if ( PyClibLut::Check(self) &&
+       PyClibLut::Check(other) ) {
+    auto& val1 = PyClibLut::Get(self);
+    auto& val2 = PyClibLut::Get(other);
+    if ( op == Py_EQ ) {
+      return PyBool_FromLong(val1 == val2);
+    }
+    if ( op == Py_NE ) {
+      return PyBool_FromLong(val1 != val2);
+    }
+  }
+  Py_RETURN_NOTIMPLEMENTED;
+}
+
+END_NONAMESPACE
+
+
+// @brief 初期化する．
+bool
+PyClibLut::init(
+  PyObject* m
+)
+{
+  ClibLut_Type.tp_name = "ClibLut";
+  ClibLut_Type.tp_basicsize = sizeof(ClibLutObject);
+  ClibLut_Type.tp_itemsize = 0;
+  ClibLut_Type.tp_dealloc = ClibLut_dealloc;
+  ClibLut_Type.tp_as_buffer = &ClibLut_as_buffer;
+  ClibLut_Type.tp_flags = Py_TPFLAGS_DEFAULT;
+  ClibLut_Type.tp_doc = PyDoc_STR("ClibLut objects");
+  ClibLut_Type.tp_richcompare = ClibLut_richcmpfunc;
+  ClibLut_Type.tp_methods = ClibLut_methods;
+  ClibLut_Type.tp_getset = ClibLut_getsetters;
+  ClibLut_Type.tp_new = ClibLut_new;
+
+  ClibLutIndex_Type.tp_name = "ClibLutIndex";
+  ClibLutIndex_Type.tp_basicsize = sizeof(ClibLutIndexObject);
+  ClibLutIndex_Type.tp_itemsize = 0;
+  ClibLutIndex_Type.tp_dealloc = ClibLutIndex_dealloc;
+  ClibLutIndex_Type.tp_as_buffer = &ClibLutIndex_as_buffer;
+  ClibLutIndex_Type.tp_flags = Py_TPFLAGS_DEFAULT;
+  ClibLutIndex_Type.tp_doc = PyDoc_STR("index array of ClibLut");
+  if ( PyType_Ready(&ClibLutIndex_Type) < 0 ) {
+    goto error;
+  }
+
+  // 型オブジェクトの登録
+  if ( !PyModule::reg_type(m, "ClibLut", &ClibLut_Type) ) {
+    goto error;
+  }
+
+  return true;
+
+ error:
+
+  return false;
+}
+
+// @brief ClibLut を表す PyObject を作る．
+PyObject*
+PyClibLut::ToPyObject(
+  const ClibLut& val
+)
+{
+  if ( val.is_invalid() ) {
+    Py_RETURN_NONE;
+  }
+  auto obj = ClibLut_Type.tp_alloc(&ClibLut_Type, 0);
+  auto lut_obj = reinterpret_cast<ClibLutObject*>(obj);
+  new (&lut_obj->mLut) ClibLut{val};
+  // バッファプロトコル用の形状とストライドを計算しておく．
+  auto d = val.dimension();
+  Py_ssize_t stride = sizeof(double);
+  for ( SizeType i = d; i > 0; -- i ) {
+    auto n = val.index_num(i - 1);
+    lut_obj->mShape[i - 1] = n;
+    lut_obj->mStrides[i - 1] = stride;
+    stride *= n;
+  }
+  return obj;
+}
+
+// @brief PyObject が ClibLut タイプか調べる．
+bool
+PyClibLut::Check(
+  PyObject* obj
+)
+{
+  return Py_IS_TYPE(obj, _typeobject());
+}
+
+// @brief ClibLut を表す PyObject から ClibLut を取り出す．
+const ClibLut&
+PyClibLut::Get(
+  PyObject* obj
+)
+{
+  auto lut_obj = reinterpret_cast<ClibLutObject*>(obj);
+  return lut_obj->mLut;
+}
+
+// @brief ClibLut を表すオブジェクトの型定義を返す．
+PyTypeObject*
+PyClibLut::_typeobject()
+{
+  return &ClibLut_Type;
+}
+
+END_NAMESPACE_YM
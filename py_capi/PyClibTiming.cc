@@ -7,6 +7,7 @@
 /// All rights reserved.
 
 #include "pym/PyClibTiming.h"
+#include "pym/PyClibLut.h"
 #include "pym/PyClibTimingType.h"
 #include "pym/PyExpr.h"
 #include "pym/PyModule.h"
@@ -192,7 +193,28 @@ ClibTiming_fall_delay_intercept(
 }
 #endif
 
-#if 0
+PyObject*
+ClibTiming_cell_rise(
+  PyObject* self,
+  void* Py_UNUSED(closure)
+)
+{
+  auto timing = PyClibTiming::Get(self);
+  auto ans = timing.cell_rise();
+  return PyClibLut::ToPyObject(ans);
+}
+
+PyObject*
+ClibTiming_cell_fall(
+  PyObject* self,
+  void* Py_UNUSED(closure)
+)
+{
+  auto timing = PyClibTiming::Get(self);
+  auto ans = timing.cell_fall();
+  return PyClibLut::ToPyObject(ans);
+}
+
 PyObject*
 ClibTiming_rise_transition(
   PyObject* self,
@@ -201,9 +223,41 @@ ClibTiming_rise_transition(
 {
   auto timing = PyClibTiming::Get(self);
   auto ans = timing.rise_transition();
-  return PyClibLut::ToPyObject(val_obj->mCell, ans);
+  return PyClibLut::ToPyObject(ans);
+}
+
+PyObject*
+ClibTiming_fall_transition(
+  PyObject* self,
+  void* Py_UNUSED(closure)
+)
+{
+  auto timing = PyClibTiming::Get(self);
+  auto ans = timing.fall_transition();
+  return PyClibLut::ToPyObject(ans);
+}
+
+PyObject*
+ClibTiming_rise_propagation(
+  PyObject* self,
+  void* Py_UNUSED(closure)
+)
+{
+  auto timing = PyClibTiming::Get(self);
+  auto ans = timing.rise_propagation();
+  return PyClibLut::ToPyObject(ans);
+}
+
+PyObject*
+ClibTiming_fall_propagation(
+  PyObject* self,
+  void* Py_UNUSED(closure)
+)
+{
+  auto timing = PyClibTiming::Get(self);
+  auto ans = timing.fall_propagation();
+  return PyClibLut::ToPyObject(ans);
 }
-#endif
 
 // getter/setter 関数テーブル
 PyGetSetDef ClibTiming_getsetters[] = {
@@ -233,6 +287,18 @@ PyGetSetDef ClibTiming_getsetters[] = {
   {"fall_delay_intercept", ClibTiming_fall_delay_intercept, nullptr,
    PyDoc_STR("fall_delay_intercept"), nullptr},
 #endif
+  {"cell_rise", ClibTiming_cell_rise, nullptr,
+   PyDoc_STR("cell_rise LUT"), nullptr},
+  {"cell_fall", ClibTiming_cell_fall, nullptr,
+   PyDoc_STR("cell_fall LUT"), nullptr},
+  {"rise_transition", ClibTiming_rise_transition, nullptr,
+   PyDoc_STR("rise_transition LUT"), nullptr},
+  {"fall_transition", ClibTiming_fall_transition, nullptr,
+   PyDoc_STR("fall_transition LUT"), nullptr},
+  {"rise_propagation", ClibTiming_rise_propagation, nullptr,
+   PyDoc_STR("rise_propagation LUT"), nullptr},
+  {"fall_propagation", ClibTiming_fall_propagation, nullptr,
+   PyDoc_STR("fall_propagation LUT"), nullptr},
   {nullptr, nullptr, nullptr, nullptr, nullptr}
 };
 
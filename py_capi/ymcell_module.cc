@@ -21,16 +21,299 @@
 #include "pym/PyClibCell.h"
 #include "pym/PyClibPin.h"
 #include "pym/PyClibTiming.h"
+#include "pym/PyClibLut.h"
 #include "pym/ymlogic.h"
 #include "pym/PyModule.h"
+#include "ym/ClibCell.h"
+#include "ym/ClibPin.h"
+#include "ym/ClibCapacitance.h"
+#include "ym/ClibTiming.h"
 
 
 BEGIN_NAMESPACE_YM
 
 BEGIN_NONAMESPACE
 
+// 値の配列を memoryview に変換する．
+//
+// fmt は struct モジュールの書式文字でなければならない．
+template<typename T>
+PyObject*
+to_array(
+  const vector<T>& val_list,
+  const char* fmt
+)
+{
+  auto size = val_list.size() * sizeof(T);
+  auto buf_obj = PyByteArray_FromStringAndSize(nullptr, size);
+  if ( buf_obj == nullptr ) {
+    return nullptr;
+  }
+  if ( size > 0 ) {
+    memcpy(PyByteArray_AS_STRING(buf_obj), val_list.data(), size);
+  }
+  auto mv_obj = PyMemoryView_FromObject(buf_obj);
+  Py_DECREF(buf_obj);
+  if ( mv_obj == nullptr ) {
+    return nullptr;
+  }
+  auto ans_obj = PyObject_CallMethod(mv_obj, "cast", "s", fmt);
+  Py_DECREF(mv_obj);
+  return ans_obj;
+}
+
+// 文字列の配列を str のリストに変換する．
+PyObject*
+to_str_list(
+  const vector<string>& str_list
+)
+{
+  SizeType n = str_list.size();
+  auto list_obj = PyList_New(n);
+  for ( SizeType i = 0; i < n; ++ i ) {
+    auto& str = str_list[i];
+    auto str_obj = PyUnicode_FromStringAndSize(str.c_str(), str.size());
+    if ( str_obj == nullptr ) {
+      Py_DECREF(list_obj);
+      return nullptr;
+    }
+    PyList_SET_ITEM(list_obj, i, str_obj);
+  }
+  return list_obj;
+}
+
+// 辞書に列を追加する．
+//
+// col_obj の参照は辞書に移される．
+bool
+add_column(
+  PyObject* dict_obj,
+  const char* name,
+  PyObject* col_obj
+)
+{
+  if ( col_obj == nullptr ) {
+    return false;
+  }
+  auto stat = PyDict_SetItemString(dict_obj, name, col_obj);
+  Py_DECREF(col_obj);
+  return stat == 0;
+}
+
+// 引数からライブラリを取り出す．
+bool
+parse_library(
+  PyObject* args,
+  ClibCellLibrary& library
+)
+{
+  PyObject* lib_obj = nullptr;
+  if ( !PyArg_ParseTuple(args, "O!",
+			 PyClibCellLibrary::_typeobject(),
+			 &lib_obj) ) {
+    return false;
+  }
+  library = PyClibCellLibrary::Get(lib_obj);
+  if ( !library.is_valid() ) {
+    PyErr_SetString(PyExc_ValueError, "invalid library");
+    return false;
+  }
+  return true;
+}
+
+// セルの属性の表を作る．
+PyObject*
+ymcell_cell_table(
+  PyObject* Py_UNUSED(self),
+  PyObject* args
+)
+{
+  ClibCellLibrary library;
+  if ( !parse_library(args, library) ) {
+    return nullptr;
+  }
+
+  SizeType n = library.cell_num();
+  vector<string> name_list(n);
+  vector<double> area_list(n);
+  vector<std::int64_t> input_num_list(n);
+  vector<std::int64_t> output_num_list(n);
+  vector<std::int64_t> inout_num_list(n);
+  Py_BEGIN_ALLOW_THREADS
+  for ( SizeType i = 0; i < n; ++ i ) {
+    auto cell = library.cell(i);
+    name_list[i] = cell.name();
+    area_list[i] = cell.area().value();
+    input_num_list[i] = cell.input_num();
+    output_num_list[i] = cell.output_num();
+    inout_num_list[i] = cell.inout_num();
+  }
+  Py_END_ALLOW_THREADS
+
+  auto dict_obj = PyDict_New();
+  if ( !add_column(dict_obj, "name", to_str_list(name_list)) ||
+       !add_column(dict_obj, "area", to_array(area_list, "d")) ||
+       !add_column(dict_obj, "input_num", to_array(input_num_list, "q")) ||
+       !add_column(dict_obj, "output_num", to_array(output_num_list, "q")) ||
+       !add_column(dict_obj, "inout_num", to_array(inout_num_list, "q")) ) {
+    Py_DECREF(dict_obj);
+    return nullptr;
+  }
+  return dict_obj;
+}
+
+// ピンの属性の表を作る．
+PyObject*
+ymcell_pin_table(
+  PyObject* Py_UNUSED(self),
+  PyObject* args
+)
+{
+  ClibCellLibrary library;
+  if ( !parse_library(args, library) ) {
+    return nullptr;
+  }
+
+  vector<std::int64_t> cell_id_list;
+  vector<std::int64_t> pin_id_list;
+  vector<string> name_list;
+  vector<std::uint8_t> direction_list;
+  vector<double> cap_list;
+  vector<double> rise_cap_list;
+  vector<double> fall_cap_list;
+  Py_BEGIN_ALLOW_THREADS
+  SizeType nc = library.cell_num();
+  for ( SizeType i = 0; i < nc; ++ i ) {
+    auto cell = library.cell(i);
+    for ( auto pin: cell.pin_list() ) {
+      cell_id_list.push_back(i);
+      pin_id_list.push_back(pin.pin_id());
+      name_list.push_back(pin.name());
+      direction_list.push_back(static_cast<std::uint8_t>(pin.direction()));
+      cap_list.push_back(pin.capacitance().value());
+      rise_cap_list.push_back(pin.rise_capacitance().value());
+      fall_cap_list.push_back(pin.fall_capacitance().value());
+    }
+  }
+  Py_END_ALLOW_THREADS
+
+  auto dict_obj = PyDict_New();
+  if ( !add_column(dict_obj, "cell_id", to_array(cell_id_list, "q")) ||
+       !add_column(dict_obj, "pin_id", to_array(pin_id_list, "q")) ||
+       !add_column(dict_obj, "name", to_str_list(name_list)) ||
+       !add_column(dict_obj, "direction", to_array(direction_list, "B")) ||
+       !add_column(dict_obj, "capacitance", to_array(cap_list, "d")) ||
+       !add_column(dict_obj, "rise_capacitance", to_array(rise_cap_list, "d")) ||
+       !add_column(dict_obj, "fall_capacitance", to_array(fall_cap_list, "d")) ) {
+    Py_DECREF(dict_obj);
+    return nullptr;
+  }
+  return dict_obj;
+}
+
+// タイミングアークの表を作る．
+PyObject*
+ymcell_timing_table(
+  PyObject* Py_UNUSED(self),
+  PyObject* args
+)
+{
+  ClibCellLibrary library;
+  if ( !parse_library(args, library) ) {
+    return nullptr;
+  }
+
+  vector<std::int64_t> cell_id_list;
+  vector<std::int64_t> timing_id_list;
+  vector<std::int64_t> ipos_list;
+  vector<std::int64_t> opos_list;
+  vector<std::uint8_t> sense_list;
+  vector<std::uint8_t> type_list;
+  Py_BEGIN_ALLOW_THREADS
+  SizeType nc = library.cell_num();
+  for ( SizeType i = 0; i < nc; ++ i ) {
+    auto cell = library.cell(i);
+    auto ni = cell.input2_num();
+    auto no = cell.output2_num();
+    // セル内のタイミング番号(最初に現れた順)
+    std::unordered_map<const void*, SizeType> timing_id_map;
+    auto add_row = [&](const ClibTiming& timing,
+		       SizeType ipos,
+		       SizeType opos,
+		       ClibTimingSense sense) {
+      auto key = static_cast<const void*>(timing._impl());
+      if ( timing_id_map.count(key) == 0 ) {
+	timing_id_map.emplace(key, timing_id_map.size());
+      }
+      cell_id_list.push_back(i);
+      timing_id_list.push_back(timing_id_map.at(key));
+      ipos_list.push_back(ipos);
+      opos_list.push_back(opos);
+      sense_list.push_back(static_cast<std::uint8_t>(sense));
+      type_list.push_back(static_cast<std::uint8_t>(timing.type()));
+    };
+    for ( SizeType opos = 0; opos < no; ++ opos ) {
+      for ( SizeType ipos = 0; ipos < ni; ++ ipos ) {
+	// non_unate のタイミングは両方のリストに含まれているので
+	// 1行にまとめる．
+	auto p_list = cell.timing_list(ipos, opos, ClibTimingSense::positive_unate);
+	auto n_list = cell.timing_list(ipos, opos, ClibTimingSense::negative_unate);
+	auto in_list = [](const ClibTimingList& timing_list,
+			  const ClibTiming& timing) {
+	  for ( auto timing1: timing_list ) {
+	    if ( timing1 == timing ) {
+	      return true;
+	    }
+	  }
+	  return false;
+	};
+	for ( auto timing: p_list ) {
+	  auto sense = in_list(n_list, timing) ?
+	    ClibTimingSense::non_unate : ClibTimingSense::positive_unate;
+	  add_row(timing, ipos, opos, sense);
+	}
+	for ( auto timing: n_list ) {
+	  if ( !in_list(p_list, timing) ) {
+	    add_row(timing, ipos, opos, ClibTimingSense::negative_unate);
+	  }
+	}
+      }
+    }
+  }
+  Py_END_ALLOW_THREADS
+
+  auto dict_obj = PyDict_New();
+  if ( !add_column(dict_obj, "cell_id", to_array(cell_id_list, "q")) ||
+       !add_column(dict_obj, "timing_id", to_array(timing_id_list, "q")) ||
+       !add_column(dict_obj, "ipos", to_array(ipos_list, "q")) ||
+       !add_column(dict_obj, "opos", to_array(opos_list, "q")) ||
+       !add_column(dict_obj, "sense", to_array(sense_list, "B")) ||
+       !add_column(dict_obj, "type", to_array(type_list, "B")) ) {
+    Py_DECREF(dict_obj);
+    return nullptr;
+  }
+  return dict_obj;
+}
+
 // メソッド定義構造体
 PyMethodDef ymcell_methods[] = {
+  {"cell_table", ymcell_cell_table, METH_VARARGS,
+   PyDoc_STR("return the columns of cell attributes as a dict.\n"
+	     "keys: name, area, input_num, output_num, inout_num")},
+  {"pin_table", ymcell_pin_table, METH_VARARGS,
+   PyDoc_STR("return the columns of pin attributes as a dict.\n"
+	     "keys: cell_id, pin_id, name, direction, capacitance,\n"
+	     "rise_capacitance, fall_capacitance\n"
+	     "direction is the integer value of ClibDirection")},
+  {"timing_table", ymcell_timing_table, METH_VARARGS,
+   PyDoc_STR("return the columns of timing arcs as a dict.\n"
+	     "keys: cell_id, timing_id, ipos, opos, sense, type\n"
+	     "each timing appears once per (ipos, opos) pair,\n"
+	     "timing_id numbers the timings of a cell in order of appearance,\n"
+	     "sense is the integer value of ClibTimingSense:\n"
+	     "1(positive_unate), 2(negative_unate) or 3(non_unate,\n"
+	     "also used for edge arcs that apply to both transitions),\n"
+	     "type is the integer value of ClibTimingType")},
   {nullptr, nullptr, 0, nullptr},
 };
 
@@ -105,6 +388,10 @@ PyInit_ymcell()
     goto error;
   }
 
+  if ( !PyClibLut::init(m) ) {
+    goto error;
+  }
+
   return m;
 
  error:
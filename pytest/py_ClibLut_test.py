@@ -0,0 +1,111 @@
+#! /usr/bin/env python3
+
+""" ClibLutのテストスクリプト
+
+:file: py_ClibLut_test.py
+:author: Yusuke Matsunaga (松永 裕介)
+:copyright: Copyright (C) 2024 Yusuke Matsunaga, All rights reserved.
+"""
+
+import pytest
+import ymcell
+import os
+from array import array
+
+
+def get_lut():
+    current_dir = os.path.dirname(__file__)
+    data_dir = os.path.join(current_dir, os.pardir)
+    lib_filename = os.path.join(data_dir, 'testdata', 'HIT018.typ.snp')
+    lib = ymcell.ClibCellLibrary.read_liberty(lib_filename)
+    sense = ymcell.ClibTimingSense("positive_unate")
+    # 先頭のセルは HIT18AND2P005 で cell_rise は2次元のテーブルを持つ．
+    cell = lib.cell_list[0]
+    timing_list = cell.timing_list(0, 0, sense)
+    return timing_list[0].cell_rise
+
+def test_lut_attr():
+    lut = get_lut()
+    assert isinstance(lut, ymcell.ClibLut)
+    assert lut.dimension == 2
+    assert lut.shape == (lut.index_num(0), lut.index_num(1))
+
+def test_index_array():
+    lut = get_lut()
+    for var in range(lut.dimension):
+        mv = lut.index_array(var)
+        assert mv.readonly
+        assert mv.format == 'd'
+        assert len(mv) == lut.index_num(var)
+        for pos in range(lut.index_num(var)):
+            assert mv[pos] == lut.index(var, pos)
+    with pytest.raises(ValueError):
+        lut.index_array(2)
+
+def test_value_array():
+    lut = get_lut()
+    mv = lut.value_array()
+    assert mv.readonly
+    assert mv.format == 'd'
+    assert mv.shape == lut.shape
+    n0, n1 = lut.shape
+    for i in range(n0):
+        for j in range(n1):
+            assert mv[i, j] == lut.grid_value(i, j)
+    # ClibLut 自身もバッファプロトコルをサポートする．
+    assert memoryview(lut).tolist() == mv.tolist()
+
+def test_value_scalar():
+    lut = get_lut()
+    x = (lut.index(0, 0) + lut.index(0, 1)) / 2
+    y = (lut.index(1, 0) + lut.index(1, 1)) / 2
+    val = lut.value(x, y)
+    assert isinstance(val, float)
+    with pytest.raises(TypeError):
+        lut.value(x)
+
+def test_value_array_input():
+    lut = get_lut()
+    n = 100
+    x0 = lut.index(0, 0)
+    x1 = lut.index(0, lut.index_num(0) - 1)
+    y0 = lut.index(1, 0)
+    y1 = lut.index(1, lut.index_num(1) - 1)
+    xs = array('d', [x0 + (x1 - x0) * k / n for k in range(n)])
+    ys = array('d', [y0 + (y1 - y0) * k / n for k in range(n)])
+    ans = lut.value(xs, ys)
+    assert ans.format == 'd'
+    assert len(ans) == n
+    for k in range(n):
+        assert ans[k] == lut.value(xs[k], ys[k])
+
+    # スカラーは配列に合わせて複製される．
+    ans2 = lut.value(xs, y0)
+    for k in range(n):
+        assert ans2[k] == lut.value(xs[k], y0)
+
+    # リストも受け付ける．
+    ans3 = lut.value(list(xs), list(ys))
+    assert ans3.tolist() == ans.tolist()
+
+    # 長さが異なる．
+    with pytest.raises(ValueError):
+        lut.value(xs, ys[:10])
+
+    # double 以外の配列は受け付けない．
+    with pytest.raises(TypeError):
+        lut.value(array('f', xs), ys)
+
+def test_value_numpy():
+    np = pytest.importorskip("numpy")
+    lut = get_lut()
+    values = np.asarray(lut)
+    assert values.shape == lut.shape
+    assert not values.flags.writeable
+    idx0 = np.asarray(lut.index_array(0))
+    idx1 = np.asarray(lut.index_array(1))
+    xs, ys = np.meshgrid(idx0, idx1, indexing='ij')
+    # 格子点上では格子点の値と一致する．
+    ans = np.asarray(lut.value(xs, ys))
+    assert ans.shape == xs.shape
+    assert np.allclose(ans, values)
@@ -51,3 +51,307 @@ def test_read_liberty():
             line = lines[i]
             exp_line = exp_lines[i].rstrip('\n')
             assert exp_line == line
+
+def test_read_liberty_many():
+    current_dir = os.path.dirname(__file__)
+    data_dir = os.path.join(current_dir, os.pardir)
+    lib_filename = os.path.join(data_dir, 'testdata', 'HIT018.typ.snp')
+    lib = ymcell.ClibCellLibrary.read_liberty(lib_filename)
+    exp_lines = lib.to_string_list()
+
+    lib_list = ymcell.ClibCellLibrary.read_liberty_many([lib_filename] * 4,
+                                                        num_threads=4)
+    assert len(lib_list) == 4
+    for lib1 in lib_list:
+        assert lib1.is_valid()
+        assert lib1.to_string_list() == exp_lines
+
+    bad_filename = os.path.join(data_dir, 'testdata', 'no_such_file.lib')
+    with pytest.raises(ValueError):
+        ymcell.ClibCellLibrary.read_liberty_many([lib_filename, bad_filename])
+
+def test_read_liberty_threads():
+    # read_liberty() は GIL を解放するので Python のスレッドから並行に呼べる．
+    from concurrent.futures import ThreadPoolExecutor
+    current_dir = os.path.dirname(__file__)
+    data_dir = os.path.join(current_dir, os.pardir)
+    lib_filename = os.path.join(data_dir, 'testdata', 'HIT018.typ.snp')
+    with ThreadPoolExecutor(max_workers=4) as executor:
+        lib_list = list(executor.map(ymcell.ClibCellLibrary.read_liberty,
+                                     [lib_filename] * 4))
+    exp_lines = lib_list[0].to_string_list()
+    for lib1 in lib_list[1:]:
+        assert lib1.to_string_list() == exp_lines
+
+def test_read_liberty_profile():
+    current_dir = os.path.dirname(__file__)
+    data_dir = os.path.join(current_dir, os.pardir)
+    lib_filename = os.path.join(data_dir, 'testdata', 'HIT018.typ.snp')
+    lib, profile = ymcell.ClibCellLibrary.read_liberty(lib_filename,
+                                                       profile=True)
+    assert lib.is_valid()
+    assert profile['filename'] == lib_filename
+    names = [phase['name'] for phase in profile['phases']]
+    assert names == ['read', 'parse', 'info', 'cell',
+                     'signature', 'grouping', 'gen_pat', 'wrap_up']
+    for phase in profile['phases']:
+        assert phase['wall_time'] >= 0.0
+        assert phase['peak_rss'] > 0
+    assert profile['phases'][0]['bytes'] == os.path.getsize(lib_filename)
+    assert profile['phases'][3]['objects'] == len(lib.cell_list)
+    assert profile['total_time'] == pytest.approx(
+        sum(phase['wall_time'] for phase in profile['phases']))
+
+def test_read_liberty_profile_env(tmp_path, monkeypatch):
+    import json
+    current_dir = os.path.dirname(__file__)
+    data_dir = os.path.join(current_dir, os.pardir)
+    lib_filename = os.path.join(data_dir, 'testdata', 'HIT018.typ.snp')
+    log_filename = tmp_path / 'profile.jsonl'
+    monkeypatch.setenv('YMCELL_LOAD_PROFILE', str(log_filename))
+    lib1 = ymcell.ClibCellLibrary.read_liberty(lib_filename)
+    lib2 = ymcell.ClibCellLibrary.read_liberty(lib_filename)
+    assert lib1.to_string_list() == lib2.to_string_list()
+    with open(log_filename, 'rt') as f:
+        lines = f.readlines()
+    assert len(lines) == 2
+    for line in lines:
+        profile = json.loads(line)
+        assert profile['filename'] == lib_filename
+        assert len(profile['phases']) == 8
+
+def test_pat_gen_param():
+    current_dir = os.path.dirname(__file__)
+    data_dir = os.path.join(current_dir, os.pardir)
+    lib_filename = os.path.join(data_dir, 'testdata', 'HIT018.typ.snp')
+    lib = ymcell.ClibCellLibrary.read_liberty(lib_filename)
+    stats = lib.pg_stats()
+    assert set(stats.keys()) == {'expr_num', 'input_pruned_expr_num',
+                                 'node_pruned_expr_num', 'class_pruned_pat_num',
+                                 'swept_node_num', 'pat_num', 'node_num'}
+    # 制限なしの場合は何も取り除かれない．
+    assert stats['expr_num'] > 0
+    assert stats['input_pruned_expr_num'] == 0
+    assert stats['node_pruned_expr_num'] == 0
+    assert stats['class_pruned_pat_num'] == 0
+    assert stats['pat_num'] > 0
+    assert stats['node_num'] > 0
+
+    # 入力数の制限
+    lib1 = ymcell.ClibCellLibrary.read_liberty(lib_filename, max_input=2)
+    stats1 = lib1.pg_stats()
+    assert stats1['expr_num'] == stats['expr_num']
+    assert stats1['input_pruned_expr_num'] > 0
+    assert stats1['pat_num'] < stats['pat_num']
+
+    # クラスごとのパタン数の制限
+    lib2 = ymcell.ClibCellLibrary.read_liberty(lib_filename,
+                                               max_pat_per_class=1)
+    stats2 = lib2.pg_stats()
+    assert stats2['class_pruned_pat_num'] > 0
+    assert stats2['pat_num'] < stats['pat_num']
+
+    # ノード数の制限
+    lib3 = ymcell.ClibCellLibrary.read_liberty(lib_filename,
+                                               max_node_num=stats['node_num'] // 2)
+    stats3 = lib3.pg_stats()
+    assert stats3['node_pruned_expr_num'] > 0
+    assert stats3['node_num'] < stats['node_num']
+
+    # mislib でも同じ引数が使える．
+    lib2_filename = os.path.join(data_dir, 'testdata', 'lib2.genlib')
+    lib4 = ymcell.ClibCellLibrary.read_mislib(lib2_filename, max_input=2)
+    assert lib4.pg_stats()['input_pruned_expr_num'] > 0
+
+    # 不正な値
+    for key in ('max_input', 'max_pat_per_class', 'max_node_num'):
+        with pytest.raises(ValueError):
+            ymcell.ClibCellLibrary.read_liberty(lib_filename, **{key: -1})
+        with pytest.raises(ValueError):
+            ymcell.ClibCellLibrary.read_mislib(lib2_filename, **{key: -1})
+        with pytest.raises(ValueError):
+            ymcell.ClibCellLibrary.read_liberty_many([lib_filename], **{key: -1})
+        with pytest.raises(TypeError):
+            ymcell.ClibCellLibrary.read_liberty(lib_filename, **{key: 'abc'})
+    with pytest.raises(TypeError):
+        ymcell.ClibCellLibrary.read_liberty(lib_filename, no_such_arg=1)
+
+def test_find_logic_cells():
+    from ymcell.ymlogic import Expr
+    current_dir = os.path.dirname(__file__)
+    data_dir = os.path.join(current_dir, os.pardir)
+    lit0 = Expr.posi_literal(0)
+    lit1 = Expr.posi_literal(1)
+    nand2 = ~(lit0 & lit1)
+    nor2 = ~(lit0 | lit1)
+
+    lib2_filename = os.path.join(data_dir, 'testdata', 'lib2.genlib')
+    lib = ymcell.ClibCellLibrary.read_mislib(lib2_filename)
+    # inv1x, inv2x, inv4x
+    cell_list = lib.find_logic_cells(~lit0)
+    assert len(cell_list) == 3
+    for cell in cell_list:
+        assert isinstance(cell, ymcell.ClibCell)
+    assert len(lib.find_logic_cells(nand2)) == 1
+    # 入力数を指定すると別の関数になる．
+    assert lib.find_logic_cells(nand2, 3) == []
+    assert lib.find_logic_cells(nand2, ni=2) != []
+    # 該当するセルがない場合は空のリストを返す．
+    assert lib.find_logic_cells(lit0 & ~lit1) == []
+
+    lib_filename = os.path.join(data_dir, 'testdata', 'HIT018.typ.snp')
+    lib = ymcell.ClibCellLibrary.read_liberty(lib_filename)
+    # HIT018 には '!(A&B)' と '!(A|B)' のセルがそれぞれ12個ある．
+    assert len(lib.find_logic_cells(nand2)) == 12
+    assert len(lib.find_logic_cells(nor2)) == 12
+
+    with pytest.raises(TypeError):
+        lib.find_logic_cells('A&B')
+
+def test_dump_restore(tmp_path):
+    current_dir = os.path.dirname(__file__)
+    data_dir = os.path.join(current_dir, os.pardir)
+    lib_filename = os.path.join(data_dir, 'testdata', 'HIT018.typ.snp')
+    lib = ymcell.ClibCellLibrary.read_liberty(lib_filename)
+    dump_filename = str(tmp_path / 'HIT018.dump')
+    lib.dump(dump_filename)
+    lib2 = ymcell.ClibCellLibrary.restore(dump_filename)
+    assert lib2.to_string_list() == lib.to_string_list()
+
+    with pytest.raises(ValueError):
+        ymcell.ClibCellLibrary.restore(str(tmp_path / 'no_such_file'))
+
+def test_cell_table():
+    current_dir = os.path.dirname(__file__)
+    data_dir = os.path.join(current_dir, os.pardir)
+    lib_filename = os.path.join(data_dir, 'testdata', 'HIT018.typ.snp')
+    lib = ymcell.ClibCellLibrary.read_liberty(lib_filename)
+    table = ymcell.cell_table(lib)
+    cell_list = lib.cell_list
+    n = len(cell_list)
+    assert len(table['name']) == n
+    assert table['name'][0] == 'HIT18AND2P005'
+    assert table['area'].format == 'd'
+    assert len(table['area']) == n
+    assert table['input_num'].format == 'q'
+    assert table['input_num'][0] == 2
+    assert table['output_num'][0] == 1
+    assert table['inout_num'][0] == 0
+
+def test_pin_table():
+    current_dir = os.path.dirname(__file__)
+    data_dir = os.path.join(current_dir, os.pardir)
+    lib_filename = os.path.join(data_dir, 'testdata', 'HIT018.typ.snp')
+    lib = ymcell.ClibCellLibrary.read_liberty(lib_filename)
+    table = ymcell.pin_table(lib)
+    n = len(table['name'])
+    for key in ('cell_id', 'pin_id', 'direction', 'capacitance',
+                'rise_capacitance', 'fall_capacitance'):
+        assert len(table[key]) == n
+    # ピンはセル番号順に並んでいる．
+    cell_ids = table['cell_id'].tolist()
+    assert cell_ids == sorted(cell_ids)
+    # 先頭のセル(HIT18AND2P005)は入力2つと出力1つを持つ．
+    assert cell_ids.count(0) == 3
+    assert table['pin_id'][0:3].tolist() == [0, 1, 2]
+
+def test_timing_table():
+    current_dir = os.path.dirname(__file__)
+    data_dir = os.path.join(current_dir, os.pardir)
+    lib_filename = os.path.join(data_dir, 'testdata', 'HIT018.typ.snp')
+    lib = ymcell.ClibCellLibrary.read_liberty(lib_filename)
+    table = ymcell.timing_table(lib)
+    n = len(table['cell_id'])
+    assert n > 0
+    for key in ('timing_id', 'ipos', 'opos', 'sense', 'type'):
+        assert len(table[key]) == n
+    assert set(table['sense'].tolist()) <= {1, 2, 3}
+
+    # 同じタイミングは (ipos, opos) ごとに1行しか現れない．
+    rows = set()
+    for k in range(n):
+        row = (table['cell_id'][k], table['timing_id'][k],
+               table['ipos'][k], table['opos'][k])
+        assert row not in rows
+        rows.add(row)
+
+    # HIT018 の FF セルのクロックエッジのアークは両方の遷移に適用される．
+    assert 3 in table['sense'].tolist()
+
+    # 先頭のセルのアークは timing_list() と一致する．
+    cell = lib.cell_list[0]
+    sense = ymcell.ClibTimingSense("positive_unate")
+    exp_num = len(cell.timing_list(0, 0, sense))
+    num = 0
+    for k in range(n):
+        if table['cell_id'][k] == 0 and table['ipos'][k] == 0 and \
+           table['opos'][k] == 0 and table['sense'][k] == 1:
+            num += 1
+    assert num == exp_num
+
+def test_table_numpy():
+    np = pytest.importorskip("numpy")
+    current_dir = os.path.dirname(__file__)
+    data_dir = os.path.join(current_dir, os.pardir)
+    lib_filename = os.path.join(data_dir, 'testdata', 'HIT018.typ.snp')
+    lib = ymcell.ClibCellLibrary.read_liberty(lib_filename)
+    table = ymcell.cell_table(lib)
+    area = np.asarray(table['area'])
+    assert area.dtype == np.float64
+    assert area.shape == (len(table['name']),)
+
+def test_pickle():
+    import pickle
+    current_dir = os.path.dirname(__file__)
+    data_dir = os.path.join(current_dir, os.pardir)
+    lib_filename = os.path.join(data_dir, 'testdata', 'HIT018.typ.snp')
+    lib = ymcell.ClibCellLibrary.read_liberty(lib_filename)
+    exp_lines = lib.to_string_list()
+
+    data = pickle.dumps(lib)
+    lib2 = pickle.loads(data)
+    assert isinstance(lib2, ymcell.ClibCellLibrary)
+    assert lib2.to_string_list() == exp_lines
+
+    # bytes-like object なら何でもよい．
+    lib3 = ymcell.ClibCellLibrary.from_bytes(memoryview(lib.to_bytes()))
+    assert lib3.to_string_list() == exp_lines
+
+def test_shm():
+    current_dir = os.path.dirname(__file__)
+    data_dir = os.path.join(current_dir, os.pardir)
+    lib_filename = os.path.join(data_dir, 'testdata', 'HIT018.typ.snp')
+    lib = ymcell.ClibCellLibrary.read_liberty(lib_filename)
+    exp_lines = lib.to_string_list()
+
+    name = "/ymcell_test_{}".format(os.getpid())
+    size = lib.to_shm(name)
+    try:
+        assert size == len(lib.to_bytes())
+        # 同じ名前では作れない．
+        with pytest.raises(OSError):
+            lib.to_shm(name)
+        lib2 = ymcell.ClibCellLibrary.from_shm(name)
+        assert lib2.to_string_list() == exp_lines
+    finally:
+        ymcell.ClibCellLibrary.unlink_shm(name)
+
+    with pytest.raises(OSError):
+        ymcell.ClibCellLibrary.from_shm(name)
+
+def test_shared_memory():
+    # multiprocessing.shared_memory のバッファからも復元できる．
+    from multiprocessing import shared_memory
+    current_dir = os.path.dirname(__file__)
+    data_dir = os.path.join(current_dir, os.pardir)
+    lib_filename = os.path.join(data_dir, 'testdata', 'HIT018.typ.snp')
+    lib = ymcell.ClibCellLibrary.read_liberty(lib_filename)
+    data = lib.to_bytes()
+    shm = shared_memory.SharedMemory(create=True, size=len(data))
+    try:
+        shm.buf[:len(data)] = data
+        lib2 = ymcell.ClibCellLibrary.from_bytes(shm.buf[:len(data)])
+        assert lib2.to_string_list() == lib.to_string_list()
+    finally:
+        shm.close()
+        shm.unlink()